@@ -10,11 +10,13 @@
 //!  Date       | Author           | Comments			
 //!  ---------- | ---------------- | ----------------
 //!  22/05/2016 | Bogdan Kokotenko | Initial draft
+//!  18/10/2026 | Bogdan Kokotenko | Added startup stack painting
 //
 //******************************************************************************
 #include "project.h"
 #include "types.h"
 #include "hal.h"
+#include "stack.h"
 
 // Warn of inappropriate MCU core selection
 #if ( !defined (_CC254x_HAL_) )
@@ -24,6 +26,23 @@
 //! Critical nesting variable.
 __data uint16_t GINT_criticalNesting = 0;    
 
+//------------------------------------------------------------------------------
+// Function:	
+//				__low_level_init()
+// Description:
+//! \brief      Low-level initializations
+//------------------------------------------------------------------------------
+__near_func __root char __low_level_init(void)
+{
+    // Fill free stack for high-water mark measurement
+    SYS_stackPaint();
+
+    // Return value:
+    // *  1 - Perform data segment initialization.
+    // *  0 - Skip data segment initialization.
+    return 1;
+}
+
 #endif // _CC254x_HAL_
 
 //******************************************************************************
@@ -0,0 +1,470 @@
+//******************************************************************************
+// Copyright (C) 2026 Bogdan Kokotenko
+//
+//  File description:
+//! \file       hal\mcu\mingw\adc.c
+//! \brief      MinGW simulated ADC (file-driven sample stream)
+//!
+//! \details    Samples are taken directly from the mapped file (no copy),
+//!             so the stream cost is dominated by ADC_Handler() itself.
+//!             Pacing uses absolute deadlines from the stream start, the
+//!             block is late (overrun) if its deadline is missed by more
+//!             than one block period. Like DMA only whole blocks are
+//!             delivered, trailing frames of the file are skipped.
+//!
+//!*****************************************************************************
+//! __Revisions:__
+//!  Date       | Author           | Comments
+//!  ---------- | ---------------- | -------------------------------------
+//!  18/10/2026 | Bogdan Kokotenko | Initial draft
+//!  18/10/2026 | Bogdan Kokotenko | Target handler contract, frame pacing
+//
+//******************************************************************************
+#include "project.h"
+#include "types.h"
+#include "hal.h"
+#include "clocks.h"
+#include "adc.h"
+
+// Warn of inappropriate MCU core selection
+#if ( !defined (_MINGW_HAL_) )
+#warning ADC: Unknown MCU core, check HAL configuration!
+#else
+
+#include <time.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+
+#ifdef _WIN32
+#include <io.h>
+#include <windows.h>
+#else
+#include <unistd.h>
+#include <sys/mman.h>
+#endif
+
+#ifdef ADC_SIM_FILE
+#include <assert.h>
+#include <pthread.h>
+#endif
+
+//! Remaining wait time spent in busy loop instead of sleep
+#define ADC_SIM_SPIN_NS         200000ULL
+
+//! WAV PCM format tags
+#define WAV_FORMAT_PCM          0x0001
+#define WAV_FORMAT_EXTENSIBLE   0xFFFE
+
+//! Simulated ADC context
+static struct ADC_SIM_t{
+    const uint8_t*  file;           //!< mapped file
+    size_t          fileSize;       //!< mapped file size
+    const int16_t*  samples;        //!< samples in mapped file
+    uint32_t        count;          //!< number of samples
+    uint32_t        position;       //!< next sample to deliver
+    uint8_t         channels;       //!< number of interleaved channels
+    uint32_t        fileRate;       //!< file frame rate
+    uint32_t        rate;           //!< stream frame rate
+    ADC_SIM_Stats_t stats;          //!< stream statistics
+#ifdef _WIN32
+    HANDLE          mapping;        //!< file mapping object
+#endif
+}ADC_SIM;
+
+//------------------------------------------------------------------------------
+// Function:
+//              ADC_SIM_le16(), ADC_SIM_le32()
+// Description:
+//! \brief      Read little-endian WAV header fields
+//------------------------------------------------------------------------------
+static uint16_t ADC_SIM_le16(const uint8_t* data)
+{
+    return (uint16_t)(data[0] | (data[1] << 8));
+}
+
+static uint32_t ADC_SIM_le32(const uint8_t* data)
+{
+    return (uint32_t)ADC_SIM_le16(data) | ((uint32_t)ADC_SIM_le16(data+2) << 16);
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              ADC_SIM_parseWav()
+// Description:
+//! \brief      Locate 16-bit PCM samples in WAV file
+//! \return     true - WAV file parsed, false - unsupported format
+//------------------------------------------------------------------------------
+static bool ADC_SIM_parseWav(void)
+{
+    const uint8_t* chunk = ADC_SIM.file + 12;
+    const uint8_t* end = ADC_SIM.file + ADC_SIM.fileSize;
+    bool format = false;
+
+    while(chunk + 8 <= end)
+    {
+        uint32_t size = ADC_SIM_le32(chunk + 4);
+        const uint8_t* body = chunk + 8;
+
+        if(size > (size_t)(end - body))
+            size = (uint32_t)(end - body);          // truncated recording
+
+        if(!memcmp(chunk, "fmt ", 4) && size >= 16)
+        {
+            uint16_t tag = ADC_SIM_le16(body);
+
+            if((tag != WAV_FORMAT_PCM && tag != WAV_FORMAT_EXTENSIBLE) ||
+                ADC_SIM_le16(body + 14) != 16)
+                return false;                       // 16-bit PCM only
+
+            ADC_SIM.channels = (uint8_t)ADC_SIM_le16(body + 2);
+            ADC_SIM.fileRate = ADC_SIM_le32(body + 4);
+            if(!ADC_SIM.channels || !ADC_SIM.fileRate)
+                return false;
+            format = true;
+        }
+        else if(!memcmp(chunk, "data", 4) && format)
+        {
+            ADC_SIM.samples = (const int16_t*)body;
+            ADC_SIM.count = size/sizeof(int16_t);
+            ADC_SIM.count -= ADC_SIM.count % ADC_SIM.channels;  // whole frames
+            return true;
+        }
+
+        chunk = body + size + (size & 1);           // chunks are word aligned
+    }
+
+    return false;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              ADC_SIM_open()
+// Description:
+//! \brief      Memory-map sample file
+//!
+//! \param fileName  raw little-endian int16 samples or 16-bit PCM WAV file
+//! \return          true - in case of success, false - otherwise
+//------------------------------------------------------------------------------
+bool ADC_SIM_open(const char* fileName)
+{
+    struct stat info;
+    void* file;
+    int fd;
+
+    ADC_SIM_close();
+
+    fd = open(fileName, O_RDONLY);
+    if(fd < 0)
+        return false;
+
+    if(fstat(fd, &info) != 0 || info.st_size < (off_t)sizeof(int16_t))
+    {
+        close(fd);
+        return false;
+    }
+
+#ifdef _WIN32
+    ADC_SIM.mapping = CreateFileMapping((HANDLE)_get_osfhandle(fd), NULL,
+                                        PAGE_READONLY, 0, 0, NULL);
+    file = ADC_SIM.mapping ?
+        MapViewOfFile(ADC_SIM.mapping, FILE_MAP_READ, 0, 0, 0) : NULL;
+    close(fd);
+    if(file == NULL)
+    {
+        if(ADC_SIM.mapping)
+            CloseHandle(ADC_SIM.mapping);
+        ADC_SIM.mapping = NULL;
+        return false;
+    }
+#else
+    file = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if(file == MAP_FAILED)
+        return false;
+
+    // Stream is read once from start to end
+    madvise(file, (size_t)info.st_size, MADV_SEQUENTIAL);
+#endif
+
+    ADC_SIM.file = (const uint8_t*)file;
+    ADC_SIM.fileSize = (size_t)info.st_size;
+    ADC_SIM.channels = 1;
+    ADC_SIM.fileRate = ADC_SIM_SAMPLE_RATE;
+
+    if(ADC_SIM.fileSize >= 12 && !memcmp(ADC_SIM.file, "RIFF", 4) &&
+       !memcmp(ADC_SIM.file + 8, "WAVE", 4))
+    {
+        if(!ADC_SIM_parseWav())
+        {
+            ADC_SIM_close();
+            return false;
+        }
+    }
+    else
+    {
+        ADC_SIM.samples = (const int16_t*)ADC_SIM.file;
+        ADC_SIM.count = (uint32_t)(ADC_SIM.fileSize/sizeof(int16_t));
+    }
+
+    ADC_SIM.rate = ADC_SIM.fileRate;
+    ADC_SIM.position = 0;
+    memset(&ADC_SIM.stats, 0x00, sizeof(ADC_SIM_Stats_t));
+
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              ADC_SIM_close()
+// Description:
+//! \brief      Unmap sample file
+//------------------------------------------------------------------------------
+void ADC_SIM_close(void)
+{
+    if(ADC_SIM.file == NULL)
+        return;
+
+#ifdef _WIN32
+    UnmapViewOfFile(ADC_SIM.file);
+    CloseHandle(ADC_SIM.mapping);
+    ADC_SIM.mapping = NULL;
+#else
+    munmap((void*)ADC_SIM.file, ADC_SIM.fileSize);
+#endif
+
+    ADC_SIM.file = NULL;
+    ADC_SIM.samples = NULL;
+    ADC_SIM.count = 0;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              ADC_SIM_getSamples()
+// Description:
+//! \brief      Get number of samples in mapped file
+//------------------------------------------------------------------------------
+uint32_t ADC_SIM_getSamples(void)
+{
+    return ADC_SIM.count;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              ADC_SIM_getChannels()
+// Description:
+//! \brief      Get number of channels (interleaved) in mapped file
+//------------------------------------------------------------------------------
+uint8_t ADC_SIM_getChannels(void)
+{
+    return ADC_SIM.channels;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              ADC_SIM_getSampleRate()
+// Description:
+//! \brief      Get sample (frame) rate of mapped file
+//------------------------------------------------------------------------------
+uint32_t ADC_SIM_getSampleRate(void)
+{
+    return ADC_SIM.fileRate;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              ADC_SIM_setRate()
+// Description:
+//! \brief      Set stream frame rate
+//! \param sampleRate  frames per second, ADC_SIM_RATE_MAX - no pacing
+//------------------------------------------------------------------------------
+void ADC_SIM_setRate(uint32_t sampleRate)
+{
+    ADC_SIM.rate = sampleRate;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              ADC_SIM_getStats()
+// Description:
+//! \brief      Read stream statistics
+//------------------------------------------------------------------------------
+void ADC_SIM_getStats(ADC_SIM_Stats_t* stats)
+{
+    *stats = ADC_SIM.stats;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              ADC_SIM_wait()
+// Description:
+//! \brief      Wait till absolute deadline (sleep, then spin)
+//------------------------------------------------------------------------------
+static void ADC_SIM_wait(uint64_t deadline)
+{
+    uint64_t now = CLK_timeNs();
+
+    if(now >= deadline)
+        return;
+
+    if(deadline - now > ADC_SIM_SPIN_NS)
+    {
+        uint64_t sleep = deadline - now - ADC_SIM_SPIN_NS;
+        struct timespec interval;
+
+        interval.tv_sec = (time_t)(sleep/1000000000ULL);
+        interval.tv_nsec = (long)(sleep%1000000000ULL);
+        nanosleep(&interval, NULL);
+    }
+
+    while(CLK_timeNs() < deadline);
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              ADC_SIM_run()
+// Description:
+//! \brief      Deliver frames to ADC_Handler() in caller context
+//!
+//! \param frames   number of frames (rounded up to whole blocks),
+//!                 0 - till end of file (forever in loop)
+//! \param loop     restart from the beginning at the end of file
+//! \return         number of delivered frames
+//------------------------------------------------------------------------------
+uint32_t ADC_SIM_run(uint32_t frames, bool loop)
+{
+    uint64_t start = CLK_timeNs();
+    uint64_t periodNs = 0;
+    uint32_t delivered = 0;
+    uint32_t block = ADC_SIM_BLOCK_SIZE*ADC_SIM.channels;   // samples
+
+    if(ADC_SIM.count < block)
+        return 0;
+
+    if(ADC_SIM.rate != ADC_SIM_RATE_MAX)
+        periodNs = (1000000000ULL*ADC_SIM_BLOCK_SIZE)/ADC_SIM.rate;
+
+    while(frames == 0 || delivered < frames)
+    {
+        bool late = false;
+
+        // Whole blocks only, as DMA transfer complete
+        if(ADC_SIM.count - ADC_SIM.position < block)
+        {
+            if(!loop)
+                break;
+            ADC_SIM.position = 0;
+        }
+
+        if(periodNs)
+        {
+            uint64_t deadline = start +
+                (1000000000ULL*(delivered + ADC_SIM_BLOCK_SIZE))/ADC_SIM.rate;
+
+            if(CLK_timeNs() > deadline + periodNs)
+            {
+                ADC_SIM.stats.overruns++;
+                late = true;
+            }
+            ADC_SIM_wait(deadline);
+        }
+
+        #ifdef ADC_Handler
+            ADC_Handler((int16_t*)&ADC_SIM.samples[ADC_SIM.position], late);
+        #else
+            (void)late;
+        #endif
+
+        #ifdef USE_LOW_POWER_MODE
+            LPM_disable();                  // Wake-up MCU
+        #endif
+
+        ADC_SIM.position += block;
+        delivered += ADC_SIM_BLOCK_SIZE;
+        ADC_SIM.stats.blocks++;
+    }
+
+    ADC_SIM.stats.samples += delivered*ADC_SIM.channels;
+    ADC_SIM.stats.elapsedNs += CLK_timeNs() - start;
+
+    return delivered;
+}
+
+#ifdef ADC_SIM_FILE
+
+//! ADC conversion thread
+static pthread_t ADC_threadId;
+
+//! ADC conversion thread state
+static bool ADC_threadRunning = false;
+
+//------------------------------------------------------------------------------
+// Function:
+//              ADC_thread()
+// Description:
+//! \brief      ADC conversion thread (simulates ADC/DMA interrupt)
+//------------------------------------------------------------------------------
+static void* ADC_thread(void* arg)
+{
+    (void)arg;
+
+    // Prepare thread for fast cancelation
+    if(pthread_setcanceltype(PTHREAD_CANCEL_ASYNCHRONOUS, NULL) != 0)
+        assert(!"ERROR: ADC thread could not be configured!");
+
+    #ifdef ADC_SIM_LOOP
+        ADC_SIM_run(0, true);
+    #else
+        ADC_SIM_run(0, false);
+    #endif
+
+    return NULL;
+}
+
+#endif // ADC_SIM_FILE
+
+//------------------------------------------------------------------------------
+// Function:
+//              ADC_init()
+// Description:
+//! \brief      ADC initialization
+//! \details    Maps ADC_SIM_FILE (if configured) and streams it from the
+//!             conversion thread at the file sample rate.
+//------------------------------------------------------------------------------
+void ADC_init(void)
+{
+#ifdef ADC_SIM_FILE
+    ADC_stop();
+
+    if(!ADC_SIM_open(ADC_SIM_FILE))
+        assert(!"ERROR: ADC sample file could not be mapped!");
+
+    if(pthread_create(&ADC_threadId, NULL, ADC_thread, NULL) != 0)
+        assert(!"ERROR: ADC thread could not be created!");
+    else
+        ADC_threadRunning = true;
+#endif
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              ADC_stop()
+// Description:
+//! \brief      Stop conversion thread
+//------------------------------------------------------------------------------
+void ADC_stop(void)
+{
+#ifdef ADC_SIM_FILE
+    if(ADC_threadRunning)
+    {
+        pthread_cancel(ADC_threadId);
+        pthread_join(ADC_threadId, NULL);
+        ADC_threadRunning = false;
+    }
+#endif
+}
+
+#endif // _MINGW_HAL_
+
+//******************************************************************************
+// End of file
+//******************************************************************************
@@ -0,0 +1,98 @@
+//******************************************************************************
+// Copyright (C) 2026 Bogdan Kokotenko
+//
+//! \addtogroup mingwhal
+//! @{
+//******************************************************************************
+//	File description:
+//! \file       hal\mcu\mingw\adc.h
+//! \brief      MinGW simulated ADC (file-driven sample stream)
+//!
+//! \details    Recorded signal (raw int16 or 16-bit PCM WAV) is memory
+//!             mapped and delivered to ADC_Handler(results, overflow) in
+//!             blocks of ADC_SIM_BLOCK_SIZE frames (conversion sequences
+//!             of interleaved channels), paced at the frame rate or as fast
+//!             as possible. Handler has the MSP430F5x contract: results of
+//!             the sequence (block), overflow - previous results were not
+//!             taken in time (late block).
+//!
+//!*****************************************************************************
+//! __Revisions:__
+//!  Date       | Author           | Comments
+//!  ---------- | ---------------- | --------------------------
+//!  18/10/2026 | Bogdan Kokotenko | Initial draft
+//!  18/10/2026 | Bogdan Kokotenko | Target handler contract, frame pacing
+//
+//******************************************************************************
+#ifndef ADC_H
+#define ADC_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Include configurations
+#include "adc_config.h"
+
+//! Frames per ADC_Handler() call (1 - per-conversion ISR, >1 - DMA block)
+#ifndef ADC_SIM_BLOCK_SIZE
+#define ADC_SIM_BLOCK_SIZE      1
+#endif
+
+//! Frame rate of raw files (WAV files provide own rate)
+#ifndef ADC_SIM_SAMPLE_RATE
+#define ADC_SIM_SAMPLE_RATE     8000L       // Hz
+#endif
+
+//! Stream as fast as possible (throughput measurement)
+#define ADC_SIM_RATE_MAX        0
+
+//! Simulated ADC stream statistics
+typedef struct _ADC_SIM_Stats_t{
+    uint32_t samples;           //!< number of delivered samples (channels)
+    uint32_t blocks;            //!< number of ADC_Handler() calls
+    uint32_t overruns;          //!< number of late (missed deadline) blocks
+    uint64_t elapsedNs;         //!< stream time (nsec)
+}ADC_SIM_Stats_t;
+
+//------------------------- Simulation APIs ------------------------------------
+//! Memory-map sample file (raw int16 or WAV)
+bool ADC_SIM_open(const char* fileName);
+
+//! Unmap sample file
+void ADC_SIM_close(void);
+
+//! Get number of samples in mapped file
+uint32_t ADC_SIM_getSamples(void);
+
+//! Get number of channels (interleaved) in mapped file
+uint8_t ADC_SIM_getChannels(void);
+
+//! Get sample (frame) rate of mapped file
+uint32_t ADC_SIM_getSampleRate(void);
+
+//! Set stream frame rate (ADC_SIM_RATE_MAX - as fast as possible)
+void ADC_SIM_setRate(uint32_t sampleRate);
+
+//! Deliver frames to ADC_Handler() in caller context
+uint32_t ADC_SIM_run(uint32_t frames, bool loop);
+
+//! Read stream statistics
+void ADC_SIM_getStats(ADC_SIM_Stats_t* stats);
+
+//------------------------------- ADC APIs -------------------------------------
+//! ADC initialization (maps ADC_SIM_FILE and starts conversion thread)
+void ADC_init(void);
+
+//! Stop conversion thread
+void ADC_stop(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ADC_H
+//! @}
+//******************************************************************************
+// End of file
+//******************************************************************************
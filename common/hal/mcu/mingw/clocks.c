@@ -10,6 +10,7 @@
 //!  Date       | Author           | Comments			
 //!  ---------- | ---------------- | ----------------
 //!  24/07/2016 | Bogdan Kokotenko | Initial draft
+//!  18/10/2026 | Bogdan Kokotenko | Added host time base and usec delay
 //
 //******************************************************************************
 #include "project.h"
@@ -22,6 +23,8 @@
 #warning CLOCKS: Unknown MCU core, check HAL configuration!
 #else
 
+#include <time.h>
+
 //------------------------------------------------------------------------------
 // Function:	
 //              CLK_init()
@@ -33,6 +36,38 @@ void CLK_init(void)
 
 }
 
+//------------------------------------------------------------------------------
+// Function:	
+//              CLK_timeNs()
+// Description:
+//! \brief      Free-running host time base
+//! \details    Monotonic clock, used by simulated peripherals as a timestamp
+//! \return     Time in nsec since unspecified starting point
+//------------------------------------------------------------------------------
+uint64_t CLK_timeNs(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (uint64_t)now.tv_sec*1000000000ULL + (uint64_t)now.tv_nsec;
+}
+
+//------------------------------------------------------------------------------
+// Function:	
+//              CLK_delayNs()
+// Description:
+//! \brief      Busy-wait delay
+//! \details    Spins on the host time base like __delay_cycles() on target,
+//!             sleep functions are too coarse for bus bit times.
+//! \param delay Delay in nsec
+//------------------------------------------------------------------------------
+void CLK_delayNs(uint64_t delay)
+{
+    uint64_t deadline = CLK_timeNs() + delay;
+
+    while(CLK_timeNs() < deadline);
+}
+
 #endif // _MINGW_HAL_
 
 //******************************************************************************
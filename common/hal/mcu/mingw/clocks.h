@@ -13,6 +13,7 @@
 //!  Date       | Author           | Comments			
 //!  ---------- | ---------------- | ----------------
 //!  21/05/2016 | Bogdan Kokotenko | Initial draft
+//!  18/10/2026 | Bogdan Kokotenko | Added host time base and usec delay
 //
 //******************************************************************************
 #ifndef CLOCKS_H
@@ -25,9 +26,21 @@ extern "C" {
 // Include configurations
 #include "clocks_config.h"
 
+//! Software delay (ms)
+#define __delay_ms(MS)  CLK_delayNs((uint64_t)(MS)*1000000ULL)
+
+//! Software delay (us)
+#define __delay_us(US)  CLK_delayNs((uint64_t)(US)*1000ULL)
+
 //! Initialize system clocks
 void CLK_init(void);
 
+//! Free-running host time base (nsec)
+uint64_t CLK_timeNs(void);
+
+//! Busy-wait delay (nsec)
+void CLK_delayNs(uint64_t delay);
+
 #ifdef __cplusplus
 }
 #endif
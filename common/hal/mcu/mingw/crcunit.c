@@ -0,0 +1,223 @@
+//******************************************************************************
+// Copyright (C) 2026 Bogdan Kokotenko
+//
+//  File description:
+//! \file       hal\mcu\mingw\crcunit.c
+//! \brief      MinGW CRC unit: carry-less multiply (PCLMULQDQ) CRC32 folding
+//!
+//! \details    Folding constants of reflected CRC are x^(D+32) mod P and
+//!             x^(D-32) mod P (bit reflected, shifted left by 1) for the
+//!             folding distance D (512 or 128 bits). The last 128 bits are
+//!             reduced to 64 and 32 bits and the remainder is computed by
+//!             Barrett reduction with mu = x^64 / P.
+//!
+//!*****************************************************************************
+//! __Revisions:__
+//!  Date       | Author           | Comments
+//!  ---------- | ---------------- | -------------------------------------
+//!  18/10/2026 | Bogdan Kokotenko | Initial draft
+//
+//******************************************************************************
+#include "project.h"
+#include "types.h"
+#include "hal.h"
+#include "crcunit.h"
+
+// Warn of inappropriate MCU core selection
+#if ( !defined (_MINGW_HAL_) )
+#warning CRCUNIT: Unknown MCU core, check HAL configuration!
+#else
+
+#if defined(__i386__) || defined(__x86_64__)
+
+#include <wmmintrin.h>
+
+//! Folding and reduction constants of reflected CRC32
+typedef struct _CRCUNIT_Constants_t{
+    uint64_t fold512[2];        //!< x^544 mod P, x^480 mod P
+    uint64_t fold128[2];        //!< x^160 mod P, x^96 mod P
+    uint64_t fold64;            //!< x^64 mod P
+    uint64_t barrett[2];        //!< P, mu = x^64 / P
+}CRCUNIT_Constants_t;
+
+//! CRC32 (IEEE 802.3) constants
+static const CRCUNIT_Constants_t CRCUNIT_crc32Constants = {
+    {0x154442BD4ULL, 0x1C6E41596ULL},
+    {0x1751997D0ULL, 0x0CCAA009EULL},
+    0x163CD6124ULL,
+    {0x1DB710641ULL, 0x1F7011641ULL}
+};
+
+//! CRC32C (Castagnoli) constants
+static const CRCUNIT_Constants_t CRCUNIT_crc32cConstants = {
+    {0x0740EEF02ULL, 0x09E4ADDF8ULL},
+    {0x0F20C0DFEULL, 0x14CD00BD6ULL},
+    0x0DD45AAB8ULL,
+    {0x105EC76F1ULL, 0x0DEA713F1ULL}
+};
+
+//------------------------------------------------------------------------------
+// Function:
+//              CRCUNIT_fold()
+// Description:
+//! \brief      Fold 128-bit value over distance of constants and add data
+//------------------------------------------------------------------------------
+__attribute__((target("pclmul,sse2")))
+static inline __m128i CRCUNIT_fold(__m128i value, __m128i constants,
+                                   const uint8_t* data)
+{
+    return _mm_xor_si128(
+        _mm_xor_si128(_mm_clmulepi64_si128(value, constants, 0x00),
+                      _mm_clmulepi64_si128(value, constants, 0x11)),
+        _mm_loadu_si128((const __m128i*)data));
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              CRCUNIT_pclmul()
+// Description:
+//! \brief      Fold data chunk (multiple of 16 bytes, at least 64 bytes)
+//------------------------------------------------------------------------------
+__attribute__((target("pclmul,sse2")))
+static uint32_t CRCUNIT_pclmul(uint32_t crc, const uint8_t* data,
+                               uint32_t size, const CRCUNIT_Constants_t* k)
+{
+    const __m128i mask32 = _mm_set_epi32(0, 0, 0, -1);
+    __m128i constants;
+    __m128i x0, x1, x2, x3;
+
+    // Initial remainder is added to the first data bits
+    x0 = _mm_xor_si128(_mm_loadu_si128((const __m128i*)data),
+                       _mm_cvtsi32_si128((int)crc));
+    x1 = _mm_loadu_si128((const __m128i*)(data + 16));
+    x2 = _mm_loadu_si128((const __m128i*)(data + 32));
+    x3 = _mm_loadu_si128((const __m128i*)(data + 48));
+    data += 64;
+    size -= 64;
+
+    // Fold 4 independent lanes by 512 bits
+    constants = _mm_loadu_si128((const __m128i*)k->fold512);
+    while(size >= 64)
+    {
+        x0 = CRCUNIT_fold(x0, constants, data);
+        x1 = CRCUNIT_fold(x1, constants, data + 16);
+        x2 = CRCUNIT_fold(x2, constants, data + 32);
+        x3 = CRCUNIT_fold(x3, constants, data + 48);
+        data += 64;
+        size -= 64;
+    }
+
+    // Fold lanes into single one, then the rest of data by 128 bits
+    constants = _mm_loadu_si128((const __m128i*)k->fold128);
+    x0 = _mm_xor_si128(x1, _mm_xor_si128(
+                        _mm_clmulepi64_si128(x0, constants, 0x00),
+                        _mm_clmulepi64_si128(x0, constants, 0x11)));
+    x0 = _mm_xor_si128(x2, _mm_xor_si128(
+                        _mm_clmulepi64_si128(x0, constants, 0x00),
+                        _mm_clmulepi64_si128(x0, constants, 0x11)));
+    x0 = _mm_xor_si128(x3, _mm_xor_si128(
+                        _mm_clmulepi64_si128(x0, constants, 0x00),
+                        _mm_clmulepi64_si128(x0, constants, 0x11)));
+    while(size >= 16)
+    {
+        x0 = CRCUNIT_fold(x0, constants, data);
+        data += 16;
+        size -= 16;
+    }
+
+    // Reduce 128 -> 64 bits
+    x0 = _mm_xor_si128(_mm_clmulepi64_si128(x0, constants, 0x10),
+                       _mm_srli_si128(x0, 8));
+
+    // Reduce 64 -> 32 bits
+    constants = _mm_set_epi64x(0, (long long)k->fold64);
+    x0 = _mm_xor_si128(
+            _mm_clmulepi64_si128(_mm_and_si128(x0, mask32), constants, 0x00),
+            _mm_srli_si128(x0, 4));
+
+    // Barrett reduction
+    constants = _mm_loadu_si128((const __m128i*)k->barrett);
+    x1 = _mm_clmulepi64_si128(_mm_and_si128(x0, mask32), constants, 0x10);
+    x1 = _mm_clmulepi64_si128(_mm_and_si128(x1, mask32), constants, 0x00);
+    x0 = _mm_xor_si128(x0, x1);
+
+    return (uint32_t)_mm_cvtsi128_si32(_mm_srli_si128(x0, 4));
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              CRCUNIT_update()
+// Description:
+//! \brief      Process whole 16-byte blocks of data chunk
+//------------------------------------------------------------------------------
+static uint32_t CRCUNIT_update(uint32_t* crc, const void* data, uint32_t size,
+                               const CRCUNIT_Constants_t* constants)
+{
+    static int supported = -1;
+
+    if(supported < 0)
+        supported = __builtin_cpu_supports("pclmul") ? 1 : 0;
+
+    if(!supported || size < 64)
+        return 0;
+
+    size &= ~(uint32_t)15;
+    *crc = CRCUNIT_pclmul(*crc, (const uint8_t*)data, size, constants);
+
+    return size;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              CRCUNIT_crc32()
+// Description:
+//! \brief      Feed data to CRC32 calculation
+//!
+//! \param *crc     current CRC value (context), updated
+//! \param *data    pointer to data chunk
+//! \param size     size of data chunk
+//! \return         number of processed bytes (from the chunk start)
+//------------------------------------------------------------------------------
+uint32_t CRCUNIT_crc32(uint32_t* crc, const void* data, uint32_t size)
+{
+    return CRCUNIT_update(crc, data, size, &CRCUNIT_crc32Constants);
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              CRCUNIT_crc32c()
+// Description:
+//! \brief      Feed data to CRC32C calculation
+//!
+//! \param *crc     current CRC value (context), updated
+//! \param *data    pointer to data chunk
+//! \param size     size of data chunk
+//! \return         number of processed bytes (from the chunk start)
+//------------------------------------------------------------------------------
+uint32_t CRCUNIT_crc32c(uint32_t* crc, const void* data, uint32_t size)
+{
+    return CRCUNIT_update(crc, data, size, &CRCUNIT_crc32cConstants);
+}
+
+#else
+
+// No carry-less multiply, data is processed by lib/crc tables
+uint32_t CRCUNIT_crc32(uint32_t* crc, const void* data, uint32_t size)
+{
+    (void)crc; (void)data; (void)size;
+    return 0;
+}
+
+uint32_t CRCUNIT_crc32c(uint32_t* crc, const void* data, uint32_t size)
+{
+    (void)crc; (void)data; (void)size;
+    return 0;
+}
+
+#endif // __i386__ || __x86_64__
+
+#endif // _MINGW_HAL_
+
+//******************************************************************************
+// End of file
+//******************************************************************************
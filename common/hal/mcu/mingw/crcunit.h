@@ -0,0 +1,60 @@
+//******************************************************************************
+// Copyright (C) 2026 Bogdan Kokotenko
+//
+//! \addtogroup mingwhal
+//! @{
+//******************************************************************************
+//	File description:
+//! \file       hal\mcu\mingw\crcunit.h
+//! \brief      MinGW CRC unit: carry-less multiply (PCLMULQDQ) CRC32 folding
+//!
+//! \details    Backend of lib/crc (USE_CRC_UNIT) for x86 hosts. Data is
+//!             folded by 64 bytes per iteration and reduced by Barrett
+//!             reduction, so CRC32 and CRC32C cost a fraction of cycle
+//!             per byte. Without PCLMULQDQ support (detected at runtime)
+//!             or on other hosts nothing is processed and lib/crc falls
+//!             back to tables.
+//!
+//!*****************************************************************************
+//! __Revisions:__
+//!  Date       | Author           | Comments
+//!  ---------- | ---------------- | --------------------------
+//!  18/10/2026 | Bogdan Kokotenko | Initial draft
+//
+//******************************************************************************
+#ifndef CRCUNIT_H
+#define CRCUNIT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//! CRC unit supports CRC32 (IEEE 802.3)
+#define CRCUNIT_CRC32
+
+//! CRC unit supports CRC32C (Castagnoli)
+#define CRCUNIT_CRC32C
+
+//! Data alignment required by CRC unit (bytes)
+#define CRCUNIT_ALIGN           1
+
+//! Minimal data chunk passed to CRC unit (bytes)
+#ifndef CRCUNIT_MIN_SIZE
+#define CRCUNIT_MIN_SIZE        64
+#endif
+
+//! Feed data to CRC32 calculation, return number of processed bytes
+uint32_t CRCUNIT_crc32(uint32_t* crc, const void* data, uint32_t size);
+
+//! Feed data to CRC32C calculation, return number of processed bytes
+uint32_t CRCUNIT_crc32c(uint32_t* crc, const void* data, uint32_t size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // CRCUNIT_H
+//! @}
+//******************************************************************************
+// End of file
+//******************************************************************************
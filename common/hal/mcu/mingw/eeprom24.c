@@ -0,0 +1,188 @@
+//******************************************************************************
+// Copyright (C) 2026 Bogdan Kokotenko
+//
+//  File description:
+//! \file       hal\mcu\mingw\eeprom24.c
+//! \brief      24Cxx serial EEPROM device model for simulated I2C bus
+//!
+//!*****************************************************************************
+//! __Revisions:__
+//!  Date       | Author           | Comments
+//!  ---------- | ---------------- | -------------------------------------
+//!  18/10/2026 | Bogdan Kokotenko | Initial draft
+//
+//******************************************************************************
+#include "project.h"
+#include "types.h"
+#include "hal.h"
+#include "clocks.h"
+#include "eeprom24.h"
+
+// Warn of inappropriate MCU core selection
+#if ( !defined (_MINGW_HAL_) )
+#warning EEPROM24: Unknown MCU core, check HAL configuration!
+#else
+
+//! Maximal size of EEPROM with single word address byte
+#define EEPROM24_SMALL_SIZE     2048
+
+//------------------------------------------------------------------------------
+// Function:
+//              EEPROM24_start()
+// Description:
+//! \brief      (Re)start condition addressed to EEPROM
+//------------------------------------------------------------------------------
+static bool EEPROM24_start(void* device, uint8_t address, bool read)
+{
+    EEPROM24_t* eeprom = (EEPROM24_t*)device;
+
+    // No ACK during internal write cycle
+    if(eeprom->busyUntil && CLK_timeNs() < eeprom->busyUntil)
+        return false;
+    eeprom->busyUntil = 0;
+
+    // Block select bits of small devices are sent within slave address
+    if(eeprom->addressBytes == 1 && eeprom->size > 256)
+    {
+        uint32_t block = (uint32_t)(address & ((eeprom->size >> 8) - 1)) << 8;
+        eeprom->pointer = block | (eeprom->pointer & 0xFF);
+    }
+
+    if(!read)
+    {
+        eeprom->addressCount = 0;
+        eeprom->writing = false;
+    }
+
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              EEPROM24_write()
+// Description:
+//! \brief      Receive word address or data byte
+//------------------------------------------------------------------------------
+static bool EEPROM24_write(void* device, uint8_t dataByte)
+{
+    EEPROM24_t* eeprom = (EEPROM24_t*)device;
+
+    // Word address
+    if(eeprom->addressCount < eeprom->addressBytes)
+    {
+        if(eeprom->addressBytes == 1)
+            eeprom->pointer = (eeprom->pointer & ~0xFFUL) | dataByte;
+        else
+            eeprom->pointer = (eeprom->pointer << 8) | dataByte;
+
+        if(++eeprom->addressCount == eeprom->addressBytes)
+            eeprom->pointer &= eeprom->size - 1;
+
+        return true;
+    }
+
+    // Page write, address counter rolls over within the page
+    eeprom->memory[eeprom->pointer] = dataByte;
+    eeprom->pointer = (eeprom->pointer & ~(uint32_t)(eeprom->pageSize - 1)) |
+                      ((eeprom->pointer + 1) & (eeprom->pageSize - 1));
+    eeprom->writing = true;
+    eeprom->bytesWritten++;
+
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              EEPROM24_read()
+// Description:
+//! \brief      Transmit data byte (sequential read)
+//------------------------------------------------------------------------------
+static uint8_t EEPROM24_read(void* device, bool ack)
+{
+    EEPROM24_t* eeprom = (EEPROM24_t*)device;
+    uint8_t dataByte = eeprom->memory[eeprom->pointer];
+
+    (void)ack;
+    eeprom->pointer = (eeprom->pointer + 1) & (eeprom->size - 1);
+    eeprom->bytesRead++;
+
+    return dataByte;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              EEPROM24_stop()
+// Description:
+//! \brief      Stop condition starts internal write cycle
+//------------------------------------------------------------------------------
+static void EEPROM24_stop(void* device)
+{
+    EEPROM24_t* eeprom = (EEPROM24_t*)device;
+
+    if(!eeprom->writing)
+        return;
+
+    eeprom->writing = false;
+    eeprom->writeCycles++;
+    if(eeprom->writeCycleNs)
+        eeprom->busyUntil = CLK_timeNs() + eeprom->writeCycleNs;
+}
+
+//! 24Cxx EEPROM I2C device model interface
+const I2C_SIM_Model_t EEPROM24_model = {
+    EEPROM24_start,
+    EEPROM24_write,
+    EEPROM24_read,
+    EEPROM24_stop
+};
+
+//------------------------------------------------------------------------------
+// Function:
+//              EEPROM24_init()
+// Description:
+//! \brief      Initialize EEPROM device model
+//!
+//! \param eeprom   device model instance
+//! \param memory   memory array (size bytes)
+//! \param size     memory size (power of 2, 128 bytes .. 64 KB)
+//! \param pageSize write page size (power of 2)
+//------------------------------------------------------------------------------
+void EEPROM24_init(EEPROM24_t* eeprom, uint8_t* memory,
+                   uint32_t size, uint16_t pageSize)
+{
+    memset(eeprom, 0x00, sizeof(EEPROM24_t));
+    memset(memory, 0xFF, size);
+
+    eeprom->memory = memory;
+    eeprom->size = size;
+    eeprom->pageSize = pageSize;
+    eeprom->addressBytes = (size <= EEPROM24_SMALL_SIZE) ? 1 : 2;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              EEPROM24_attach()
+// Description:
+//! \brief      Attach EEPROM device model to simulated I2C bus
+//!
+//! \param bus      bus index
+//! \param address  slave address (EEPROM24_ADDRESS | A2..A0)
+//! \param eeprom   initialized device model instance
+//! \return         true - in case of success, false - otherwise
+//------------------------------------------------------------------------------
+bool EEPROM24_attach(uint8_t bus, uint8_t address, EEPROM24_t* eeprom)
+{
+    uint8_t mask = 0x7F;
+
+    // Small devices occupy one slave address per 256 byte block
+    if(eeprom->addressBytes == 1 && eeprom->size > 256)
+        mask &= ~(uint8_t)((eeprom->size >> 8) - 1);
+
+    return I2C_SIM_attach(bus, address, mask, &EEPROM24_model, eeprom);
+}
+
+#endif // _MINGW_HAL_
+
+//******************************************************************************
+// End of file
+//******************************************************************************
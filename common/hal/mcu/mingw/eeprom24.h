@@ -0,0 +1,71 @@
+//******************************************************************************
+// Copyright (C) 2026 Bogdan Kokotenko
+//
+//! \addtogroup mingwhal
+//! @{
+//******************************************************************************
+//	File description:
+//! \file       hal\mcu\mingw\eeprom24.h
+//! \brief      24Cxx serial EEPROM device model for simulated I2C bus
+//!
+//! \details    Devices up to 2 KB (24C01..24C16) use one address byte and
+//!             take upper address bits from the slave address, larger
+//!             devices (24C32..24C512) use two address bytes.
+//!             Page writes wrap within the page, sequential reads wrap
+//!             over the whole memory. During the write cycle the device
+//!             does not acknowledge its address (ACK polling).
+//!
+//!*****************************************************************************
+//! __Revisions:__
+//!  Date       | Author           | Comments
+//!  ---------- | ---------------- | --------------------------
+//!  18/10/2026 | Bogdan Kokotenko | Initial draft
+//
+//******************************************************************************
+#ifndef EEPROM24_H
+#define EEPROM24_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "i2c.h"
+
+//! Base slave address of 24Cxx EEPROM
+#define EEPROM24_ADDRESS        0x50
+
+//! 24Cxx EEPROM device model instance
+typedef struct _EEPROM24_t{
+    uint8_t*  memory;           //!< memory array
+    uint32_t  size;             //!< memory size (bytes, power of 2)
+    uint16_t  pageSize;         //!< write page size (bytes, power of 2)
+    uint8_t   addressBytes;     //!< number of word address bytes
+    uint8_t   addressCount;     //!< received word address bytes
+    uint32_t  pointer;          //!< internal address counter
+    bool      writing;          //!< data bytes received in write frame
+    uint64_t  writeCycleNs;     //!< write cycle time (tWR), 0 - instant
+    uint64_t  busyUntil;        //!< end of current write cycle (nsec)
+    uint32_t  writeCycles;      //!< number of write cycles
+    uint32_t  bytesWritten;     //!< number of written bytes
+    uint32_t  bytesRead;        //!< number of read bytes
+}EEPROM24_t;
+
+//! 24Cxx EEPROM I2C device model interface
+extern const I2C_SIM_Model_t EEPROM24_model;
+
+//! Initialize EEPROM device model (memory is erased to 0xFF)
+void EEPROM24_init(EEPROM24_t* eeprom, uint8_t* memory,
+                   uint32_t size, uint16_t pageSize);
+
+//! Attach EEPROM device model to simulated I2C bus
+bool EEPROM24_attach(uint8_t bus, uint8_t address, EEPROM24_t* eeprom);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // EEPROM24_H
+//! @}
+//******************************************************************************
+// End of file
+//******************************************************************************
@@ -0,0 +1,380 @@
+//******************************************************************************
+// Copyright (C) 2026 Bogdan Kokotenko
+//
+//  File description:
+//! \file       hal\mcu\mingw\flash.c
+//! \brief      MinGW simulated flash (memory-mapped file)
+//!
+//! \details    Flash image is read-only for the application between
+//!             operations (like locked flash controller), so stray writes
+//!             fault instead of silently corrupting stored data.
+//!             Erase and program times are accumulated in statistics and
+//!             also spent in the caller with FLASH_SIM_REALTIME defined.
+//!
+//!*****************************************************************************
+//! __Revisions:__
+//!  Date       | Author           | Comments
+//!  ---------- | ---------------- | -------------------------------------
+//!  18/10/2026 | Bogdan Kokotenko | Initial draft
+//
+//******************************************************************************
+#include "project.h"
+#include "types.h"
+#include "hal.h"
+#include "clocks.h"
+#include "flash.h"
+
+// Warn of inappropriate MCU core selection
+#if ( !defined (_MINGW_HAL_) )
+#warning FLASH: Unknown MCU core, check HAL configuration!
+#else
+
+#include <assert.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+
+#ifdef _WIN32
+#include <io.h>
+#include <windows.h>
+#else
+#include <unistd.h>
+#include <sys/mman.h>
+#endif
+
+//! Number of flash segments
+#define FLASH_SEGMENTS      (FLASH_SIM_SIZE/FLASH_SEGMENT_SIZE)
+
+//! Size of flash image file (image + erase counters)
+#define FLASH_FILE_SIZE     (FLASH_SIM_SIZE + FLASH_SEGMENTS*sizeof(uint32_t))
+
+//! Erased flash byte
+#define FLASH_ERASED        0xFF
+
+//! Simulated flash context
+static struct FLASH_SIM_t{
+    uint8_t*          image;        //!< mapped flash image
+    uint32_t*         eraseCount;   //!< erase counters (after the image)
+    FLASH_SIM_Stats_t stats;        //!< flash statistics
+#ifdef _WIN32
+    HANDLE            mapping;      //!< file mapping object
+#endif
+}FLASH_SIM;
+
+//------------------------------------------------------------------------------
+// Function:
+//              FLASH_SIM_unlock(), FLASH_SIM_lock()
+// Description:
+//! \brief      Allow/forbid image modification (flash controller LOCK bit)
+//------------------------------------------------------------------------------
+static void FLASH_SIM_unlock(void)
+{
+#ifndef _WIN32
+    mprotect(FLASH_SIM.image, FLASH_SIM_SIZE, PROT_READ | PROT_WRITE);
+#endif
+}
+
+static void FLASH_SIM_lock(void)
+{
+#ifndef _WIN32
+    mprotect(FLASH_SIM.image, FLASH_SIM_SIZE, PROT_READ);
+#endif
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              FLASH_SIM_offset()
+// Description:
+//! \brief      Convert flash address to image offset
+//------------------------------------------------------------------------------
+static uint32_t FLASH_SIM_offset(const void* address, uint32_t size)
+{
+    const uint8_t* pointer = (const uint8_t*)address;
+
+    if(FLASH_SIM.image == NULL ||
+       pointer < FLASH_SIM.image ||
+       pointer + size > FLASH_SIM.image + FLASH_SIM_SIZE)
+        assert(!"ERROR: Address is out of simulated flash!");
+
+    return (uint32_t)(pointer - FLASH_SIM.image);
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              FLASH_SIM_busy()
+// Description:
+//! \brief      Account erase/program time
+//------------------------------------------------------------------------------
+static void FLASH_SIM_busy(uint64_t busyNs)
+{
+    FLASH_SIM.stats.busyNs += busyNs;
+
+    #ifdef FLASH_SIM_REALTIME
+        CLK_delayNs(busyNs);
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              FLASH_SIM_open()
+// Description:
+//! \brief      Map flash image file
+//!
+//! \param fileName  flash image file, created erased if it does not exist
+//! \return          true - in case of success, false - otherwise
+//------------------------------------------------------------------------------
+bool FLASH_SIM_open(const char* fileName)
+{
+    struct stat info;
+    void* file;
+    bool erased;
+    int fd;
+
+    FLASH_SIM_close();
+
+    fd = open(fileName, O_RDWR | O_CREAT, 0644);
+    if(fd < 0)
+        return false;
+
+    // New (or resized) image is erased and has no wear history
+    if(fstat(fd, &info) != 0)
+    {
+        close(fd);
+        return false;
+    }
+    erased = (info.st_size != (off_t)FLASH_FILE_SIZE);
+    if(erased && ftruncate(fd, (off_t)FLASH_FILE_SIZE) != 0)
+    {
+        close(fd);
+        return false;
+    }
+
+#ifdef _WIN32
+    FLASH_SIM.mapping = CreateFileMapping((HANDLE)_get_osfhandle(fd), NULL,
+                                          PAGE_READWRITE, 0, 0, NULL);
+    file = FLASH_SIM.mapping ?
+        MapViewOfFile(FLASH_SIM.mapping, FILE_MAP_WRITE, 0, 0, 0) : NULL;
+    close(fd);
+    if(file == NULL)
+    {
+        if(FLASH_SIM.mapping)
+            CloseHandle(FLASH_SIM.mapping);
+        FLASH_SIM.mapping = NULL;
+        return false;
+    }
+#else
+    file = mmap(NULL, FLASH_FILE_SIZE, PROT_READ | PROT_WRITE,
+                MAP_SHARED, fd, 0);
+    close(fd);
+    if(file == MAP_FAILED)
+        return false;
+#endif
+
+    FLASH_SIM.image = (uint8_t*)file;
+    FLASH_SIM.eraseCount = (uint32_t*)(FLASH_SIM.image + FLASH_SIM_SIZE);
+    memset(&FLASH_SIM.stats, 0x00, sizeof(FLASH_SIM_Stats_t));
+
+    if(erased)
+    {
+        memset(FLASH_SIM.image, FLASH_ERASED, FLASH_SIM_SIZE);
+        memset(FLASH_SIM.eraseCount, 0x00, FLASH_SEGMENTS*sizeof(uint32_t));
+    }
+
+    FLASH_SIM_lock();
+
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              FLASH_SIM_close()
+// Description:
+//! \brief      Flush and unmap flash image
+//------------------------------------------------------------------------------
+void FLASH_SIM_close(void)
+{
+    if(FLASH_SIM.image == NULL)
+        return;
+
+#ifdef _WIN32
+    FlushViewOfFile(FLASH_SIM.image, 0);
+    UnmapViewOfFile(FLASH_SIM.image);
+    CloseHandle(FLASH_SIM.mapping);
+    FLASH_SIM.mapping = NULL;
+#else
+    msync(FLASH_SIM.image, FLASH_FILE_SIZE, MS_SYNC);
+    munmap(FLASH_SIM.image, FLASH_FILE_SIZE);
+#endif
+
+    FLASH_SIM.image = NULL;
+    FLASH_SIM.eraseCount = NULL;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              FLASH_SIM_base()
+// Description:
+//! \brief      Get start address of simulated flash
+//------------------------------------------------------------------------------
+void* FLASH_SIM_base(void)
+{
+    return FLASH_SIM.image;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              FLASH_SIM_getEraseCount()
+// Description:
+//! \brief      Get erase count of the segment
+//------------------------------------------------------------------------------
+uint32_t FLASH_SIM_getEraseCount(const void* segmentAddress)
+{
+    uint32_t offset = FLASH_SIM_offset(segmentAddress, 1);
+
+    return FLASH_SIM.eraseCount[offset/FLASH_SEGMENT_SIZE];
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              FLASH_SIM_getMaxEraseCount()
+// Description:
+//! \brief      Get maximal erase count over all segments
+//------------------------------------------------------------------------------
+uint32_t FLASH_SIM_getMaxEraseCount(void)
+{
+    uint32_t maxCount = 0;
+    uint32_t segment;
+
+    if(FLASH_SIM.eraseCount == NULL)
+        return 0;
+
+    for(segment = 0; segment < FLASH_SEGMENTS; segment++)
+    {
+        if(FLASH_SIM.eraseCount[segment] > maxCount)
+            maxCount = FLASH_SIM.eraseCount[segment];
+    }
+
+    return maxCount;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              FLASH_SIM_getStats()
+// Description:
+//! \brief      Read flash statistics
+//------------------------------------------------------------------------------
+void FLASH_SIM_getStats(FLASH_SIM_Stats_t* stats)
+{
+    *stats = FLASH_SIM.stats;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              FLASH_SIM_resetStats()
+// Description:
+//! \brief      Clear flash statistics
+//------------------------------------------------------------------------------
+void FLASH_SIM_resetStats(void)
+{
+    memset(&FLASH_SIM.stats, 0x00, sizeof(FLASH_SIM_Stats_t));
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              FLASH_SIM_erase()
+// Description:
+//! \brief      Erase segments and update erase counters
+//------------------------------------------------------------------------------
+static void FLASH_SIM_erase(uint32_t offset, uint32_t size)
+{
+    uint32_t segment;
+
+    FLASH_SIM_unlock();
+    memset(FLASH_SIM.image + offset, FLASH_ERASED, size);
+
+    // Counters could share the last locked page with the image
+    for(segment = offset/FLASH_SEGMENT_SIZE;
+        segment < (offset + size)/FLASH_SEGMENT_SIZE; segment++)
+        FLASH_SIM.eraseCount[segment]++;
+    FLASH_SIM_lock();
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              FLASH_bankErase()
+// Description:
+//! \brief      Flash bank erase
+//------------------------------------------------------------------------------
+void FLASH_bankErase(void* bankAddress)
+{
+    uint32_t offset = FLASH_SIM_offset(bankAddress, 1);
+    uint32_t size = FLASH_BANK_SIZE;
+
+    offset -= offset % FLASH_BANK_SIZE;
+    if(size > FLASH_SIM_SIZE - offset)
+        size = FLASH_SIM_SIZE - offset;
+
+    FLASH_SIM_erase(offset, size);
+    FLASH_SIM.stats.bankErases++;
+    FLASH_SIM_busy(FLASH_SIM_BANK_ERASE_NS);
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              FLASH_segmentErase()
+// Description:
+//! \brief      Flash segment erase
+//------------------------------------------------------------------------------
+void FLASH_segmentErase(void* segmentAddress)
+{
+    uint32_t offset = FLASH_SIM_offset(segmentAddress, 1);
+
+    offset -= offset % FLASH_SEGMENT_SIZE;
+
+    FLASH_SIM_erase(offset, FLASH_SEGMENT_SIZE);
+    FLASH_SIM.stats.segmentErases++;
+    FLASH_SIM_busy(FLASH_SIM_SEGMENT_ERASE_NS);
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              FLASH_write()
+// Description:
+//! \brief      Flash page write
+//! \details    Programming only clears bits: attempt to set bit which is
+//!             not erased is counted as violation and leaves cell value
+//!             as real flash does (old & new).
+//------------------------------------------------------------------------------
+void FLASH_write(void* pagePtr, void *data, uint16_t size)
+{
+    uint32_t offset = FLASH_SIM_offset(pagePtr, size);
+    const uint8_t* dataPtr = (const uint8_t*)data;
+    uint8_t* flashPtr = FLASH_SIM.image + offset;
+    bool violation = false;
+
+    FLASH_SIM_unlock();
+    while (size > 0)
+    {
+        if(*dataPtr & ~*flashPtr)
+            violation = true;                   // 0->1 bit transition
+        *flashPtr++ &= *dataPtr++;
+        FLASH_SIM.stats.bytesWritten++;
+        FLASH_SIM_busy(FLASH_SIM_BYTE_WRITE_NS);
+        size--;
+    }
+    FLASH_SIM_lock();
+
+    FLASH_SIM.stats.writes++;
+    if(violation)
+    {
+        FLASH_SIM.stats.violations++;
+        #ifdef FLASH_SIM_STRICT
+            assert(!"ERROR: Flash write without erase!");
+        #endif
+    }
+}
+
+#endif // _MINGW_HAL_
+
+//******************************************************************************
+// End of file
+//******************************************************************************
@@ -0,0 +1,114 @@
+//******************************************************************************
+// Copyright (C) 2026 Bogdan Kokotenko
+//
+//! \addtogroup mingwhal
+//! @{
+//******************************************************************************
+//	File description:
+//! \file       hal\mcu\mingw\flash.h
+//! \brief      MinGW simulated flash APIs
+//!
+//! \details    Flash image is a memory-mapped file, so it is read directly
+//!             via pointers (as on target) and persists between runs.
+//!             Programming only clears bits (1->0), erase sets whole
+//!             segment/bank to 0xFF. Erase counters of every segment are
+//!             kept after the flash image in the same file.
+//!
+//!*****************************************************************************
+//! __Revisions:__
+//!  Date       | Author           | Comments
+//!  ---------- | ---------------- | --------------------------
+//!  18/10/2026 | Bogdan Kokotenko | Initial draft
+//
+//******************************************************************************
+#ifndef FLASH_H
+#define FLASH_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Include configurations
+#include "flash_config.h"
+
+//! Simulated flash size
+#ifndef FLASH_SIM_SIZE
+#define FLASH_SIM_SIZE              (256*1024L)
+#endif
+
+//! Flash segment (erase unit) size
+#ifndef FLASH_SEGMENT_SIZE
+#define FLASH_SEGMENT_SIZE          512
+#endif
+
+//! Flash bank size
+#ifndef FLASH_BANK_SIZE
+#define FLASH_BANK_SIZE             (64*1024L)
+#endif
+
+//! Segment erase time (MSP430F5x tERASE)
+#ifndef FLASH_SIM_SEGMENT_ERASE_NS
+#define FLASH_SIM_SEGMENT_ERASE_NS  23000000ULL
+#endif
+
+//! Bank erase time (MSP430F5x tMASS)
+#ifndef FLASH_SIM_BANK_ERASE_NS
+#define FLASH_SIM_BANK_ERASE_NS     32000000ULL
+#endif
+
+//! Byte program time (MSP430F5x tWORD)
+#ifndef FLASH_SIM_BYTE_WRITE_NS
+#define FLASH_SIM_BYTE_WRITE_NS     64000ULL
+#endif
+
+//! Simulated flash statistics
+typedef struct _FLASH_SIM_Stats_t{
+    uint32_t segmentErases;     //!< number of segment erase operations
+    uint32_t bankErases;        //!< number of bank erase operations
+    uint32_t writes;            //!< number of write operations
+    uint32_t bytesWritten;      //!< number of programmed bytes
+    uint32_t violations;        //!< writes of 0->1 bits without erase
+    uint64_t busyNs;            //!< modelled erase/program time (nsec)
+}FLASH_SIM_Stats_t;
+
+//------------------------- Simulation APIs ------------------------------------
+//! Map flash image file (created erased if it does not exist)
+bool FLASH_SIM_open(const char* fileName);
+
+//! Flush and unmap flash image
+void FLASH_SIM_close(void);
+
+//! Get start address of simulated flash
+void* FLASH_SIM_base(void);
+
+//! Get erase count of the segment
+uint32_t FLASH_SIM_getEraseCount(const void* segmentAddress);
+
+//! Get maximal erase count over all segments
+uint32_t FLASH_SIM_getMaxEraseCount(void);
+
+//! Read flash statistics
+void FLASH_SIM_getStats(FLASH_SIM_Stats_t* stats);
+
+//! Clear flash statistics (erase counters are kept)
+void FLASH_SIM_resetStats(void);
+
+//------------------------------ FLASH APIs ------------------------------------
+//! Flash bank erase
+void FLASH_bankErase(void* bankAddress);
+
+//! Flash segment erase
+void FLASH_segmentErase(void* segmentAddress);
+
+//! Flash page write
+void FLASH_write(void* pagePtr, void *data, uint16_t size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // FLASH_H
+//! @}
+//******************************************************************************
+// End of file
+//******************************************************************************
@@ -11,8 +11,14 @@
 //!  ---------- | ---------------- | -------------------------------------
 //!  23/07/2016 | Bogdan Kokotenko | Initial draft
 //!  24/07/2016 | Bogdan Kokotenko | Added simulation of GINT and LPM
+//!  18/10/2026 | Bogdan Kokotenko | Fixed build with GNU libc
 //
 //******************************************************************************
+// Enable GNU extensions (recursive mutex initializer on GNU libc)
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
 #include "project.h"
 #include "types.h"
 #include "hal.h"
@@ -25,6 +31,12 @@
 #include <assert.h>
 #include <pthread.h>
 
+// GNU libc provides recursive mutex initializer as non-portable extension
+#if ( !defined(PTHREAD_RECURSIVE_MUTEX_INITIALIZER) && \
+       defined(PTHREAD_RECURSIVE_MUTEX_INITIALIZER_NP) )
+#define PTHREAD_RECURSIVE_MUTEX_INITIALIZER PTHREAD_RECURSIVE_MUTEX_INITIALIZER_NP
+#endif
+
 //! Global interrupt simulation mutex
 //static std::recursive_mutex     GINT_mutex;
 static pthread_mutex_t GINT_mutex = PTHREAD_RECURSIVE_MUTEX_INITIALIZER;
@@ -114,8 +126,8 @@ void LeaveCriticalSectionAndSuspend()
 //------------------------------------------------------------------------------
 void MCU_enableInterrupts()
 {
-    LPM_lock = PTHREAD_MUTEX_INITIALIZER;
-    GINT_mutex = PTHREAD_RECURSIVE_MUTEX_INITIALIZER;
+    LPM_lock = (pthread_mutex_t)PTHREAD_MUTEX_INITIALIZER;
+    GINT_mutex = (pthread_mutex_t)PTHREAD_RECURSIVE_MUTEX_INITIALIZER;
 }
 
 //------------------------------------------------------------------------------
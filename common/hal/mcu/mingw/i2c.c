@@ -0,0 +1,534 @@
+//******************************************************************************
+// Copyright (C) 2026 Bogdan Kokotenko
+//
+//  File description:
+//! \file       hal\mcu\mingw\i2c.c
+//! \brief      MinGW simulated I2C bus (master)
+//!
+//! \details    Every frame is passed byte by byte to the addressed device
+//!             model. Bus time is modelled from the configured clock:
+//!             start/stop take one bit time, address and data bytes take
+//!             nine bit times (with ACK). With I2C_SIM_REALTIME defined
+//!             the caller is also delayed for the modelled time.
+//!
+//!*****************************************************************************
+//! __Revisions:__
+//!  Date       | Author           | Comments
+//!  ---------- | ---------------- | -------------------------------------
+//!  18/10/2026 | Bogdan Kokotenko | Initial draft
+//
+//******************************************************************************
+#include "project.h"
+#include "types.h"
+#include "hal.h"
+#include "clocks.h"
+#include "i2c.h"
+
+// Warn of inappropriate MCU core selection
+#if ( !defined (_MINGW_HAL_) )
+#warning I2C: Unknown MCU core, check HAL configuration!
+#else
+
+//! Number of simulated I2C buses
+#define I2C_SIM_BUSES       2
+
+//! Idle SDA line level (pulled up)
+#define I2C_SIM_IDLE_SDA    0xFF
+
+//! Bit times of one byte with ACK
+#define I2C_SIM_BYTE_BITS   9
+
+//! Attached device model slot
+static struct I2C_SIM_Slot_t{
+    const I2C_SIM_Model_t* model;       //!< device model
+    void*   device;                     //!< device model instance
+    uint8_t bus;                        //!< bus index
+    uint8_t address;                    //!< slave address
+    uint8_t mask;                       //!< slave address mask
+}I2C_SIM_slot[I2C_SIM_DEVICES];         //!< Attached device models
+
+//! Simulated bus context
+static struct I2C_SIM_Bus_t{
+    uint32_t        bitTimeNs;          //!< modelled time of one bit
+    uint8_t         slaveAddress;       //!< selected slave address
+    bool            errorFlag;          //!< last operation error flag
+    I2C_SIM_Stats_t stats;              //!< bus statistics
+}I2C_SIM_bus[I2C_SIM_BUSES];            //!< Simulated buses
+
+//------------------------------------------------------------------------------
+// Function:
+//              I2C_SIM_attach()
+// Description:
+//! \brief      Attach device model to the slave address
+//!
+//! \param bus      bus index (0 - I2C0, 1 - I2C1)
+//! \param address  7-bit slave address
+//! \param mask     address bits compared (0x7F - exact match)
+//! \param model    device model interface
+//! \param device   device model instance
+//! \return         true - in case of success, false - otherwise
+//------------------------------------------------------------------------------
+bool I2C_SIM_attach(uint8_t bus, uint8_t address, uint8_t mask,
+                    const I2C_SIM_Model_t* model, void* device)
+{
+    uint8_t index;
+
+    if(bus >= I2C_SIM_BUSES)
+        return false;
+
+    for(index = 0; index < I2C_SIM_DEVICES; index++)
+    {
+        if(I2C_SIM_slot[index].model == NULL)
+        {
+            I2C_SIM_slot[index].model = model;
+            I2C_SIM_slot[index].device = device;
+            I2C_SIM_slot[index].bus = bus;
+            I2C_SIM_slot[index].address = address & mask;
+            I2C_SIM_slot[index].mask = mask;
+            return true;
+        }
+    }
+
+    // No empty slots
+    return false;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              I2C_SIM_detachAll()
+// Description:
+//! \brief      Detach all device models
+//------------------------------------------------------------------------------
+void I2C_SIM_detachAll(void)
+{
+    memset(I2C_SIM_slot, 0x00, sizeof(I2C_SIM_slot));
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              I2C_SIM_setBaudrate()
+// Description:
+//! \brief      Change modelled bus clock
+//------------------------------------------------------------------------------
+void I2C_SIM_setBaudrate(uint8_t bus, uint32_t baudrate)
+{
+    if(bus < I2C_SIM_BUSES && baudrate)
+        I2C_SIM_bus[bus].bitTimeNs = (uint32_t)(1000000000ULL/baudrate);
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              I2C_SIM_getStats()
+// Description:
+//! \brief      Read bus statistics
+//------------------------------------------------------------------------------
+void I2C_SIM_getStats(uint8_t bus, I2C_SIM_Stats_t* stats)
+{
+    if(bus < I2C_SIM_BUSES)
+        *stats = I2C_SIM_bus[bus].stats;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              I2C_SIM_resetStats()
+// Description:
+//! \brief      Clear bus statistics
+//------------------------------------------------------------------------------
+void I2C_SIM_resetStats(uint8_t bus)
+{
+    if(bus < I2C_SIM_BUSES)
+        memset(&I2C_SIM_bus[bus].stats, 0x00, sizeof(I2C_SIM_Stats_t));
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              I2C_SIM_find()
+// Description:
+//! \brief      Find device model by slave address
+//------------------------------------------------------------------------------
+static struct I2C_SIM_Slot_t* I2C_SIM_find(uint8_t bus, uint8_t address)
+{
+    uint8_t index;
+
+    for(index = 0; index < I2C_SIM_DEVICES; index++)
+    {
+        struct I2C_SIM_Slot_t* slot = &I2C_SIM_slot[index];
+
+        if(slot->model && slot->bus == bus &&
+           slot->address == (address & slot->mask))
+            return slot;
+    }
+
+    return NULL;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              I2C_SIM_frame()
+// Description:
+//! \brief      Run one master frame: [S addr+W tx..] [Sr addr+R rx..] P
+//!
+//! \param bus      bus index
+//! \param address  7-bit slave address
+//! \param tx       data to write (write phase is skipped if txSize == 0
+//!                 and rxSize != 0)
+//! \param txSize   size of data to write
+//! \param rx       buffer for data to read
+//! \param rxSize   size of data to read (read phase skipped if 0)
+//! \return         true - frame acknowledged, false - NACK
+//------------------------------------------------------------------------------
+static bool I2C_SIM_frame(uint8_t bus, uint8_t address,
+                          const uint8_t* tx, uint16_t txSize,
+                          uint8_t* rx, uint16_t rxSize)
+{
+    struct I2C_SIM_Bus_t* ctx = &I2C_SIM_bus[bus];
+    struct I2C_SIM_Slot_t* slot = I2C_SIM_find(bus, address);
+    uint32_t bits = 0;
+    uint16_t index;
+    bool ack = true;
+
+    // Write phase
+    if(txSize || !rxSize)
+    {
+        bits += 1 + I2C_SIM_BYTE_BITS;              // start + address
+        ack = slot && (!slot->model->start ||
+                       slot->model->start(slot->device, address, false));
+
+        for(index = 0; ack && index < txSize; index++)
+        {
+            bits += I2C_SIM_BYTE_BITS;
+            ack = !slot->model->write ||
+                  slot->model->write(slot->device, tx[index]);
+            ctx->stats.bytes++;
+        }
+    }
+
+    // Read phase
+    if(ack && rxSize)
+    {
+        bits += 1 + I2C_SIM_BYTE_BITS;              // (re)start + address
+        ack = slot && (!slot->model->start ||
+                       slot->model->start(slot->device, address, true));
+
+        for(index = 0; ack && index < rxSize; index++)
+        {
+            bits += I2C_SIM_BYTE_BITS;
+            rx[index] = slot->model->read ?
+                slot->model->read(slot->device, index != rxSize - 1) :
+                I2C_SIM_IDLE_SDA;
+            ctx->stats.bytes++;
+        }
+    }
+
+    // Stop condition
+    bits += 1;
+    if(slot && slot->model->stop)
+        slot->model->stop(slot->device);
+
+    // Account modelled bus time
+    uint64_t busyNs = (uint64_t)ctx->bitTimeNs*bits;
+    ctx->stats.transactions++;
+    ctx->stats.busyNs += busyNs;
+    if(!ack)
+        ctx->stats.nacks++;
+    ctx->errorFlag = !ack;
+
+    #ifdef I2C_SIM_REALTIME
+        CLK_delayNs(busyNs);
+    #endif
+
+    return ack;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              I2C_SIM_complete()
+// Description:
+//! \brief      Simulate operation complete (or NACK) interrupt
+//------------------------------------------------------------------------------
+static void I2C_SIM_complete(void (*handler)(void))
+{
+    if(handler)
+    {
+        #ifdef I2C_handlerCaller
+            I2C_handlerCaller(handler);
+        #else
+            handler();
+        #endif
+    }
+
+    #ifdef USE_LOW_POWER_MODE
+        LPM_disable();                  // Wake-up MCU
+    #endif
+}
+
+// -------------------- I2C0 APIs --------------------
+
+//------------------------------------------------------------------------------
+// Function:
+//              I2C0_init()
+// Description:
+//! \brief      Initialize I2C0
+//------------------------------------------------------------------------------
+bool I2C0_init(void)
+{
+    I2C_SIM_setBaudrate(0, I2C0_BAUDRATE);
+    I2C_SIM_resetStats(0);
+    I2C_SIM_bus[0].errorFlag = false;
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              I2C0_isBusy()
+// Description:
+//! \brief      Check I2C0 state
+//! \note       Simulated frames complete before API returns
+//------------------------------------------------------------------------------
+bool I2C0_isBusy(void)
+{
+    return false;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              I2C0_error()
+// Description:
+//! \brief      Check I2C0 error
+//------------------------------------------------------------------------------
+bool I2C0_error(void)
+{
+    return I2C_SIM_bus[0].errorFlag;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              I2C0_setOwnAddress()
+// Description:
+//! \brief      Set I2C0 own address
+//------------------------------------------------------------------------------
+void I2C0_setOwnAddress(uint8_t address)
+{
+    (void)address;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              I2C0_selectSlaveAddress()
+// Description:
+//! \brief      Select I2C0 slave address
+//------------------------------------------------------------------------------
+void I2C0_selectSlaveAddress(uint8_t address)
+{
+    I2C_SIM_bus[0].slaveAddress = address;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              I2C0_txByte()
+// Description:
+//! \brief      Transmit byte via I2C0
+//------------------------------------------------------------------------------
+void I2C0_txByte(uint8_t dataByte)
+{
+    I2C_SIM_frame(0, I2C_SIM_bus[0].slaveAddress, &dataByte, 1, NULL, 0);
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              I2C0_rxByte()
+// Description:
+//! \brief      Receive byte via I2C0
+//------------------------------------------------------------------------------
+uint8_t I2C0_rxByte(void)
+{
+    uint8_t dataByte = 0x00;
+
+    if(!I2C_SIM_frame(0, I2C_SIM_bus[0].slaveAddress, NULL, 0, &dataByte, 1))
+        return 0x00;
+
+    return dataByte;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              I2C0_transmit()
+// Description:
+//! \brief      Transmit byte array via I2C0
+//------------------------------------------------------------------------------
+void I2C0_transmit(uint8_t address,
+                   const void* data, uint16_t size, void (*handler)(void))
+{
+    I2C_SIM_bus[0].slaveAddress = address;
+    I2C_SIM_frame(0, address, (const uint8_t*)data, size, NULL, 0);
+    I2C_SIM_complete(handler);
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              I2C0_receive()
+// Description:
+//! \brief      Receive byte array via I2C0
+//------------------------------------------------------------------------------
+void I2C0_receive(uint8_t address,
+                  void* data, uint16_t size, void (*handler)(void))
+{
+    I2C_SIM_bus[0].slaveAddress = address;
+    I2C_SIM_frame(0, address, NULL, 0, (uint8_t*)data, size);
+    I2C_SIM_complete(handler);
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              I2C0_request()
+// Description:
+//! \brief      Transmit byte array and receive byte array via I2C0
+//------------------------------------------------------------------------------
+void I2C0_request(uint8_t address,
+                  const void* txData, uint16_t txSize,
+                  void* rxData, uint16_t rxSize,
+                  void (*handler)(void))
+{
+    I2C_SIM_bus[0].slaveAddress = address;
+    I2C_SIM_frame(0, address, (const uint8_t*)txData, txSize,
+                  (uint8_t*)rxData, rxSize);
+    I2C_SIM_complete(handler);
+}
+
+// -------------------- I2C1 APIs --------------------
+
+//------------------------------------------------------------------------------
+// Function:
+//              I2C1_init()
+// Description:
+//! \brief      Initialize I2C1
+//------------------------------------------------------------------------------
+bool I2C1_init(void)
+{
+    I2C_SIM_setBaudrate(1, I2C1_BAUDRATE);
+    I2C_SIM_resetStats(1);
+    I2C_SIM_bus[1].errorFlag = false;
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              I2C1_isBusy()
+// Description:
+//! \brief      Check I2C1 state
+//------------------------------------------------------------------------------
+bool I2C1_isBusy(void)
+{
+    return false;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              I2C1_error()
+// Description:
+//! \brief      Check I2C1 error
+//------------------------------------------------------------------------------
+bool I2C1_error(void)
+{
+    return I2C_SIM_bus[1].errorFlag;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              I2C1_setOwnAddress()
+// Description:
+//! \brief      Set I2C1 own address
+//------------------------------------------------------------------------------
+void I2C1_setOwnAddress(uint8_t address)
+{
+    (void)address;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              I2C1_selectSlaveAddress()
+// Description:
+//! \brief      Select I2C1 slave address
+//------------------------------------------------------------------------------
+void I2C1_selectSlaveAddress(uint8_t address)
+{
+    I2C_SIM_bus[1].slaveAddress = address;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              I2C1_txByte()
+// Description:
+//! \brief      Transmit byte via I2C1
+//------------------------------------------------------------------------------
+void I2C1_txByte(uint8_t dataByte)
+{
+    I2C_SIM_frame(1, I2C_SIM_bus[1].slaveAddress, &dataByte, 1, NULL, 0);
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              I2C1_rxByte()
+// Description:
+//! \brief      Receive byte via I2C1
+//------------------------------------------------------------------------------
+uint8_t I2C1_rxByte(void)
+{
+    uint8_t dataByte = 0x00;
+
+    if(!I2C_SIM_frame(1, I2C_SIM_bus[1].slaveAddress, NULL, 0, &dataByte, 1))
+        return 0x00;
+
+    return dataByte;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              I2C1_transmit()
+// Description:
+//! \brief      Transmit byte array via I2C1
+//------------------------------------------------------------------------------
+void I2C1_transmit(uint8_t address,
+                   const void* data, uint16_t size, void (*handler)(void))
+{
+    I2C_SIM_bus[1].slaveAddress = address;
+    I2C_SIM_frame(1, address, (const uint8_t*)data, size, NULL, 0);
+    I2C_SIM_complete(handler);
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              I2C1_receive()
+// Description:
+//! \brief      Receive byte array via I2C1
+//------------------------------------------------------------------------------
+void I2C1_receive(uint8_t address,
+                  void* data, uint16_t size, void (*handler)(void))
+{
+    I2C_SIM_bus[1].slaveAddress = address;
+    I2C_SIM_frame(1, address, NULL, 0, (uint8_t*)data, size);
+    I2C_SIM_complete(handler);
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              I2C1_request()
+// Description:
+//! \brief      Transmit byte array and receive byte array via I2C1
+//------------------------------------------------------------------------------
+void I2C1_request(uint8_t address,
+                  const void* txData, uint16_t txSize,
+                  void* rxData, uint16_t rxSize,
+                  void (*handler)(void))
+{
+    I2C_SIM_bus[1].slaveAddress = address;
+    I2C_SIM_frame(1, address, (const uint8_t*)txData, txSize,
+                  (uint8_t*)rxData, rxSize);
+    I2C_SIM_complete(handler);
+}
+
+#endif // _MINGW_HAL_
+
+//******************************************************************************
+// End of file
+//******************************************************************************
@@ -0,0 +1,166 @@
+//******************************************************************************
+// Copyright (C) 2026 Bogdan Kokotenko
+//
+//! \addtogroup mingwhal
+//! @{
+//******************************************************************************
+//	File description:
+//! \file       hal\mcu\mingw\i2c.h
+//! \brief      MinGW simulated I2C bus API
+//!
+//! \details    Implements MSP430F5x I2C0/I2C1 master API shape on the host.
+//!             Slave devices are provided by pluggable device models
+//!             attached to the slave address.
+//!
+//!*****************************************************************************
+//! __Revisions:__
+//!  Date       | Author           | Comments
+//!  ---------- | ---------------- | --------------------------
+//!  18/10/2026 | Bogdan Kokotenko | Initial draft
+//
+//******************************************************************************
+#ifndef I2C_H
+#define I2C_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Include configurations
+#include "i2c_config.h"
+
+//! I2C0 simulated bus clock
+#ifndef I2C0_BAUDRATE
+#define I2C0_BAUDRATE           100000L     // Hz
+#endif
+
+//! I2C1 simulated bus clock
+#ifndef I2C1_BAUDRATE
+#define I2C1_BAUDRATE           100000L     // Hz
+#endif
+
+//! Maximal number of attached I2C device models
+#ifndef I2C_SIM_DEVICES
+#define I2C_SIM_DEVICES         4
+#endif
+
+//! I2C device model (plug-in) interface
+typedef struct _I2C_SIM_Model_t{
+    //! (Re)start condition with device address, returns ACK
+    bool    (*start)(void* device, uint8_t address, bool read);
+    //! Master writes byte, returns ACK
+    bool    (*write)(void* device, uint8_t dataByte);
+    //! Master reads byte, ack - master acknowledges (more bytes follow)
+    uint8_t (*read)(void* device, bool ack);
+    //! Stop condition
+    void    (*stop)(void* device);
+}I2C_SIM_Model_t;
+
+//! I2C bus statistics
+typedef struct _I2C_SIM_Stats_t{
+    uint32_t transactions;      //!< number of completed operations
+    uint32_t bytes;             //!< number of data bytes (w/o address)
+    uint32_t nacks;             //!< number of NACK errors
+    uint64_t busyNs;            //!< modelled bus busy time (nsec)
+}I2C_SIM_Stats_t;
+
+//------------------------- Simulation APIs ------------------------------------
+//! Attach device model to the slave address
+bool I2C_SIM_attach(uint8_t bus, uint8_t address, uint8_t mask,
+                    const I2C_SIM_Model_t* model, void* device);
+
+//! Detach all device models
+void I2C_SIM_detachAll(void);
+
+//! Change modelled bus clock
+void I2C_SIM_setBaudrate(uint8_t bus, uint32_t baudrate);
+
+//! Read bus statistics
+void I2C_SIM_getStats(uint8_t bus, I2C_SIM_Stats_t* stats);
+
+//! Clear bus statistics
+void I2C_SIM_resetStats(uint8_t bus);
+
+// -------------------- I2C0 APIs --------------------
+
+//! Initialize I2C0
+bool I2C0_init(void);
+
+//! Check I2C0 state
+bool I2C0_isBusy(void);
+
+//! Check I2C0 error
+bool I2C0_error(void);
+
+//! Set I2C0 own address
+void I2C0_setOwnAddress(uint8_t address);
+
+//! Select I2C0 slave address
+void I2C0_selectSlaveAddress(uint8_t address);
+
+//! Send data byte via I2C0
+void I2C0_txByte(uint8_t dataByte);
+
+//! Receive data byte via I2C0
+uint8_t I2C0_rxByte(void);
+
+//! Send data via I2C0
+void I2C0_transmit(uint8_t address,
+                   const void* data, uint16_t size, void (*handler)(void));
+
+//! Receive byte array via I2C0
+void I2C0_receive(uint8_t address,
+                  void* data, uint16_t size, void (*handler)(void));
+
+//! Transmit request and receive response via I2C0
+void I2C0_request(uint8_t address,
+                  const void* txData, uint16_t txSize,
+                  void* rxData, uint16_t rxSize,
+                  void (*handler)(void));
+
+// -------------------- I2C1 APIs --------------------
+
+//! Initialize I2C1
+bool I2C1_init(void);
+
+//! Check I2C1 state
+bool I2C1_isBusy(void);
+
+//! Check I2C1 error
+bool I2C1_error(void);
+
+//! Set I2C1 own address
+void I2C1_setOwnAddress(uint8_t address);
+
+//! Select I2C1 slave address
+void I2C1_selectSlaveAddress(uint8_t address);
+
+//! Send data byte via I2C1
+void I2C1_txByte(uint8_t dataByte);
+
+//! Receive data byte via I2C1
+uint8_t I2C1_rxByte(void);
+
+//! Send data via I2C1
+void I2C1_transmit(uint8_t address,
+                   const void* data, uint16_t size, void (*handler)(void));
+
+//! Receive byte array via I2C1
+void I2C1_receive(uint8_t address,
+                  void* data, uint16_t size, void (*handler)(void));
+
+//! Transmit request and receive response via I2C1
+void I2C1_request(uint8_t address,
+                  const void* txData, uint16_t txSize,
+                  void* rxData, uint16_t rxSize,
+                  void (*handler)(void));
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // I2C_H
+//! @}
+//******************************************************************************
+// End of file
+//******************************************************************************
@@ -0,0 +1,189 @@
+//******************************************************************************
+// Copyright (C) 2026 Bogdan Kokotenko
+//
+//  File description:
+//! \file       hal\mcu\mingw\regmap.c
+//! \brief      Register-map sensor device model for simulated SPI/I2C buses
+//!
+//!*****************************************************************************
+//! __Revisions:__
+//!  Date       | Author           | Comments
+//!  ---------- | ---------------- | -------------------------------------
+//!  18/10/2026 | Bogdan Kokotenko | Initial draft
+//
+//******************************************************************************
+#include "project.h"
+#include "types.h"
+#include "hal.h"
+#include "regmap.h"
+
+// Warn of inappropriate MCU core selection
+#if ( !defined (_MINGW_HAL_) )
+#warning REGMAP: Unknown MCU core, check HAL configuration!
+#else
+
+//------------------------------------------------------------------------------
+// Function:
+//              REGMAP_writeReg()
+// Description:
+//! \brief      Write register (writable bits only) and advance pointer
+//------------------------------------------------------------------------------
+static void REGMAP_writeReg(REGMAP_t* regmap, uint8_t value)
+{
+    uint8_t reg = regmap->pointer;
+    uint8_t mask = regmap->writeMask ? regmap->writeMask[reg] : 0xFF;
+
+    regmap->regs[reg] = (regmap->regs[reg] & ~mask) | (value & mask);
+    regmap->pointer = (reg + 1) % regmap->size;
+
+    if(regmap->onWrite)
+        regmap->onWrite(regmap, reg, value);
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              REGMAP_readReg()
+// Description:
+//! \brief      Read register and advance pointer
+//------------------------------------------------------------------------------
+static uint8_t REGMAP_readReg(REGMAP_t* regmap)
+{
+    uint8_t value = regmap->regs[regmap->pointer];
+
+    regmap->pointer = (regmap->pointer + 1) % regmap->size;
+
+    return value;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              REGMAP_i2cStart()
+// Description:
+//! \brief      I2C (re)start condition
+//------------------------------------------------------------------------------
+static bool REGMAP_i2cStart(void* device, uint8_t address, bool read)
+{
+    (void)address;
+
+    // Write frame always begins with register pointer
+    if(!read)
+        ((REGMAP_t*)device)->addressed = false;
+
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              REGMAP_i2cWrite()
+// Description:
+//! \brief      I2C register pointer or data byte
+//------------------------------------------------------------------------------
+static bool REGMAP_i2cWrite(void* device, uint8_t dataByte)
+{
+    REGMAP_t* regmap = (REGMAP_t*)device;
+
+    if(!regmap->addressed)
+    {
+        // NACK of non-existent register
+        if(dataByte >= regmap->size)
+            return false;
+
+        regmap->pointer = dataByte;
+        regmap->addressed = true;
+        return true;
+    }
+
+    REGMAP_writeReg(regmap, dataByte);
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              REGMAP_i2cRead()
+// Description:
+//! \brief      I2C data byte read
+//------------------------------------------------------------------------------
+static uint8_t REGMAP_i2cRead(void* device, bool ack)
+{
+    (void)ack;
+    return REGMAP_readReg((REGMAP_t*)device);
+}
+
+//! Register-map I2C device model interface
+const I2C_SIM_Model_t REGMAP_i2cModel = {
+    REGMAP_i2cStart,
+    REGMAP_i2cWrite,
+    REGMAP_i2cRead,
+    NULL
+};
+
+//------------------------------------------------------------------------------
+// Function:
+//              REGMAP_spiSelect()
+// Description:
+//! \brief      SPI chip select asserted
+//------------------------------------------------------------------------------
+static void REGMAP_spiSelect(void* device)
+{
+    ((REGMAP_t*)device)->addressed = false;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              REGMAP_spiExchange()
+// Description:
+//! \brief      SPI byte exchange
+//------------------------------------------------------------------------------
+static uint8_t REGMAP_spiExchange(void* device, uint8_t mosi)
+{
+    REGMAP_t* regmap = (REGMAP_t*)device;
+
+    // Address byte
+    if(!regmap->addressed)
+    {
+        regmap->read = (mosi & REGMAP_SPI_READ) != 0;
+        regmap->pointer = (mosi & ~REGMAP_SPI_READ) % regmap->size;
+        regmap->addressed = true;
+        return 0x00;
+    }
+
+    if(regmap->read)
+        return REGMAP_readReg(regmap);
+
+    REGMAP_writeReg(regmap, mosi);
+    return 0x00;
+}
+
+//! Register-map SPI device model interface
+const SPI_SIM_Model_t REGMAP_spiModel = {
+    REGMAP_spiSelect,
+    REGMAP_spiExchange,
+    NULL
+};
+
+//------------------------------------------------------------------------------
+// Function:
+//              REGMAP_init()
+// Description:
+//! \brief      Initialize register-map device model
+//!
+//! \param regmap    device model instance
+//! \param regs      register file (reset values)
+//! \param size      number of registers
+//! \param writeMask writable bits per register, NULL - all bits writable
+//------------------------------------------------------------------------------
+void REGMAP_init(REGMAP_t* regmap, uint8_t* regs, uint8_t size,
+                 const uint8_t* writeMask)
+{
+    memset(regmap, 0x00, sizeof(REGMAP_t));
+
+    regmap->regs = regs;
+    regmap->size = size;
+    regmap->writeMask = writeMask;
+}
+
+#endif // _MINGW_HAL_
+
+//******************************************************************************
+// End of file
+//******************************************************************************
@@ -0,0 +1,68 @@
+//******************************************************************************
+// Copyright (C) 2026 Bogdan Kokotenko
+//
+//! \addtogroup mingwhal
+//! @{
+//******************************************************************************
+//	File description:
+//! \file       hal\mcu\mingw\regmap.h
+//! \brief      Register-map sensor device model for simulated SPI/I2C buses
+//!
+//! \details    Generic model of a sensor with 8-bit register file and
+//!             auto-incremented register pointer.
+//!             I2C: first written byte selects the register, following
+//!             bytes are written, reads start from the selected register.
+//!             SPI: first byte is REGMAP_SPI_READ | register, following
+//!             bytes are read or written.
+//!
+//!*****************************************************************************
+//! __Revisions:__
+//!  Date       | Author           | Comments
+//!  ---------- | ---------------- | --------------------------
+//!  18/10/2026 | Bogdan Kokotenko | Initial draft
+//
+//******************************************************************************
+#ifndef REGMAP_H
+#define REGMAP_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "i2c.h"
+#include "spi.h"
+
+//! SPI read flag of the register address byte
+#define REGMAP_SPI_READ         0x80
+
+//! Register-map device model instance
+typedef struct _REGMAP_t{
+    uint8_t*        regs;       //!< register file
+    uint8_t         size;       //!< number of registers
+    const uint8_t*  writeMask;  //!< writable bits per register, NULL - all
+    uint8_t         pointer;    //!< register pointer
+    bool            addressed;  //!< register pointer received
+    bool            read;       //!< SPI read access
+    //! Register write hook (model behaviour), could be NULL
+    void (*onWrite)(struct _REGMAP_t* regmap, uint8_t reg, uint8_t value);
+}REGMAP_t;
+
+//! Register-map I2C device model interface
+extern const I2C_SIM_Model_t REGMAP_i2cModel;
+
+//! Register-map SPI device model interface
+extern const SPI_SIM_Model_t REGMAP_spiModel;
+
+//! Initialize register-map device model
+void REGMAP_init(REGMAP_t* regmap, uint8_t* regs, uint8_t size,
+                 const uint8_t* writeMask);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // REGMAP_H
+//! @}
+//******************************************************************************
+// End of file
+//******************************************************************************
@@ -0,0 +1,524 @@
+//******************************************************************************
+// Copyright (C) 2026 Bogdan Kokotenko
+//
+//  File description:
+//! \file       hal\mcu\mingw\spi.c
+//! \brief      MinGW simulated SPI bus
+//!
+//! \details    Every transfer is shifted byte by byte through the selected
+//!             device model. Bus time is modelled from the configured clock
+//!             (8 bit times per byte) and accumulated in bus statistics.
+//!             With SPI_SIM_REALTIME defined the caller is also delayed
+//!             for the modelled time, so transaction rates match the target.
+//!
+//!*****************************************************************************
+//! __Revisions:__
+//!  Date       | Author           | Comments
+//!  ---------- | ---------------- | -------------------------------------
+//!  18/10/2026 | Bogdan Kokotenko | Initial draft
+//
+//******************************************************************************
+#include "project.h"
+#include "types.h"
+#include "hal.h"
+#include "clocks.h"
+#include "spi.h"
+
+// Warn of inappropriate MCU core selection
+#if ( !defined (_MINGW_HAL_) )
+#warning SPI: Unknown MCU core, check HAL configuration!
+#else
+
+//! Number of simulated SPI buses
+#define SPI_SIM_BUSES       2
+
+//! Idle MISO line level (pulled up)
+#define SPI_SIM_IDLE_MISO   0xFF
+
+//! Attached device model slot
+static struct SPI_SIM_Slot_t{
+    const SPI_SIM_Model_t* model;       //!< device model
+    void*   device;                     //!< device model instance
+    uint8_t bus;                        //!< bus index
+    uint8_t port;                       //!< chip select port
+    uint8_t pin;                        //!< chip select pin
+    bool    selected;                   //!< chip select state
+}SPI_SIM_slot[SPI_SIM_DEVICES];         //!< Attached device models
+
+//! Simulated bus context
+static struct SPI_SIM_Bus_t{
+    uint32_t        byteTimeNs;         //!< modelled time of one byte
+    SPI_SIM_Stats_t stats;              //!< bus statistics
+}SPI_SIM_bus[SPI_SIM_BUSES];            //!< Simulated buses
+
+//------------------------------------------------------------------------------
+// Function:
+//              SPI_SIM_attach()
+// Description:
+//! \brief      Attach device model to the bus chip select
+//!
+//! \param bus      bus index (0 - SPI0, 1 - SPI1)
+//! \param port     chip select port
+//! \param pin      chip select pin
+//! \param model    device model interface
+//! \param device   device model instance
+//! \return         true - in case of success, false - otherwise
+//------------------------------------------------------------------------------
+bool SPI_SIM_attach(uint8_t bus, uint8_t port, uint8_t pin,
+                    const SPI_SIM_Model_t* model, void* device)
+{
+    uint8_t index;
+
+    if(bus >= SPI_SIM_BUSES)
+        return false;
+
+    for(index = 0; index < SPI_SIM_DEVICES; index++)
+    {
+        if(SPI_SIM_slot[index].model == NULL)
+        {
+            SPI_SIM_slot[index].model = model;
+            SPI_SIM_slot[index].device = device;
+            SPI_SIM_slot[index].bus = bus;
+            SPI_SIM_slot[index].port = port;
+            SPI_SIM_slot[index].pin = pin;
+            SPI_SIM_slot[index].selected = false;
+            return true;
+        }
+    }
+
+    // No empty slots
+    return false;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              SPI_SIM_detachAll()
+// Description:
+//! \brief      Detach all device models
+//------------------------------------------------------------------------------
+void SPI_SIM_detachAll(void)
+{
+    memset(SPI_SIM_slot, 0x00, sizeof(SPI_SIM_slot));
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              SPI_SIM_select()
+// Description:
+//! \brief      Assert chip select
+//------------------------------------------------------------------------------
+void SPI_SIM_select(uint8_t port, uint8_t pin)
+{
+    uint8_t index;
+
+    for(index = 0; index < SPI_SIM_DEVICES; index++)
+    {
+        struct SPI_SIM_Slot_t* slot = &SPI_SIM_slot[index];
+
+        if(slot->model && slot->port == port && slot->pin == pin &&
+           !slot->selected)
+        {
+            slot->selected = true;
+            if(slot->model->select)
+                slot->model->select(slot->device);
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              SPI_SIM_release()
+// Description:
+//! \brief      Release chip select
+//------------------------------------------------------------------------------
+void SPI_SIM_release(uint8_t port, uint8_t pin)
+{
+    uint8_t index;
+
+    for(index = 0; index < SPI_SIM_DEVICES; index++)
+    {
+        struct SPI_SIM_Slot_t* slot = &SPI_SIM_slot[index];
+
+        if(slot->model && slot->port == port && slot->pin == pin &&
+           slot->selected)
+        {
+            slot->selected = false;
+            if(slot->model->release)
+                slot->model->release(slot->device);
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              SPI_SIM_setBaudrate()
+// Description:
+//! \brief      Change modelled bus clock
+//------------------------------------------------------------------------------
+void SPI_SIM_setBaudrate(uint8_t bus, uint32_t baudrate)
+{
+    if(bus < SPI_SIM_BUSES && baudrate)
+        SPI_SIM_bus[bus].byteTimeNs = (uint32_t)(8*1000000000ULL/baudrate);
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              SPI_SIM_getStats()
+// Description:
+//! \brief      Read bus statistics
+//------------------------------------------------------------------------------
+void SPI_SIM_getStats(uint8_t bus, SPI_SIM_Stats_t* stats)
+{
+    if(bus < SPI_SIM_BUSES)
+        *stats = SPI_SIM_bus[bus].stats;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              SPI_SIM_resetStats()
+// Description:
+//! \brief      Clear bus statistics
+//------------------------------------------------------------------------------
+void SPI_SIM_resetStats(uint8_t bus)
+{
+    if(bus < SPI_SIM_BUSES)
+        memset(&SPI_SIM_bus[bus].stats, 0x00, sizeof(SPI_SIM_Stats_t));
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              SPI_SIM_shift()
+// Description:
+//! \brief      Shift byte array through the selected device model
+//!
+//! \param bus      bus index
+//! \param rx       received data (may be NULL)
+//! \param tx       transmitted data (NULL - dummy 0x00 is sent)
+//! \param size     number of bytes
+//------------------------------------------------------------------------------
+static void SPI_SIM_shift(uint8_t bus, uint8_t* rx, const uint8_t* tx,
+                          uint16_t size)
+{
+    struct SPI_SIM_Slot_t* slot = NULL;
+    uint16_t index;
+
+    // Find selected device on this bus
+    for(index = 0; index < SPI_SIM_DEVICES; index++)
+    {
+        if(SPI_SIM_slot[index].model && SPI_SIM_slot[index].selected &&
+           SPI_SIM_slot[index].bus == bus)
+        {
+            slot = &SPI_SIM_slot[index];
+            break;
+        }
+    }
+
+    for(index = 0; index < size; index++)
+    {
+        uint8_t mosi = tx ? tx[index] : 0x00;
+        uint8_t miso = SPI_SIM_IDLE_MISO;
+
+        if(slot && slot->model->exchange)
+            miso = slot->model->exchange(slot->device, mosi);
+
+        if(rx)
+            rx[index] = miso;
+    }
+
+    // Account modelled bus time
+    uint64_t busyNs = (uint64_t)SPI_SIM_bus[bus].byteTimeNs*size;
+    SPI_SIM_bus[bus].stats.transactions++;
+    SPI_SIM_bus[bus].stats.bytes += size;
+    SPI_SIM_bus[bus].stats.busyNs += busyNs;
+
+    #ifdef SPI_SIM_REALTIME
+        CLK_delayNs(busyNs);
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              SPI_SIM_complete()
+// Description:
+//! \brief      Simulate transfer complete interrupt
+//------------------------------------------------------------------------------
+static void SPI_SIM_complete(void (*handler)(void))
+{
+    if(handler)
+    {
+        #ifdef SPI_handlerCaller
+            SPI_handlerCaller(handler);
+        #else
+            handler();
+        #endif
+    }
+
+    #ifdef USE_LOW_POWER_MODE
+        LPM_disable();                  // Wake-up MCU
+    #endif
+}
+
+//----------------------------- SPI0 APIs --------------------------------------
+
+//------------------------------------------------------------------------------
+// Function:
+//              SPI0_init()
+// Description:
+//! \brief      Initialize SPI0
+//------------------------------------------------------------------------------
+void SPI0_init(void)
+{
+    SPI_SIM_setBaudrate(0, SPI0_BAUDRATE);
+    SPI_SIM_resetStats(0);
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              SPI0_waitMISO()
+// Description:
+//! \brief      Wait till MISO pin goes down
+//------------------------------------------------------------------------------
+bool SPI0_waitMISO(void)
+{
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              SPI0_isBusy()
+// Description:
+//! \brief      Check if SPI0 is ready for data exchange
+//! \note       Simulated transfers complete before API returns
+//------------------------------------------------------------------------------
+bool SPI0_isBusy(void)
+{
+    return false;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              SPI0_reset()
+// Description:
+//! \brief      Reset SPI0 transmission
+//------------------------------------------------------------------------------
+void SPI0_reset(void)
+{
+
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              SPI0_txByte()
+// Description:
+//! \brief      Transmit byte via SPI0
+//------------------------------------------------------------------------------
+void SPI0_txByte(uint8_t dataByte)
+{
+    SPI_SIM_shift(0, NULL, &dataByte, 1);
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              SPI0_rxByte()
+// Description:
+//! \brief      Receive byte via SPI0
+//------------------------------------------------------------------------------
+uint8_t SPI0_rxByte(void)
+{
+    uint8_t dataByte;
+
+    SPI_SIM_shift(0, &dataByte, NULL, 1);
+    return dataByte;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              SPI0_exchByte()
+// Description:
+//! \brief      Exchange data via SPI0
+//------------------------------------------------------------------------------
+uint8_t SPI0_exchByte(uint8_t txByte)
+{
+    uint8_t rxByte;
+
+    SPI_SIM_shift(0, &rxByte, &txByte, 1);
+    return rxByte;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              SPI0_exchange()
+// Description:
+//! \brief      Transmit/Receive packet (same size) via SPI0
+//------------------------------------------------------------------------------
+void SPI0_exchange(void* rxPacket, const void* txPacket,
+                    uint16_t size,  void (*handler)(void))
+{
+    SPI_SIM_shift(0, (uint8_t*)rxPacket, (const uint8_t*)txPacket, size);
+    SPI_SIM_complete(handler);
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              SPI0_transmit()
+// Description:
+//! \brief      Transmit byte array via SPI0
+//------------------------------------------------------------------------------
+#ifdef SPI0_ASYNCHRONOUS
+void SPI0_transmit(const void* data, uint16_t size, void (*handler)(void))
+{
+    SPI_SIM_shift(0, NULL, (const uint8_t*)data, size);
+    SPI_SIM_complete(handler);
+}
+#else
+void SPI0_transmit(const void* data, uint16_t size)
+{
+    SPI_SIM_shift(0, NULL, (const uint8_t*)data, size);
+}
+#endif // SPI0_ASYNCHRONOUS
+
+//------------------------------------------------------------------------------
+// Function:
+//              SPI0_receive()
+// Description:
+//! \brief      Receive byte array via SPI0
+//------------------------------------------------------------------------------
+#ifdef SPI0_ASYNCHRONOUS
+void SPI0_receive(void* data, uint16_t size, void (*handler)(void))
+{
+    SPI_SIM_shift(0, (uint8_t*)data, NULL, size);
+    SPI_SIM_complete(handler);
+}
+#else
+void SPI0_receive(void* data, uint16_t size)
+{
+    SPI_SIM_shift(0, (uint8_t*)data, NULL, size);
+}
+#endif // SPI0_ASYNCHRONOUS
+
+//----------------------------- SPI1 APIs --------------------------------------
+
+//------------------------------------------------------------------------------
+// Function:
+//              SPI1_init()
+// Description:
+//! \brief      Initialize SPI1
+//------------------------------------------------------------------------------
+void SPI1_init(void)
+{
+    SPI_SIM_setBaudrate(1, SPI1_BAUDRATE);
+    SPI_SIM_resetStats(1);
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              SPI1_waitMISO()
+// Description:
+//! \brief      Wait till MISO pin goes down
+//------------------------------------------------------------------------------
+bool SPI1_waitMISO(void)
+{
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              SPI1_isBusy()
+// Description:
+//! \brief      Check if SPI1 is ready for data exchange
+//------------------------------------------------------------------------------
+bool SPI1_isBusy(void)
+{
+    return false;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              SPI1_reset()
+// Description:
+//! \brief      Reset SPI1 transmission
+//------------------------------------------------------------------------------
+void SPI1_reset(void)
+{
+
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              SPI1_txByte()
+// Description:
+//! \brief      Transmit byte via SPI1
+//------------------------------------------------------------------------------
+void SPI1_txByte(uint8_t dataByte)
+{
+    SPI_SIM_shift(1, NULL, &dataByte, 1);
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              SPI1_rxByte()
+// Description:
+//! \brief      Receive byte via SPI1
+//------------------------------------------------------------------------------
+uint8_t SPI1_rxByte(void)
+{
+    uint8_t dataByte;
+
+    SPI_SIM_shift(1, &dataByte, NULL, 1);
+    return dataByte;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              SPI1_exchByte()
+// Description:
+//! \brief      Exchange data via SPI1
+//------------------------------------------------------------------------------
+uint8_t SPI1_exchByte(uint8_t txByte)
+{
+    uint8_t rxByte;
+
+    SPI_SIM_shift(1, &rxByte, &txByte, 1);
+    return rxByte;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              SPI1_transmit()
+// Description:
+//! \brief      Transmit byte array via SPI1
+//------------------------------------------------------------------------------
+void SPI1_transmit(const void* data, uint16_t size)
+{
+    SPI_SIM_shift(1, NULL, (const uint8_t*)data, size);
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              SPI1_receive()
+// Description:
+//! \brief      Receive byte array via SPI1
+//------------------------------------------------------------------------------
+void SPI1_receive(void* data, uint16_t size)
+{
+    SPI_SIM_shift(1, (uint8_t*)data, NULL, size);
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              SPI1_exchange()
+// Description:
+//! \brief      Transmit/Receive packet (same size) via SPI1
+//------------------------------------------------------------------------------
+void SPI1_exchange(void* rxPacket, const void* txPacket,
+                   uint16_t size, void (*handler)(void))
+{
+    SPI_SIM_shift(1, (uint8_t*)rxPacket, (const uint8_t*)txPacket, size);
+    SPI_SIM_complete(handler);
+}
+
+#endif // _MINGW_HAL_
+
+//******************************************************************************
+// End of file
+//******************************************************************************
@@ -0,0 +1,178 @@
+//******************************************************************************
+// Copyright (C) 2026 Bogdan Kokotenko
+//
+//! \addtogroup mingwhal
+//! @{
+//******************************************************************************
+//	File description:
+//! \file       hal\mcu\mingw\spi.h
+//! \brief      MinGW simulated SPI bus API
+//!
+//! \details    Implements MSP430F5x SPI0/SPI1 API shape on the host.
+//!             Slave devices are provided by pluggable device models
+//!             attached to the chip select (port, pin).
+//!
+//!*****************************************************************************
+//! __Revisions:__
+//!  Date       | Author           | Comments
+//!  ---------- | ---------------- | --------------------------
+//!  18/10/2026 | Bogdan Kokotenko | Initial draft
+//
+//******************************************************************************
+#ifndef SPI_H
+#define SPI_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Include configurations
+#include "spi_config.h"
+
+//! SPI0 simulated bus clock
+#ifndef SPI0_BAUDRATE
+#define SPI0_BAUDRATE           1000000L    // Hz
+#endif
+
+//! SPI1 simulated bus clock
+#ifndef SPI1_BAUDRATE
+#define SPI1_BAUDRATE           1000000L    // Hz
+#endif
+
+//! Maximal number of attached SPI device models
+#ifndef SPI_SIM_DEVICES
+#define SPI_SIM_DEVICES         4
+#endif
+
+//! SPI chip select initialization
+#define SPI_chipInit(port, pin)
+
+//!  Slave chip select for SPI
+#define SPI_chipSelect(port, pin)      SPI_SIM_select(port, pin)
+
+//!  Slave chip release for SPI
+#define SPI_chipRelease(port, pin)     SPI_SIM_release(port, pin)
+
+//! SPI device model (plug-in) interface
+typedef struct _SPI_SIM_Model_t{
+    //! Chip select asserted
+    void    (*select)(void* device);
+    //! Shift one byte out and in (full-duplex)
+    uint8_t (*exchange)(void* device, uint8_t mosi);
+    //! Chip select released
+    void    (*release)(void* device);
+}SPI_SIM_Model_t;
+
+//! SPI bus statistics
+typedef struct _SPI_SIM_Stats_t{
+    uint32_t transactions;      //!< number of completed operations
+    uint32_t bytes;             //!< number of shifted bytes
+    uint64_t busyNs;            //!< modelled bus busy time (nsec)
+}SPI_SIM_Stats_t;
+
+//------------------------- Simulation APIs ------------------------------------
+//! Attach device model to the bus chip select
+bool SPI_SIM_attach(uint8_t bus, uint8_t port, uint8_t pin,
+                    const SPI_SIM_Model_t* model, void* device);
+
+//! Detach all device models
+void SPI_SIM_detachAll(void);
+
+//! Assert chip select
+void SPI_SIM_select(uint8_t port, uint8_t pin);
+
+//! Release chip select
+void SPI_SIM_release(uint8_t port, uint8_t pin);
+
+//! Change modelled bus clock
+void SPI_SIM_setBaudrate(uint8_t bus, uint32_t baudrate);
+
+//! Read bus statistics
+void SPI_SIM_getStats(uint8_t bus, SPI_SIM_Stats_t* stats);
+
+//! Clear bus statistics
+void SPI_SIM_resetStats(uint8_t bus);
+
+//----------------------------- SPI0 APIs --------------------------------------
+//! \brief Initialize SPI0
+void SPI0_init(void);
+
+//! \brief Wait till MISO pin goes down
+//! \return     false if timeout
+bool SPI0_waitMISO(void);
+
+//! \brief Check if SPI0 is ready for data exchange
+//! \return     state (true/false)
+bool SPI0_isBusy(void);
+
+//! \brief Reset transmission via SPI0
+void SPI0_reset(void);
+
+//! \brief Transmit byte via SPI0
+void SPI0_txByte(uint8_t dataByte);
+
+//! \brief Receive byte via SPI0
+uint8_t SPI0_rxByte(void);
+
+//! \brief Exchange data via SPI0
+uint8_t SPI0_exchByte(uint8_t txByte);
+
+//! \brief Transmit byte array via SPI0
+#ifdef SPI0_ASYNCHRONOUS
+void SPI0_transmit(const void* data, uint16_t size, void (*handler)(void));
+#else
+void SPI0_transmit(const void* data, uint16_t size);
+#endif
+
+//! \brief Receive byte array via SPI0
+#ifdef SPI0_ASYNCHRONOUS
+void SPI0_receive(void* data, uint16_t size, void (*handler)(void));
+#else
+void SPI0_receive(void* data, uint16_t size);
+#endif
+
+//! Transmit/Receive packet (same size) via SPI0
+void SPI0_exchange(void* rxPacket, const void* txPacket,
+                  uint16_t size, void (*handler)(void));
+
+//----------------------------- SPI1 APIs --------------------------------------
+//! Initialize SPI1
+void SPI1_init(void);
+
+//! \brief Wait till MISO pin goes down
+bool SPI1_waitMISO(void);
+
+//! Check if SPI1 is ready for data exchange
+bool SPI1_isBusy(void);
+
+//! \brief Reset transmission via SPI1
+void SPI1_reset(void);
+
+//! \brief Transmit byte via SPI1
+void SPI1_txByte(uint8_t dataByte);
+
+//! \brief Receive byte via SPI1
+uint8_t SPI1_rxByte(void);
+
+//! \brief Exchange data via SPI1
+uint8_t SPI1_exchByte(uint8_t txByte);
+
+//! \brief Transmit byte array via SPI1
+void SPI1_transmit(const void* data, uint16_t size);
+
+//! \brief Receive byte array via SPI1
+void SPI1_receive(void* data, uint16_t size);
+
+//! \brief Transmit/Receive packet (same size) via SPI1
+void SPI1_exchange(void* rxPacket, const void* txPacket,
+                  uint16_t size, void (*handler)(void));
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SPI_H
+//! @}
+//******************************************************************************
+// End of file
+//******************************************************************************
@@ -32,6 +32,8 @@ void (*timer_func_handler_pntr)(void);
 
 #ifdef __linux__
 
+#include <stdio.h>
+#include <stddef.h>
 #include <sys/time.h>
 #include <signal.h>
 
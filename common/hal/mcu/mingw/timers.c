@@ -11,6 +11,7 @@
 //!  ---------- | ---------------- | --------------------------------------
 //!  23/07/2016 | Bogdan Kokotenko | Initial draft
 //!  24/07/2016 | Bogdan Kokotenko | Added simulation of SysTick and WDT
+//!  18/10/2026 | Bogdan Kokotenko | Added CPU load meter hooks to SysTick
 //
 //******************************************************************************
 #include "project.h"
@@ -20,6 +21,7 @@
 #include "devtime.h"
 #include "thread.h"
 #include "timers.h"
+#include "load.h"
 
 #include "timer.h"
 
@@ -120,7 +122,9 @@ void WDT_init(void)
 void SysTick_thread(void)
 {
     EnterCriticalSection();
+    LOAD_enterIsr();
     SysTick_Handler();
+    LOAD_leaveIsr();
     LeaveCriticalSection();
 }
 
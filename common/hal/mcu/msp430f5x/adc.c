@@ -19,6 +19,7 @@
 //!  02/02/2015 | Bogdan Kokotenko | Initial draft
 //!  15/04/2015 | Bogdan Kokotenko | Improved clock selection
 //!  03/05/2015 | Bogdan Kokotenko | Added Vref selection
+//!  18/10/2026 | Bogdan Kokotenko | Added ADC_USE_DMA (block mode)
 //!
 //******************************************************************************
 #include "project.h"
@@ -390,6 +391,9 @@ void ADC_init(void)
     ADC12IFG    &= ~ADC12IFG15;                 // clear ADC_ch15 IFG
 #endif
     
+#ifdef ADC_USE_DMA
+    ADC12IE     = 0;                            // results are taken by DMA
+#endif
     ADC12CTL0 |= ADC12OVIE + ADC12TOVIE;      //ADC overflow interrupts
     
     ADC12CTL0   |= ADC12ENC;                    // Enable conversions
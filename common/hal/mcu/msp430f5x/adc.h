@@ -10,6 +10,11 @@
 //	File description:
 //! \file   hal/mcu/msp430f5x/adc.h
 //! \brief  MSP430F5x ADC APIs			
+//!
+//! \details ADC_Handler(result, overflow) is called per conversion (end of
+//!          sequence). With ADC_USE_DMA defined in adc_config.h conversion
+//!          interrupts are disabled: results are collected by
+//!          DMA0_ADC_transfer() and processed per block (see lib/decimate.h).
 //!      			
 //!*****************************************************************************
 //! __Revisions:__										
@@ -18,6 +23,7 @@
 //!  02/02/2015 | Bogdan Kokotenko | Initial draft
 //!  15/04/2015 | Bogdan Kokotenko | Improved clock selection
 //!  03/05/2015 | Bogdan Kokotenko | Added Vref selection
+//!  18/10/2026 | Bogdan Kokotenko | Added ADC_USE_DMA (block mode)
 //!
 //******************************************************************************
 #ifndef ADC_H
@@ -15,6 +15,9 @@
 //!  25/04/2015 | Bogdan Kokotenko | Fixed issue with DMA USCIA0
 //!  29/06/2015 | Bogdan Kokotenko | Fixed LPM with DMA
 //!  28/12/2015 | Bogdan Kokotenko | Fixed DMA settings options
+//!  18/10/2026 | Bogdan Kokotenko | ADC results are transferred by words
+//!  18/10/2026 | Bogdan Kokotenko | DMA0/DMA1 ping-pong USCI stream
+//!  18/10/2026 | Bogdan Kokotenko | USCI transfers without data/buffer (SPI)
 //!
 //******************************************************************************
 #include "project.h"
@@ -33,6 +36,7 @@
 typedef struct _DMA_Settings{
     uint8_t trigger;
     uint8_t *ptr;
+    uint8_t *ifg;           //!< USCI interrupt flags (RXIFG/TXIFG)
 }DMA_Settings;
 
 //! DMA0 TX transfer settings
@@ -40,18 +44,22 @@ static const DMA_Settings DMA_txSettings[] = {
     [DMA_USCIA0TX] = {
         .trigger = DMA0TSEL__USCIA0TX,
         .ptr =  (uint8_t*)&UCA0TXBUF,
+        .ifg =  (uint8_t*)&UCA0IFG,
     },
     [DMA_USCIB0TX] = {
         .trigger = DMA0TSEL__USCIB0TX,
         .ptr =  (uint8_t*)&UCB0TXBUF,
+        .ifg =  (uint8_t*)&UCB0IFG,
     },
     [DMA_USCIA1TX] = {
         .trigger = DMA0TSEL__USCIA1TX,
         .ptr =  (uint8_t*)&UCA1TXBUF,
+        .ifg =  (uint8_t*)&UCA1IFG,
     },
     [DMA_USCIB1TX] = {
         .trigger = DMA0TSEL__USCIB1TX,
         .ptr =  (uint8_t*)&UCB1TXBUF,
+        .ifg =  (uint8_t*)&UCB1IFG,
     }
 };
 
@@ -60,18 +68,22 @@ static const DMA_Settings DMA_rxSettings[] = {
     [DMA_USCIA0RX] = {
         .trigger = DMA0TSEL__USCIA0RX,
         .ptr =  (uint8_t*)&UCA0RXBUF,
+        .ifg =  (uint8_t*)&UCA0IFG,
     },
     [DMA_USCIB0RX] = {
         .trigger = DMA0TSEL__USCIB0RX,
         .ptr =  (uint8_t*)&UCB0RXBUF,
+        .ifg =  (uint8_t*)&UCB0IFG,
     },
     [DMA_USCIA1RX] = {
         .trigger = DMA0TSEL__USCIA1RX,
         .ptr =  (uint8_t*)&UCA1RXBUF,
+        .ifg =  (uint8_t*)&UCA1IFG,
     },
     [DMA_USCIB1RX] = {
         .trigger = DMA0TSEL__USCIB1RX,
         .ptr =  (uint8_t*)&UCB1RXBUF,
+        .ifg =  (uint8_t*)&UCB1IFG,
     }
 };
 
@@ -93,9 +105,32 @@ static const DMA_Settings DMA_rxSettings[] = {
 // DMA2 RX transfer settings
 #define DMA2_RX_TRIGGER(Src)    DMA_rxSettings[Src].trigger
 
+//! Write 20-bit address register (DMAxSA/DMAxDA)
+#ifndef DMA_writeAddress
+#define DMA_writeAddress(Reg, Address)                                         \
+    __data16_write_addr((uint16_t)&(Reg), (uint32_t)(Address))
+#endif
+
 // DMA channel handlers
 HANDLE DMA_handler[DMA_CHANNEL_NUM];
 
+//! Dummy byte transmitted to USCI without data (SPI receive)
+static const uint8_t DMA_dummyTx = 0x00;
+
+//! Received byte without buffer (SPI transmit)
+static uint8_t DMA_discard;
+
+//! DMA0/DMA1 ping-pong stream state
+static struct DMA_Stream_t{
+    uint8_t*            buffer;     //!< two blocks of size bytes
+    const volatile uint8_t* ifg;    //!< USCI interrupt flags
+    HANDLE              handler;    //!< block complete handler
+    uint16_t            size;       //!< block size
+    volatile uint16_t   overruns;   //!< blocks overwritten before release
+    volatile uint8_t    active;     //!< channel (block) receiving now
+    volatile uint8_t    ready;      //!< filled block + 1, 0 - none
+}DMA_stream;
+
 //------------------------------------------------------------------------------
 // Function:	
 //				DMA0_reset()
@@ -121,6 +156,17 @@ bool DMA0_isSizeChanged(uint16_t initial)
     return (DMA0SZ != initial);
 }
 
+//------------------------------------------------------------------------------
+// Function:	
+//				DMA0_getSize()
+// Description:
+//! \brief      Number of DMA0 transfers left
+//------------------------------------------------------------------------------
+uint16_t DMA0_getSize(void)
+{
+    return DMA0SZ;
+}
+
 //------------------------------------------------------------------------------
 // Function:	
 //              DMA0_memcpy()
@@ -129,14 +175,13 @@ bool DMA0_isSizeChanged(uint16_t initial)
 //------------------------------------------------------------------------------
 bool DMA0_memcpy(void* dst, const void* src, uint16_t size)
 {
-    IntFlag_t   intState;   // save interrupt flag while critical section
 
     // check DMA0 state
     if(DMA0CTL&DMAEN)
         return false;
  
     // avoid any interrupts while DMA0 settings is changed
-    EnterCriticalSection(intState);
+    EnterCriticalSection();
     
     // set DMA priorities
     DMACTL4 |= ROUNDROBIN;
@@ -146,9 +191,9 @@ bool DMA0_memcpy(void* dst, const void* src, uint16_t size)
     DMACTL0 |= DMA0TSEL__DMA_REQ;           // software trigger
 
     // set DMA0 source address
-    __data16_write_addr((uint16_t) &DMA0SA, (uint32_t) src);
+    DMA_writeAddress(DMA0SA, src);
     // set DMA0 destination address
-    __data16_write_addr((uint16_t) &DMA0DA, (uint32_t) dst);
+    DMA_writeAddress(DMA0DA, dst);
     // set data block size
     DMA0SZ = size;
     
@@ -159,7 +204,7 @@ bool DMA0_memcpy(void* dst, const void* src, uint16_t size)
     // enable DMA0
     DMA0CTL |= DMAEN;
     
-    LeaveCriticalSection(intState);         // leave critical section
+    LeaveCriticalSection();                 // leave critical section
     
     // trigger transfare
     DMA0CTL |= DMAREQ;
@@ -172,18 +217,20 @@ bool DMA0_memcpy(void* dst, const void* src, uint16_t size)
 //              DMA0_ADC_transfer()
 // Description:
 //! \brief      Transfer ADC result to the buffer by DMA0
+//! \details    size - number of 16-bit results, handler is called from
+//!             DMA ISR when the block is complete (DMA0 is stopped, so the
+//!             next block could be started from the handler).
 //------------------------------------------------------------------------------
 bool DMA0_ADC_transfer(void* dst, const void* adcReg, uint16_t size,
                        HANDLE handler)
 {
-    IntFlag_t   intState;   // save interrupt flag while critical section
  
     // check DMA0 state
     if(DMA0CTL&DMAEN)
         return false;
  
     // avoid any interrupts while DMA0 settings is changed
-    EnterCriticalSection(intState);
+    EnterCriticalSection();
     
     // set DMA priorities
     DMACTL4 |= ROUNDROBIN;
@@ -193,14 +240,14 @@ bool DMA0_ADC_transfer(void* dst, const void* adcReg, uint16_t size,
     DMACTL0 |= DMA0TSEL__ADC12IFG;      // trigger on ADC conversion complete
 
     // set DMA0 source address
-    __data16_write_addr((uint16_t) &DMA0SA,(uint32_t) adcReg);
+    DMA_writeAddress(DMA0SA, adcReg);
     // set DMA0 destination address
-    __data16_write_addr((uint16_t) &DMA0DA,(uint32_t) dst);
+    DMA_writeAddress(DMA0DA, dst);
     // set data block size
     DMA0SZ = size;
     
-    // set DMA0 mode
-    DMA0CTL = DMADT_0 + DMASBDB +       // single transfare, byte to byte
+    // set DMA0 mode (ADC12MEMx is 16-bit)
+    DMA0CTL = DMADT_0 + DMASWDW +       // single transfare, word to word
               DMADSTINCR_3 + DMAIE;	    // dst increment, interrupt enable
 
     // set interrupt handler
@@ -209,7 +256,7 @@ bool DMA0_ADC_transfer(void* dst, const void* adcReg, uint16_t size,
     // enable DMA0
     DMA0CTL |= DMAEN;
     
-    LeaveCriticalSection(intState);     // leave critical section
+    LeaveCriticalSection();             // leave critical section
     
     return true;
 }
@@ -223,14 +270,13 @@ bool DMA0_ADC_transfer(void* dst, const void* adcReg, uint16_t size,
 bool DMA0_USCI_write(DMA_TX_TRIGER dst, const void* src, uint16_t size,
                      HANDLE handler)
 {
-    IntFlag_t   intState;   // save interrupt flag while critical section
  
     // check DMA0 state
     if(DMA0CTL&DMAEN)
         return false;
  
     // avoid any interrupts while DMA0 settings is changed
-    EnterCriticalSection(intState);
+    EnterCriticalSection();
     
     // set DMA priorities
     DMACTL4 |= ROUNDROBIN;
@@ -239,16 +285,19 @@ bool DMA0_USCI_write(DMA_TX_TRIGER dst, const void* src, uint16_t size,
     DMACTL0 &= ~DMA0TSEL_31;                // clear trigger
     DMACTL0 |= DMA0_TX_TRIGGER(dst);        // trigger on USCI transmit
 
-    // set DMA0 source address
-    __data16_write_addr((uint16_t) &DMA0SA, (uint32_t) src);
+    // set DMA0 source address (dummy byte if no data)
+    DMA_writeAddress(DMA0SA, src ? src : &DMA_dummyTx);
     // set DMA0 destination address
-    __data16_write_addr((uint16_t) &DMA0DA, (uint32_t) DMA_txSettings[dst].ptr);
+    DMA_writeAddress(DMA0DA, DMA_txSettings[dst].ptr);
     // set data block size
     DMA0SZ = size;
     
     // set DMA0 mode
-    DMA0CTL = DMADT_0 + DMASBDB +       // single transfare, byte to byte
-              DMASRCINCR_3 + DMAIE;     // src increment, interrupt enable
+    DMA0CTL = DMADT_0 + DMASBDB;        // single transfare, byte to byte
+    if(src)
+        DMA0CTL |= DMASRCINCR_3;        // src increment
+    if(handler)
+        DMA0CTL |= DMAIE;               // interrupt enable
 
     // set interrupt handler
     DMA_handler[0] = handler;
@@ -256,7 +305,7 @@ bool DMA0_USCI_write(DMA_TX_TRIGER dst, const void* src, uint16_t size,
     // enable DMA0
     DMA0CTL |= DMAEN;
     
-    LeaveCriticalSection(intState);     // leave critical section
+    LeaveCriticalSection();             // leave critical section
     
     return true;
 }
@@ -270,14 +319,13 @@ bool DMA0_USCI_write(DMA_TX_TRIGER dst, const void* src, uint16_t size,
 bool DMA0_USCI_read(void* dst, DMA_RX_TRIGER src, uint16_t size,
                     HANDLE handler)
 {
-    IntFlag_t   intState;   // save interrupt flag while critical section
  
     // check DMA0 state
     if(DMA0CTL&DMAEN)
         return false;
  
     // avoid any interrupts while DMA0 settings is changed
-    EnterCriticalSection(intState);
+    EnterCriticalSection();
     
     // set DMA priorities
     DMACTL4 |= ROUNDROBIN;
@@ -287,15 +335,18 @@ bool DMA0_USCI_read(void* dst, DMA_RX_TRIGER src, uint16_t size,
     DMACTL0 |= DMA0_RX_TRIGGER(src);        // trigger on USCI receive
 
     // set DMA0 source address
-    __data16_write_addr((uint16_t) &DMA0SA,(uint32_t) DMA_rxSettings[src].ptr);
-    // set DMA0 destination address
-    __data16_write_addr((uint16_t) &DMA0DA,(uint32_t) dst);
+    DMA_writeAddress(DMA0SA, DMA_rxSettings[src].ptr);
+    // set DMA0 destination address (discarded if no buffer)
+    DMA_writeAddress(DMA0DA, dst ? dst : &DMA_discard);
     // set data block size
     DMA0SZ = size;
     
     // set DMA0 mode
-    DMA0CTL = DMADT_0 + DMASBDB +       // single transfare, byte to byte
-              DMADSTINCR_3 + DMAIE;	    // dst increment, interrupt enable
+    DMA0CTL = DMADT_0 + DMASBDB;        // single transfare, byte to byte
+    if(dst)
+        DMA0CTL |= DMADSTINCR_3;        // dst increment
+    if(handler)
+        DMA0CTL |= DMAIE;               // interrupt enable
 
     // set interrupt handler
     DMA_handler[0] = handler;
@@ -303,7 +354,7 @@ bool DMA0_USCI_read(void* dst, DMA_RX_TRIGER src, uint16_t size,
     // enable DMA0
     DMA0CTL |= DMAEN;
     
-    LeaveCriticalSection(intState);     // leave critical section
+    LeaveCriticalSection();             // leave critical section
     
     return true;
 }
@@ -330,14 +381,13 @@ void DMA1_reset()
 bool DMA1_USCI_write(DMA_TX_TRIGER dst, const void* src, uint16_t size,
                      HANDLE handler)
 {
-    IntFlag_t   intState;   // save interrupt flag while critical section
  
     // check DMA1 state
     if(DMA1CTL&DMAEN)
         return false;
  
     // avoid any interrupts while DMA1 settings is changed
-    EnterCriticalSection(intState);
+    EnterCriticalSection();
     
     // set DMA priorities
     DMACTL4 |= ROUNDROBIN;
@@ -346,16 +396,19 @@ bool DMA1_USCI_write(DMA_TX_TRIGER dst, const void* src, uint16_t size,
     DMACTL0 &= ~DMA1TSEL_31;                // clear trigger
     DMACTL0 |= DMA1_TX_TRIGGER(dst);        // trigger on USCI transmit
 
-    // set DMA1 source address
-    __data16_write_addr((uint16_t) &DMA1SA, (uint32_t) src);
+    // set DMA1 source address (dummy byte if no data)
+    DMA_writeAddress(DMA1SA, src ? src : &DMA_dummyTx);
     // set DMA1 destination address
-    __data16_write_addr((uint16_t) &DMA1DA, (uint32_t) DMA_txSettings[dst].ptr);
+    DMA_writeAddress(DMA1DA, DMA_txSettings[dst].ptr);
     // set data block size
     DMA1SZ = size;
     
     // set DMA1 mode
-    DMA1CTL = DMADT_0 + DMASBDB +       // single transfare, byte to byte
-              DMASRCINCR_3 + DMAIE;     // src increment, interrupt enable
+    DMA1CTL = DMADT_0 + DMASBDB;        // single transfare, byte to byte
+    if(src)
+        DMA1CTL |= DMASRCINCR_3;        // src increment
+    if(handler)
+        DMA1CTL |= DMAIE;               // interrupt enable
 
     // set interrupt handler
     DMA_handler[1] = handler;
@@ -363,7 +416,7 @@ bool DMA1_USCI_write(DMA_TX_TRIGER dst, const void* src, uint16_t size,
     // enable DMA1
     DMA1CTL |= DMAEN;
     
-    LeaveCriticalSection(intState);     // leave critical section
+    LeaveCriticalSection();             // leave critical section
     
     return true;
 }
@@ -377,14 +430,13 @@ bool DMA1_USCI_write(DMA_TX_TRIGER dst, const void* src, uint16_t size,
 bool DMA1_USCI_read(void* dst, DMA_RX_TRIGER src, uint16_t size,
                     HANDLE handler)
 {
-    IntFlag_t   intState;   // save interrupt flag while critical section
  
     // check DMA1 state
     if(DMA1CTL&DMAEN)
         return false;
  
     // avoid any interrupts while DMA1 settings is changed
-    EnterCriticalSection(intState);
+    EnterCriticalSection();
     
     // set DMA priorities
     DMACTL4 |= ROUNDROBIN;
@@ -394,15 +446,18 @@ bool DMA1_USCI_read(void* dst, DMA_RX_TRIGER src, uint16_t size,
     DMACTL0 |= DMA1_RX_TRIGGER(src);        // trigger on USCI receive
 
     // set DMA1 source address
-    __data16_write_addr((uint16_t) &DMA1SA,(uint32_t) DMA_rxSettings[src].ptr);
-    // set DMA1 destination address
-    __data16_write_addr((uint16_t) &DMA1DA,(uint32_t) dst);
+    DMA_writeAddress(DMA1SA, DMA_rxSettings[src].ptr);
+    // set DMA1 destination address (discarded if no buffer)
+    DMA_writeAddress(DMA1DA, dst ? dst : &DMA_discard);
     // set data block size
     DMA1SZ = size;
     
     // set DMA1 mode
-    DMA1CTL = DMADT_0 + DMASBDB +       // single transfare, byte to byte
-              DMADSTINCR_3 + DMAIE;	    // dst increment, interrupt enable
+    DMA1CTL = DMADT_0 + DMASBDB;        // single transfare, byte to byte
+    if(dst)
+        DMA1CTL |= DMADSTINCR_3;        // dst increment
+    if(handler)
+        DMA1CTL |= DMAIE;               // interrupt enable
 
     // set interrupt handler
     DMA_handler[1] = handler;
@@ -410,7 +465,54 @@ bool DMA1_USCI_read(void* dst, DMA_RX_TRIGER src, uint16_t size,
     // enable DMA1
     DMA1CTL |= DMAEN;
     
-    LeaveCriticalSection(intState);     // leave critical section
+    LeaveCriticalSection();             // leave critical section
+    
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// Function:	
+//              DMA1_USCI_rxWrite()
+// Description:
+//! \brief      Write word to register on every USCI receive
+//! \details    Repeated single transfer without interrupt, RXBUF is not read
+//!             (the channel receiving data shares the trigger). Used to
+//!             restart a timer by every received character.
+//! \param src      USCI receive trigger
+//! \param reg      destination register
+//! \param value    word to write (has to stay valid while enabled)
+//------------------------------------------------------------------------------
+bool DMA1_USCI_rxWrite(DMA_RX_TRIGER src, volatile uint16_t* reg,
+                       const uint16_t* value)
+{
+    // check DMA1 state
+    if(DMA1CTL&DMAEN)
+        return false;
+ 
+    // avoid any interrupts while DMA1 settings is changed
+    EnterCriticalSection();
+    
+    // set DMA1 trigger 
+    DMACTL0 &= ~DMA1TSEL_31;                // clear trigger
+    DMACTL0 |= DMA1_RX_TRIGGER(src);        // trigger on USCI receive
+
+    // set DMA1 source address
+    DMA_writeAddress(DMA1SA, value);
+    // set DMA1 destination address
+    DMA_writeAddress(DMA1DA, reg);
+    // set data block size
+    DMA1SZ = 1;
+    
+    // set DMA1 mode
+    DMA1CTL = DMADT_4 + DMASWDW;        // repeated single, word to word
+
+    // no interrupt handler
+    DMA_handler[1] = NULL;
+    
+    // enable DMA1
+    DMA1CTL |= DMAEN;
+    
+    LeaveCriticalSection();             // leave critical section
     
     return true;
 }
@@ -437,14 +539,13 @@ void DMA2_reset()
 bool DMA2_USCI_write(DMA_TX_TRIGER dst, const void* src, uint16_t size,
                      HANDLE handler)
 {
-    IntFlag_t   intState;   // save interrupt flag while critical section
  
     // check DMA2 state
     if(DMA2CTL&DMAEN)
         return false;
  
     // avoid any interrupts while DMA2 settings is changed
-    EnterCriticalSection(intState);
+    EnterCriticalSection();
     
     // set DMA priorities
     DMACTL4 |= ROUNDROBIN;
@@ -453,16 +554,19 @@ bool DMA2_USCI_write(DMA_TX_TRIGER dst, const void* src, uint16_t size,
     DMACTL1 &= ~DMA2TSEL_31;                // clear trigger
     DMACTL1 |= DMA2_TX_TRIGGER(dst);        // trigger on USCI transmit
 
-    // set DMA2 source address
-    __data16_write_addr((uint16_t) &DMA2SA, (uint32_t) src);
+    // set DMA2 source address (dummy byte if no data)
+    DMA_writeAddress(DMA2SA, src ? src : &DMA_dummyTx);
     // set DMA2 destination address
-    __data16_write_addr((uint16_t) &DMA2DA, (uint32_t) DMA_txSettings[dst].ptr);
+    DMA_writeAddress(DMA2DA, DMA_txSettings[dst].ptr);
     // set data block size
     DMA2SZ = size;
     
     // set DMA2 mode
-    DMA2CTL = DMADT_0 + DMASBDB +       // single transfare, byte to byte
-              DMASRCINCR_3 + DMAIE;     // src increment, interrupt enable
+    DMA2CTL = DMADT_0 + DMASBDB;        // single transfare, byte to byte
+    if(src)
+        DMA2CTL |= DMASRCINCR_3;        // src increment
+    if(handler)
+        DMA2CTL |= DMAIE;               // interrupt enable
 
     // set interrupt handler
     DMA_handler[2] = handler;
@@ -470,7 +574,7 @@ bool DMA2_USCI_write(DMA_TX_TRIGER dst, const void* src, uint16_t size,
     // enable DMA2
     DMA2CTL |= DMAEN;
     
-    LeaveCriticalSection(intState);     // leave critical section
+    LeaveCriticalSection();             // leave critical section
     
     return true;
 }
@@ -484,14 +588,13 @@ bool DMA2_USCI_write(DMA_TX_TRIGER dst, const void* src, uint16_t size,
 bool DMA2_USCI_read(void* dst, DMA_RX_TRIGER src, uint16_t size,
                     HANDLE handler)
 {
-    IntFlag_t   intState;   // save interrupt flag while critical section
  
     // check DMA2 state
     if(DMA2CTL&DMAEN)
         return false;
  
     // avoid any interrupts while DMA2 settings is changed
-    EnterCriticalSection(intState);
+    EnterCriticalSection();
     
     // set DMA priorities
     DMACTL4 |= ROUNDROBIN;
@@ -501,15 +604,18 @@ bool DMA2_USCI_read(void* dst, DMA_RX_TRIGER src, uint16_t size,
     DMACTL1 |= DMA2_RX_TRIGGER(src);        // trigger on USCI receive
 
     // set DMA2 source address
-    __data16_write_addr((uint16_t) &DMA2SA,(uint32_t) DMA_rxSettings[src].ptr);
-    // set DMA2 destination address
-    __data16_write_addr((uint16_t) &DMA2DA,(uint32_t) dst);
+    DMA_writeAddress(DMA2SA, DMA_rxSettings[src].ptr);
+    // set DMA2 destination address (discarded if no buffer)
+    DMA_writeAddress(DMA2DA, dst ? dst : &DMA_discard);
     // set data block size
     DMA2SZ = size;
     
     // set DMA2 mode
-    DMA2CTL = DMADT_0 + DMASBDB +       // single transfare, byte to byte
-              DMADSTINCR_3 + DMAIE;	    // dst increment, interrupt enable
+    DMA2CTL = DMADT_0 + DMASBDB;        // single transfare, byte to byte
+    if(dst)
+        DMA2CTL |= DMADSTINCR_3;        // dst increment
+    if(handler)
+        DMA2CTL |= DMAIE;               // interrupt enable
 
     // set interrupt handler
     DMA_handler[2] = handler;
@@ -517,11 +623,225 @@ bool DMA2_USCI_read(void* dst, DMA_RX_TRIGER src, uint16_t size,
     // enable DMA2
     DMA2CTL |= DMAEN;
     
-    LeaveCriticalSection(intState);     // leave critical section
+    LeaveCriticalSection();             // leave critical section
     
     return true;
 }
 
+//------------------------------------------------------------------------------
+// Function:	
+//              DMA_streamComplete()
+// Description:
+//! \brief      Block of stream is filled: switch to the other channel
+//! \details    Called from DMA ISR. The other channel is pre-armed, so the
+//!             switch is a single enable. Byte which came after the last
+//!             transfer (USCI holds one) has no trigger edge for the new
+//!             channel anymore: it is requested by software. CPU is halted
+//!             during DMA transfer, so RXIFG is cleared by a triggered
+//!             transfer before it is checked here.
+//------------------------------------------------------------------------------
+static void DMA_streamComplete(uint8_t channel)
+{
+    uint8_t* block = DMA_stream.buffer + (channel ? DMA_stream.size : 0);
+
+    // Continue reception by pre-armed channel
+    if(channel)
+    {
+        DMA0CTL |= DMAEN;
+        if(*DMA_stream.ifg & UCRXIFG)
+            DMA0CTL |= DMAREQ;
+    }
+    else
+    {
+        DMA1CTL |= DMAEN;
+        if(*DMA_stream.ifg & UCRXIFG)
+            DMA1CTL |= DMAREQ;
+    }
+
+    // Re-arm completed channel for its block
+    if(channel)
+    {
+        DMA_writeAddress(DMA1DA, block);
+        DMA1SZ = DMA_stream.size;
+    }
+    else
+    {
+        DMA_writeAddress(DMA0DA, block);
+        DMA0SZ = DMA_stream.size;
+    }
+
+    // Block of the other channel is overwritten if it is not released
+    if(DMA_stream.ready)
+        DMA_stream.overruns++;
+    DMA_stream.ready = channel + 1;
+    DMA_stream.active = channel ^ 1;
+
+    if(DMA_stream.handler)
+        DMA_stream.handler();
+}
+
+//------------------------------------------------------------------------------
+// Function:	
+//              DMA0_streamComplete()
+// Description:
+//! \brief      DMA0 block of stream is filled
+//------------------------------------------------------------------------------
+static void DMA0_streamComplete(void)
+{
+    DMA_streamComplete(0);
+}
+
+//------------------------------------------------------------------------------
+// Function:	
+//              DMA1_streamComplete()
+// Description:
+//! \brief      DMA1 block of stream is filled
+//------------------------------------------------------------------------------
+static void DMA1_streamComplete(void)
+{
+    DMA_streamComplete(1);
+}
+
+//------------------------------------------------------------------------------
+// Function:	
+//              DMA01_USCI_stream()
+// Description:
+//! \brief      Start continuous reception from USCI by DMA0/DMA1
+//! \details    DMA0 receives to the first block, DMA1 (pre-armed) to the
+//!             second one, then they alternate. Handler is called from DMA
+//!             ISR for every filled block.
+//! \param src      USCI receive trigger
+//! \param buffer   2*size bytes
+//! \param size     block size
+//! \param handler  block complete handler
+//! \return         false, if DMA0/DMA1 are busy
+//------------------------------------------------------------------------------
+bool DMA01_USCI_stream(DMA_RX_TRIGER src, uint8_t* buffer, uint16_t size,
+                       HANDLE handler)
+{
+    // check DMA0/DMA1 state
+    if((DMA0CTL&DMAEN) || (DMA1CTL&DMAEN) || size == 0)
+        return false;
+
+    // avoid any interrupts while DMA settings is changed
+    EnterCriticalSection();
+
+    DMA_stream.buffer = buffer;
+    DMA_stream.ifg = DMA_rxSettings[src].ifg;
+    DMA_stream.handler = handler;
+    DMA_stream.size = size;
+    DMA_stream.overruns = 0;
+    DMA_stream.active = 0;
+    DMA_stream.ready = 0;
+
+    // set DMA0/DMA1 triggers
+    DMACTL0 &= ~(DMA0TSEL_31 | DMA1TSEL_31);    // clear triggers
+    DMACTL0 |= DMA0_RX_TRIGGER(src) |           // trigger on USCI receive
+               DMA1_RX_TRIGGER(src);
+
+    // set source addresses
+    DMA_writeAddress(DMA0SA, DMA_rxSettings[src].ptr);
+    DMA_writeAddress(DMA1SA, DMA_rxSettings[src].ptr);
+    // set destination addresses (blocks)
+    DMA_writeAddress(DMA0DA, buffer);
+    DMA_writeAddress(DMA1DA, buffer + size);
+    // set block sizes
+    DMA0SZ = size;
+    DMA1SZ = size;
+
+    // set DMA0/DMA1 mode
+    DMA0CTL = DMADT_0 + DMASBDB +       // single transfare, byte to byte
+              DMADSTINCR_3 + DMAIE;     // dst increment, interrupt enable
+    DMA1CTL = DMADT_0 + DMASBDB +
+              DMADSTINCR_3 + DMAIE;
+
+    // set interrupt handlers
+    DMA_handler[0] = DMA0_streamComplete;
+    DMA_handler[1] = DMA1_streamComplete;
+
+    // enable DMA0, DMA1 waits for the first block
+    DMA0CTL |= DMAEN;
+
+    LeaveCriticalSection();             // leave critical section
+
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// Function:	
+//              DMA01_streamStop()
+// Description:
+//! \brief      Stop continuous reception
+//------------------------------------------------------------------------------
+void DMA01_streamStop(void)
+{
+    EnterCriticalSection();
+
+    DMA0CTL &= ~(DMAEN | DMAIFG);
+    DMA1CTL &= ~(DMAEN | DMAIFG);
+    DMA_handler[0] = NULL;
+    DMA_handler[1] = NULL;
+    DMA_stream.ready = 0;
+
+    LeaveCriticalSection();
+}
+
+//------------------------------------------------------------------------------
+// Function:	
+//              DMA01_streamGet()
+// Description:
+//! \brief      Filled block of stream
+//! \return     block of size bytes or NULL
+//------------------------------------------------------------------------------
+const uint8_t* DMA01_streamGet(void)
+{
+    uint8_t ready = DMA_stream.ready;
+
+    if(ready == 0)
+        return NULL;
+    return DMA_stream.buffer + (ready - 1)*DMA_stream.size;
+}
+
+//------------------------------------------------------------------------------
+// Function:	
+//              DMA01_streamRelease()
+// Description:
+//! \brief      Release filled block
+//! \details    The block is ignored if it was already overwritten (newer
+//!             block is ready then).
+//------------------------------------------------------------------------------
+void DMA01_streamRelease(const uint8_t* block)
+{
+    EnterCriticalSection();
+
+    if(block == DMA01_streamGet())
+        DMA_stream.ready = 0;
+
+    LeaveCriticalSection();
+}
+
+//------------------------------------------------------------------------------
+// Function:	
+//              DMA01_streamPending()
+// Description:
+//! \brief      Number of bytes received to the current block
+//------------------------------------------------------------------------------
+uint16_t DMA01_streamPending(void)
+{
+    return DMA_stream.size - (DMA_stream.active ? DMA1SZ : DMA0SZ);
+}
+
+//------------------------------------------------------------------------------
+// Function:	
+//              DMA01_streamOverruns()
+// Description:
+//! \brief      Number of blocks overwritten before release
+//------------------------------------------------------------------------------
+uint16_t DMA01_streamOverruns(void)
+{
+    return DMA_stream.overruns;
+}
+
 //------------------------------------------------------------------------------
 // DMA Interrupt Service Routine
 //------------------------------------------------------------------------------
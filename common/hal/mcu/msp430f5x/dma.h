@@ -18,6 +18,9 @@
 //!  02/02/2015 | Bogdan Kokotenko | Initial draft
 //!  07/02/2015 | Bogdan Kokotenko | Added USCIA1 APIs
 //!  01/11/2015 | Bogdan Kokotenko | Improved DMA APIs for USCI
+//!  18/10/2026 | Bogdan Kokotenko | Added DMA0/DMA1 ping-pong USCI stream
+//!  18/10/2026 | Bogdan Kokotenko | Added DMA1 register write on USCI receive
+//!  18/10/2026 | Bogdan Kokotenko | USCI transfers without data/buffer (SPI)
 //!
 //******************************************************************************
 #ifndef DMA_H
@@ -55,12 +58,19 @@ typedef enum _DMA_RX_TRIGER{
     DMA_ADC12IFG        //!< triggered by ADC12IFGx
 }DMA_RX_TRIGER;
 
+//------------------------------------------------------------------------------
+// USCI transfers: NULL data transmits dummy bytes (0x00), NULL buffer
+// discards received bytes (SPI), NULL handler leaves channel interrupt off.
+
 //! Stop DMA0
 void DMA0_reset();
 
 //! Check if DMA0 transfared any bytes
 bool DMA0_isSizeChanged(uint16_t initial);
 
+//! Number of DMA0 transfers left
+uint16_t DMA0_getSize(void);
+
 //! Fast memory copy by DMA0
 bool DMA0_memcpy(void* dst, const void* src, uint16_t size);
 
@@ -87,6 +97,10 @@ bool DMA1_USCI_write(DMA_TX_TRIGER dst, const void* src, uint16_t size,
 bool DMA1_USCI_read(void* dst, DMA_RX_TRIGER src, uint16_t size,
                     HANDLE handler);
 
+//! Write word to register on every USCI receive (no interrupt)
+bool DMA1_USCI_rxWrite(DMA_RX_TRIGER src, volatile uint16_t* reg,
+                       const uint16_t* value);
+
 //! Stop DMA2
 void DMA2_reset();
 
@@ -98,6 +112,31 @@ bool DMA2_USCI_write(DMA_TX_TRIGER dst, const void* src, uint16_t size,
 bool DMA2_USCI_read(void* dst, DMA_RX_TRIGER src, uint16_t size,
                     HANDLE handler);
 
+//------------------------------------------------------------------------------
+// DMA0/DMA1 ping-pong stream: continuous reception from USCI to two blocks
+// of buffer. Channel of the filled block is re-armed in DMA ISR while the
+// other (pre-armed) channel receives, so reception never stops. Handler is
+// called from DMA ISR for every filled block.
+
+//! Start continuous reception to buffer of 2*size bytes by DMA0/DMA1
+bool DMA01_USCI_stream(DMA_RX_TRIGER src, uint8_t* buffer, uint16_t size,
+                       HANDLE handler);
+
+//! Stop continuous reception
+void DMA01_streamStop(void);
+
+//! Filled block (size bytes) or NULL, has to be released till the next one
+const uint8_t* DMA01_streamGet(void);
+
+//! Release filled block, its channel could receive to it again
+void DMA01_streamRelease(const uint8_t* block);
+
+//! Number of bytes received to the current block
+uint16_t DMA01_streamPending(void);
+
+//! Number of blocks overwritten before release
+uint16_t DMA01_streamOverruns(void);
+
 #ifdef __cplusplus
 }
 #endif
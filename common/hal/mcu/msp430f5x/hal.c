@@ -10,11 +10,13 @@
 //!  Date       | Author           | Comments			
 //!  ---------- | ---------------- | ----------------
 //!  22/05/2016 | Bogdan Kokotenko | Initial draft
+//!  18/10/2026 | Bogdan Kokotenko | Added startup stack painting
 //
 //******************************************************************************
 #include "project.h"
 #include "types.h"
 #include "hal.h"
+#include "stack.h"
 
 // Warn of inappropriate MCU core selection
 #if ( !defined (_MSP430F5x_HAL_) )
@@ -32,6 +34,9 @@ uint16_t GINT_criticalNesting = 0;
 //------------------------------------------------------------------------------
 int __low_level_init(void)
 {
+    // Fill free stack for high-water mark measurement
+    SYS_stackPaint();
+
     // Return value:
     // *  1 - Perform data segment initialization.
     // *  0 - Skip data segment initialization.
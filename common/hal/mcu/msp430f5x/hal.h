@@ -15,6 +15,7 @@
 //!  Date       | Author           | Comments			
 //!  ---------- | ---------------- | ----------------
 //!  19/02/2015 | Bogdan Kokotenko | Initial draft
+//!  18/10/2026 | Bogdan Kokotenko | Added HANDLE type of peripheral handlers
 //
 //******************************************************************************
 #ifndef HAL_H
@@ -29,6 +30,9 @@
 //! MCU core HAL definition
 #define _MSP430F5x_HAL_
 
+//! Peripheral event handler (called from ISR)
+typedef void (*HANDLE)(void);
+
 #if defined(USE_LOW_POWER_MODE_CRYSTAL)
 //! Low power mode definition
 #define USE_LOW_POWER_MODE
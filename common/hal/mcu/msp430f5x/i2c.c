@@ -17,6 +17,9 @@
 //!  28/08/2015 | Bogdan Kokotenko | Added advanced handler caller option.
 //!  28/08/2015 | Bogdan Kokotenko | Fixed autorestart for rx-one-byte mode.
 //!  13/01/2016 | Bogdan Kokotenko | Added request size otput for slave.
+//!  18/10/2026 | Bogdan Kokotenko | Added I2C0 transaction engine.
+//!  18/10/2026 | Bogdan Kokotenko | Engine: last byte NACK checking fixed.
+//!  18/10/2026 | Bogdan Kokotenko | Engine: stop is awaited by tasklet.
 //
 //******************************************************************************
 #include "project.h"
@@ -117,8 +120,7 @@ bool I2C0_resetBus(void)
 {
     #ifdef I2C0_MASTER
 
-    IntFlag_t intState;
-    EnterCriticalSection(intState);
+    EnterCriticalSection();
     
     I2C0_REG(CTL1) |= UCTXSTP;          // Send stop condition
     __delay_us((1000000L/I2C0_BAUDRATE) + 1);
@@ -138,7 +140,7 @@ bool I2C0_resetBus(void)
     {
         if(GPIO_test(I2C0_SDA_PIN))    // Check SDA line
         {
-            LeaveCriticalSection(intState);
+            LeaveCriticalSection();
             return true;             
         }
 
@@ -148,11 +150,11 @@ bool I2C0_resetBus(void)
         __delay_us((1000000L/I2C0_BAUDRATE) + 1);
     }
                 
-    LeaveCriticalSection(intState);
+    LeaveCriticalSection();
     return false;                     // unrecoverable bus error
     
     #else
-        return SUCCESS;
+        return true;
     #endif
 
 }
@@ -219,7 +221,7 @@ void I2C0_txByte(uint8_t dataByte)
 
     counter = 10;                           //(data byte + ack bit + sp bit)
     while (counter-- &&
-           I2C0_REG(CTL1 & UCTXSTP))        // Ensure stop condition got sent
+           (I2C0_REG(CTL1) & UCTXSTP))        // Ensure stop condition got sent
         __delay_us((1000000L/I2C0_BAUDRATE) + 1);      
     if(!counter)
     {
@@ -287,7 +289,7 @@ uint8_t I2C0_rxByte(void)
 
     counter = 10;                           //(data byte + ack bit + sp bit)
     while (counter-- &&
-           I2C0_REG(CTL1 & UCTXSTP))        // Ensure stop condition got sent
+           (I2C0_REG(CTL1) & UCTXSTP))        // Ensure stop condition got sent
         __delay_us((1000000L/I2C0_BAUDRATE) + 1);      
     if(!counter)
     {
@@ -339,7 +341,7 @@ void I2C0_transmit(const void* data, uint16_t size, void (*handler)(void))
     #ifdef I2C0_MASTER
     uint16_t counter = 10;                  //(data byte + ack bit + sp bit)
     while (counter-- &&
-           I2C0_REG(CTL1 & UCTXSTP))        // Ensure stop condition got sent
+           (I2C0_REG(CTL1) & UCTXSTP))        // Ensure stop condition got sent
         __delay_us((1000000L/I2C0_BAUDRATE) + 1);      
     if(!counter)
     {
@@ -382,7 +384,7 @@ void I2C0_receive(void* data, uint16_t* size, void (*handler)(void))
     #ifdef I2C0_MASTER
     uint16_t counter = 10;                  //(data byte + ack bit + sp bit)
     while (counter-- &&
-           I2C0_REG(CTL1 & UCTXSTP))        // Ensure stop condition got sent
+           (I2C0_REG(CTL1) & UCTXSTP))        // Ensure stop condition got sent
         __delay_us((1000000L/I2C0_BAUDRATE) + 1);      
     if(!counter)
     {
@@ -427,7 +429,7 @@ void I2C0_request(uint8_t address,
 {
     uint16_t counter = 10;                  //(data byte + ack bit + sp bit)
     while (counter-- &&
-           I2C0_REG(CTL1 & UCTXSTP))        // Ensure stop condition got sent
+           (I2C0_REG(CTL1) & UCTXSTP))        // Ensure stop condition got sent
         __delay_us((1000000L/I2C0_BAUDRATE) + 1);      
     if(!counter)
     {
@@ -459,6 +461,415 @@ void I2C0_request(uint8_t address,
     I2C0_REG(CTL1) |= UCTXSTT;              // Send start condition  
 }
 
+#ifdef I2C0_MASTER
+//! I2C0 transaction engine waits for stop condition
+typedef enum{
+    I2C0_STOP_NONE,                     //!< no stop is awaited
+    I2C0_STOP_DONE,                     //!< stop after last written byte
+    I2C0_STOP_START                     //!< active script waits for start
+}I2C0_STOP_t;
+
+//! I2C0 transaction engine context
+static struct I2C_Engine_t{
+    I2C_Script_t*   script;             //!< active script (NULL - idle)
+    I2C_Script_t*   end;                //!< end of scripts list
+    void (*handler)(void);              //!< list completion handler
+    uint8_t         step;               //!< active step index
+    uint16_t        index;              //!< data index of active step
+    uint8_t         stop;               //!< awaited stop (I2C0_STOP_t)
+}I2C0_engine;
+
+static void I2C0_stopTask(void);
+
+//------------------------------------------------------------------------------
+// Function:
+//              I2C0_waitCondition()
+// Description:
+//! \brief      Wait till start or stop condition is sent
+//! \return     true - in case of success, false - timeout
+//------------------------------------------------------------------------------
+static bool I2C0_waitCondition(uint8_t condition)
+{
+    uint16_t counter = 20;      //(data byte + ack bit + st bit + address byte
+                                // + ack bit)
+    while(counter-- && (I2C0_REG(CTL1) & condition))
+        __delay_us((1000000L/I2C0_BAUDRATE) + 1);
+
+    return (I2C0_REG(CTL1) & condition) ? false : true;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              I2C0_condition()
+// Description:
+//! \brief      Request condition before the step: stop after the last step,
+//!             repeated start before write or read, none before burst write
+//------------------------------------------------------------------------------
+static void I2C0_condition(uint8_t next)
+{
+    const I2C_Script_t* script = I2C0_engine.script;
+
+    if(next >= script->count)
+    {
+        I2C0_REG(CTL1) |= UCTXSTP;          // Send stop condition
+        return;
+    }
+
+    const I2C_Step_t* step = &script->steps[next];
+    if(step->type == I2C_WRITE_MORE)
+        return;
+
+    I2C0_REG(I2CSA) = step->address;
+    if(step->type == I2C_READ)
+        I2C0_REG(CTL1) &= ~UCTR;            // Set Master receiver
+    else
+        I2C0_REG(CTL1) |= UCTR;             // Set Master transmitter
+    I2C0_REG(CTL1) |= UCTXSTT;              // Send (repeated) start condition
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              I2C0_enterStep()
+// Description:
+//! \brief      Prepare active step
+//! \details    Single byte is NACKed, so the next condition is requested as
+//!             soon as the address is sent. NACKed address is left to ISR.
+//!             It is the only wait for bus condition in ISR, bounded by
+//!             20*(1000000/I2C0_BAUDRATE + 1) us: 60 us at 400 kHz, 220 us
+//!             at 100 kHz (last byte, restart and address are sent).
+//! \return     true - in case of success, false - bus error
+//------------------------------------------------------------------------------
+static bool I2C0_enterStep(void)
+{
+    const I2C_Step_t* step = &I2C0_engine.script->steps[I2C0_engine.step];
+
+    I2C0_engine.index = 0;
+    if(step->type == I2C_READ && step->size == 1)
+    {
+        if(!I2C0_waitCondition(UCTXSTT))
+            return false;
+        if(!(I2C0_REG(IFG) & UCNACKIFG))
+            I2C0_condition(I2C0_engine.step + 1);
+    }
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              I2C0_startScript()
+// Description:
+//! \brief      Start active script
+//! \details    If the previous stop condition is still being sent, the
+//!             script is started later by I2C0_stopTask().
+//! \return     Script state: active or bus error
+//------------------------------------------------------------------------------
+static uint8_t I2C0_startScript(void)
+{
+    I2C0_engine.step = 0;
+    I2C0_engine.stop = I2C0_STOP_NONE;
+    I2C0_engine.script->state = I2C_SCRIPT_ACTIVE;
+
+    if(I2C0_REG(CTL1) & UCTXSTP)            // Stop condition is not sent yet
+    {
+        I2C0_engine.stop = I2C0_STOP_START;
+        TASK_createUnique(I2C0_stopTask);
+        return I2C_SCRIPT_ACTIVE;
+    }
+
+    I2C0_REG(IFG) &= ~(UCTXIFG+UCRXIFG+UCNACKIFG+UCALIFG);
+    I2C0_REG(IE) |= (UCTXIE+UCRXIE+UCNACKIE+UCALIE);
+
+    I2C0_condition(0);
+    return I2C0_enterStep() ? I2C_SCRIPT_ACTIVE : I2C_SCRIPT_BUS_ERROR;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              I2C0_finishScript()
+// Description:
+//! \brief      Finish active script and start the next one
+//! \details    Bus error is recovered by I2C0 reinitialization (bus reset),
+//!             unrecoverable bus fails the rest of the list. Handler is
+//!             called when the list is finished.
+//------------------------------------------------------------------------------
+static void I2C0_finishScript(uint8_t state)
+{
+    I2C_Script_t* script = I2C0_engine.script;
+
+    for(;;)
+    {
+        script->state = state;
+        script->done = I2C0_engine.step;
+
+        if(state == I2C_SCRIPT_BUS_ERROR && !I2C0_init())
+        {
+            while(++script < I2C0_engine.end)   // Bus is hung
+            {
+                script->state = I2C_SCRIPT_BUS_ERROR;
+                script->done = 0;
+            }
+            break;
+        }
+
+        if(++script >= I2C0_engine.end)
+            break;
+
+        I2C0_engine.script = script;
+        state = I2C0_startScript();
+        if(state == I2C_SCRIPT_ACTIVE)
+            return;
+    }
+
+    // List is finished
+    I2C0_engine.script = NULL;
+    I2C0_engine.stop = I2C0_STOP_NONE;
+    I2C0_REG(IE) &= ~(UCTXIE+UCRXIE+UCNACKIE+UCALIE);
+
+    if(I2C0_engine.handler)
+    {
+        #ifdef I2C_handlerCaller
+            I2C_handlerCaller(I2C0_engine.handler);
+        #else
+            I2C0_engine.handler();
+        #endif
+    }
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              I2C0_nextStep()
+// Description:
+//! \brief      Active step is completed, go to the next one
+//------------------------------------------------------------------------------
+static void I2C0_nextStep(void)
+{
+    if(++I2C0_engine.step >= I2C0_engine.script->count)
+        I2C0_finishScript(I2C_SCRIPT_DONE);
+    else if(!I2C0_enterStep())
+        I2C0_finishScript(I2C_SCRIPT_BUS_ERROR);
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              I2C0_stopTask()
+// Description:
+//! \brief      Tasklet: stop condition is sent, finish or start the script
+//! \details    Last written byte is ACKed or NACKed before the stop, so the
+//!             script is done only if no NACK is pending. The wait for the
+//!             stop (few bit times) is done out of ISR.
+//------------------------------------------------------------------------------
+static void I2C0_stopTask(void)
+{
+    bool sent = I2C0_waitCondition(UCTXSTP);
+    uint8_t stop;
+
+    EnterCriticalSection();
+
+    stop = I2C0_engine.script ? I2C0_engine.stop : I2C0_STOP_NONE;
+    if(stop != I2C0_STOP_NONE && (I2C0_REG(CTL1) & UCTXSTP))
+    {
+        if(sent)                            // Next stop is requested by ISR
+            TASK_createUnique(I2C0_stopTask);
+        else
+            I2C0_finishScript(I2C_SCRIPT_BUS_ERROR);
+        stop = I2C0_STOP_NONE;
+    }
+
+    if(stop == I2C0_STOP_DONE)
+    {
+        if(I2C0_REG(IFG) & UCNACKIFG)       // Last byte is NACKed
+        {
+            I2C0_REG(IFG) &= ~UCNACKIFG;
+            I2C0_finishScript(I2C_SCRIPT_NACK);
+        }
+        else
+            I2C0_nextStep();
+    }
+    else if(stop == I2C0_STOP_START)
+    {
+        stop = I2C0_startScript();
+        if(stop != I2C_SCRIPT_ACTIVE)
+            I2C0_finishScript(stop);
+    }
+
+    LeaveCriticalSection();
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              I2C0_scriptIsr()
+// Description:
+//! \brief      I2C0 transaction engine ISR
+//------------------------------------------------------------------------------
+static void I2C0_scriptIsr(uint16_t vector)
+{
+    const I2C_Script_t* script = I2C0_engine.script;
+    const I2C_Step_t* step = &script->steps[I2C0_engine.step];
+
+    if(I2C0_engine.stop == I2C0_STOP_START) // Script is not started yet
+        return;
+
+    switch(vector)
+    {
+        //------------------------------------------------------------------
+        case  2:                            // Vector  2: ALIFG
+            I2C0_finishScript(I2C_SCRIPT_BUS_ERROR);
+            break;
+        //------------------------------------------------------------------
+        case  4:                            // Vector  4: NACKIFG
+            I2C0_REG(CTL1) |= UCTXSTP;      // Send stop condition
+            I2C0_REG(IFG) &= ~UCTXIFG;      // Clear TX IFG flag
+            I2C0_finishScript(I2C_SCRIPT_NACK);
+            break;
+        //------------------------------------------------------------------
+        case 10:                            // Vector 10: RXIFG
+            if(step->type != I2C_READ)
+            {
+                volatile uint8_t tmp = I2C0_REG(RXBUF);
+                (void)tmp;
+                break;
+            }
+
+            // Read data byte
+            ((uint8_t*)step->data)[I2C0_engine.index++] = I2C0_REG(RXBUF);
+            if(I2C0_engine.index == step->size - 1) // Last byte is shifted in
+                I2C0_condition(I2C0_engine.step + 1);
+            if(I2C0_engine.index == step->size)
+                I2C0_nextStep();
+            break;
+        //------------------------------------------------------------------
+        case 12:                            // Vector 12: TXIFG
+            for(;;)
+            {
+                if(step->type == I2C_READ)
+                    return;
+
+                if(I2C0_engine.index < step->size)  // Send data byte
+                {
+                    I2C0_REG(TXBUF) =
+                        ((const uint8_t*)step->data)[I2C0_engine.index++];
+                    return;
+                }
+
+                // Burst write goes on without restart
+                if(I2C0_engine.step + 1 >= script->count ||
+                   step[1].type != I2C_WRITE_MORE)
+                    break;
+                I2C0_engine.step++;
+                I2C0_engine.index = 0;
+                step++;
+            }
+
+            I2C0_REG(IFG) &= ~UCTXIFG;      // Clear TX IFG flag
+            I2C0_condition(I2C0_engine.step + 1);
+            if(I2C0_engine.step + 1 < script->count)
+            {
+                I2C0_nextStep();
+                break;
+            }
+
+            // Last byte is still shifted out: NACK comes by NACKIFG,
+            // otherwise the script is done by tasklet when stop is sent
+            I2C0_engine.stop = I2C0_STOP_DONE;
+            TASK_createUnique(I2C0_stopTask);
+            break;
+        default: break;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//                  I2C0_runScripts()
+// Description:
+//! \brief          Run list of transaction scripts via I2C0
+//------------------------------------------------------------------------------
+bool I2C0_runScripts(I2C_Script_t* scripts, uint8_t count,
+                     void (*handler)(void))
+{
+    uint8_t index, step;
+
+    if(!scripts || !count)
+        return false;
+
+    // Check scripts: burst write continues write, read has data
+    for(index = 0; index < count; index++)
+    {
+        const I2C_Step_t* steps = scripts[index].steps;
+        if(!steps || !scripts[index].count || steps[0].type == I2C_WRITE_MORE)
+            return false;
+        for(step = 0; step < scripts[index].count; step++)
+        {
+            if(steps[step].type == I2C_READ && !steps[step].size)
+                return false;
+            if(steps[step].type == I2C_WRITE_MORE &&
+               steps[step - 1].type == I2C_READ)
+                return false;
+        }
+    }
+
+    EnterCriticalSection();
+
+    if(I2C0_engine.script)                  // Engine is busy
+    {
+        LeaveCriticalSection();
+        return false;
+    }
+
+    for(index = 0; index < count; index++)
+    {
+        scripts[index].state = I2C_SCRIPT_IDLE;
+        scripts[index].done = 0;
+    }
+    I2C0_engine.script = scripts;
+    I2C0_engine.end = scripts + count;
+    I2C0_engine.handler = handler;
+    I2C0_context.errorFlag = false;
+
+    uint8_t state = I2C0_startScript();
+    if(state != I2C_SCRIPT_ACTIVE)
+        I2C0_finishScript(state);
+
+    LeaveCriticalSection();
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//                  I2C0_isScriptRunning()
+// Description:
+//! \brief          Check if I2C0 scripts are executed
+//------------------------------------------------------------------------------
+bool I2C0_isScriptRunning(void)
+{
+    return I2C0_engine.script ? true : false;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//                  I2C0_abortScripts()
+// Description:
+//! \brief          Abort I2C0 scripts
+//------------------------------------------------------------------------------
+void I2C0_abortScripts(void)
+{
+    EnterCriticalSection();
+
+    if(I2C0_engine.script)
+    {
+        I2C_Script_t* script = I2C0_engine.script;
+        while(++script < I2C0_engine.end)
+        {
+            script->state = I2C_SCRIPT_BUS_ERROR;
+            script->done = 0;
+        }
+        I2C0_engine.end = I2C0_engine.script + 1;
+        I2C0_finishScript(I2C_SCRIPT_BUS_ERROR);
+    }
+
+    LeaveCriticalSection();
+}
+#endif // I2C0_MASTER
+
 //------------------------------------------------------------------------------
 // Function:	
 //              I2C0_isr()
@@ -468,6 +879,17 @@ void I2C0_request(uint8_t address,
 #pragma vector=I2C0_ISR_VECTOR
 __interrupt void I2C0_isr(void)
 {
+    #ifdef I2C0_MASTER
+    if(I2C0_engine.script)                  // Transaction engine is running
+    {
+        I2C0_scriptIsr(__even_in_range(I2C0_REG(IV),12));
+        #ifdef USE_LOW_POWER_MODE
+            LPM_disable();                  // Wake-up MCU
+        #endif
+        return;
+    }
+    #endif
+
     switch(__even_in_range(I2C0_REG(IV),12))
     {
         case  0: break;                     // Vector  0: No interrupts
@@ -669,8 +1091,7 @@ bool I2C1_resetBus(void)
 {
     #ifdef I2C1_MASTER
 
-    IntFlag_t intState;
-    EnterCriticalSection(intState);
+    EnterCriticalSection();
     
     I2C1_REG(CTL1) |= UCTXSTP;          // Send stop condition
     __delay_us((1000000L/I2C1_BAUDRATE) + 1);
@@ -690,7 +1111,7 @@ bool I2C1_resetBus(void)
     {
         if(GPIO_test(I2C1_SDA_PIN))    // Check SDA line
         {
-            LeaveCriticalSection(intState);
+            LeaveCriticalSection();
             return true;             
         }
 
@@ -700,7 +1121,7 @@ bool I2C1_resetBus(void)
         __delay_us((1000000L/I2C1_BAUDRATE) + 1);
     }
                 
-    LeaveCriticalSection(intState);
+    LeaveCriticalSection();
     return false;                     // unrecoverable bus error
     
     #else
@@ -771,7 +1192,7 @@ void I2C1_txByte(uint8_t dataByte)
 
     counter = 10;                           //(data byte + ack bit + sp bit)
     while (counter-- &&
-           I2C1_REG(CTL1 & UCTXSTP))        // Ensure stop condition got sent
+           (I2C1_REG(CTL1) & UCTXSTP))        // Ensure stop condition got sent
         __delay_us((1000000L/I2C1_BAUDRATE) + 1);      
     if(!counter)
     {
@@ -839,7 +1260,7 @@ uint8_t I2C1_rxByte(void)
 
     counter = 10;                           //(data byte + ack bit + sp bit)
     while (counter-- &&
-           I2C1_REG(CTL1 & UCTXSTP))        // Ensure stop condition got sent
+           (I2C1_REG(CTL1) & UCTXSTP))        // Ensure stop condition got sent
         __delay_us((1000000L/I2C1_BAUDRATE) + 1);      
     if(!counter)
     {
@@ -891,7 +1312,7 @@ void I2C1_transmit(const void* data, uint16_t size, void (*handler)(void))
     #ifdef I2C1_MASTER
     uint16_t counter = 10;                  //(data byte + ack bit + sp bit)
     while (counter-- &&
-           I2C1_REG(CTL1 & UCTXSTP))        // Ensure stop condition got sent
+           (I2C1_REG(CTL1) & UCTXSTP))        // Ensure stop condition got sent
         __delay_us((1000000L/I2C1_BAUDRATE) + 1);      
     if(!counter)
     {
@@ -934,7 +1355,7 @@ void I2C1_receive(void* data, uint16_t* size, void (*handler)(void))
     #ifdef I2C1_MASTER
     uint16_t counter = 10;                  //(data byte + ack bit + sp bit)
     while (counter-- &&
-           I2C1_REG(CTL1 & UCTXSTP))        // Ensure stop condition got sent
+           (I2C1_REG(CTL1) & UCTXSTP))        // Ensure stop condition got sent
         __delay_us((1000000L/I2C1_BAUDRATE) + 1);      
     if(!counter)
     {
@@ -979,7 +1400,7 @@ void I2C1_request(uint8_t address,
 {
     uint16_t counter = 10;                  //(data byte + ack bit + sp bit)
     while (counter-- &&
-           I2C1_REG(CTL1 & UCTXSTP))        // Ensure stop condition got sent
+           (I2C1_REG(CTL1) & UCTXSTP))        // Ensure stop condition got sent
         __delay_us((1000000L/I2C1_BAUDRATE) + 1);      
     if(!counter)
     {
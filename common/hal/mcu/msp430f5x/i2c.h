@@ -19,6 +19,8 @@
 //!  29/06/2015 | Bogdan Kokotenko | Added macro for fast USCI unit change.
 //!  30/06/2015 | Bogdan Kokotenko | Added ISR based async functions.
 //!  30/11/2015 | Bogdan Kokotenko | Added I2C advanced initialization
+//!  18/10/2026 | Bogdan Kokotenko | Added I2C0 transaction engine
+//!  18/10/2026 | Bogdan Kokotenko | Engine: stop is awaited by tasklet
 //
 //******************************************************************************
 #ifndef I2C_H
@@ -31,6 +33,52 @@ extern "C" {
 // Include configurations
 #include "i2c_config.h"
     
+// ---------------- I2C transaction scripts ----------------
+
+//! Transaction step types
+typedef enum{
+    I2C_WRITE,          //!< (repeated) start, transmit data
+    I2C_WRITE_MORE,     //!< transmit data without restart (burst write)
+    I2C_READ            //!< (repeated) start, receive data
+}I2C_STEP_t;
+
+//! Transaction script states
+typedef enum{
+    I2C_SCRIPT_IDLE,        //!< never started
+    I2C_SCRIPT_ACTIVE,      //!< steps are executed
+    I2C_SCRIPT_DONE,        //!< completed successfully
+    I2C_SCRIPT_NACK,        //!< aborted by NACK of slave
+    I2C_SCRIPT_BUS_ERROR    //!< aborted by bus error (bus is recovered)
+}I2C_SCRIPT_STATE_t;
+
+//! Transaction step
+typedef struct _I2C_Step_t{
+    uint8_t     type;           //!< step type (I2C_STEP_t)
+    uint8_t     address;        //!< slave address (not used by burst write)
+    uint16_t    size;           //!< data size (write of zero size - probe)
+    void*       data;           //!< transmitted data or reception buffer
+}I2C_Step_t;
+
+//! Write step initializer
+#define I2C_STEP_WRITE(Address, Data, Size)                                    \
+                        { I2C_WRITE, (Address), (Size), (void*)(Data) }
+
+//! Burst write step initializer (continues the previous write)
+#define I2C_STEP_WRITE_MORE(Data, Size)                                        \
+                        { I2C_WRITE_MORE, 0, (Size), (void*)(Data) }
+
+//! Read step initializer
+#define I2C_STEP_READ(Address, Data, Size)                                     \
+                        { I2C_READ, (Address), (Size), (void*)(Data) }
+
+//! Transaction script (steps between start and stop conditions)
+typedef struct _I2C_Script_t{
+    const I2C_Step_t*   steps;      //!< steps
+    uint8_t             count;      //!< number of steps
+    volatile uint8_t    state;      //!< script state (I2C_SCRIPT_STATE_t)
+    uint8_t             done;       //!< completed steps (failed step index)
+}I2C_Script_t;
+
 // -------------------- I2C0 APIs --------------------
 
 //! Initialize I2C0
@@ -115,6 +163,40 @@ void I2C0_request(uint8_t address,
                   void* rxData, uint16_t rxSize,
                   void (*handler)(void));
 
+//! Run list of transaction scripts via I2C0
+//!
+//! Scripts are executed back-to-back from I2C0 ISR, each one from start
+//! to stop condition with repeated starts between its steps. Slave NACK
+//! aborts the script, bus error (arbitration lost, stuck condition) aborts
+//! the script and recovers the bus by I2C0_resetBus(), the list goes on
+//! with the next script in both cases.
+//!
+//! ISR does not wait for stop condition: script ending by write is done
+//! (or NACKed by the last byte) and the next script is started by tasklet
+//! when the stop is sent. Single byte read waits for the address in ISR,
+//! up to 20*(1000000/I2C0_BAUDRATE + 1) us (60 us at 400 kHz).
+//!
+//! \note Used only by master device. Do not call other rx/tx functions
+//!       till the handler is called.
+//! \param scripts  Scripts (one device transaction or polling list)
+//! \param count    Number of scripts
+//! \param handler  Function is called when all scripts are finished
+//! \return  true - scripts are started, false - engine is busy or script
+//!          is invalid
+bool I2C0_runScripts(I2C_Script_t* scripts, uint8_t count,
+                     void (*handler)(void));
+
+//! Check if I2C0 scripts are executed
+//!
+//! \return   true or false
+bool I2C0_isScriptRunning(void);
+
+//! Abort I2C0 scripts (e.g. by timeout of stretched clock)
+//!
+//! Active and queued scripts finish with bus error, bus is recovered and
+//! the handler is called.
+void I2C0_abortScripts(void);
+
 // -------------------- I2C1 APIs --------------------
 
 //! Initialize I2C1
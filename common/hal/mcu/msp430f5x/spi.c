@@ -13,6 +13,8 @@
 //!   1/03/2015 | Bogdan Kokotenko | Decreased SPI speed for higher reliability
 //!  27/12/2015 | Bogdan Kokotenko | Removed obsolete functions.
 //!  28/12/2015 | Bogdan Kokotenko | Improved SPI configuraion for async mode.
+//!  18/10/2026 | Bogdan Kokotenko | DMA full-duplex/TX-only/RX-only transfers,
+//!             |                  | polled fallback for short transfers
 //
 //******************************************************************************
 #include "project.h"
@@ -35,6 +37,9 @@
 //! SPI0 operation complete handler 
 static void (*SPI0_handler)(void);
 
+//! SPI0 transfer is in progress
+static volatile bool SPI0_busy;
+
 //! SPI0 operation complete handler wraper
 static void SPI0_operationComplete(void);
 #endif // SPI0_ASYNCHRONOUS
@@ -112,6 +117,12 @@ void SPI0_init(void)
 //------------------------------------------------------------------------------
 bool SPI0_isBusy(void)
 {
+    #ifdef SPI0_ASYNCHRONOUS
+        // check if DMA transfer complete
+        if(SPI0_busy)
+            return true;
+    #endif
+
     // check if transmission complete
 	return (!(SPI0_REG(IFG) & UCTXIFG));
 }
@@ -168,7 +179,7 @@ void SPI0_txByte(uint8_t dataByte)
 //------------------------------------------------------------------------------
 uint8_t SPI0_rxByte(void)
 {
-	while (!(SPI0_REG(IFG & UCTXIFG)));     // TX buffer ready?
+	while (!(SPI0_REG(IFG) & UCTXIFG));     // TX buffer ready?
     SPI0_REG(IFG) &= ~(UCRXIFG);            // clear RX flags
 	SPI0_REG(TXBUF) = 0x00;                 // write dummy data
 
@@ -189,9 +200,9 @@ uint8_t SPI0_rxByte(void)
 //------------------------------------------------------------------------------
 uint8_t SPI0_exchByte(uint8_t txByte)
 {
-    BYTE rxByte;
+    uint8_t rxByte;
   
-    while (!(SPI0_REG(IFG & UCTXIFG)));     // TX buffer ready?
+    while (!(SPI0_REG(IFG) & UCTXIFG));     // TX buffer ready?
     SPI0_REG(IFG) &= ~(UCRXIFG);            // clear RX flags
 	SPI0_REG(TXBUF) = txByte;               // write data
 
@@ -214,6 +225,74 @@ void SPI0_startTx(void)
     SPI0_REG(IFG) |= UCTXIFG;               // set IFG
 }
 
+//------------------------------------------------------------------------------
+// Function:	
+//              SPI0_poll()
+// Description:
+//! \brief      Exchange byte array via SPI0 by polling
+//!
+//! \param rx       received data (NULL - discarded)
+//! \param tx       transmitted data (NULL - dummy 0x00 is sent)
+//! \param size     number of bytes
+//------------------------------------------------------------------------------
+static void SPI0_poll(uint8_t* rx, const uint8_t* tx, uint16_t size)
+{
+    uint16_t index;
+    uint8_t rxByte;
+
+    for(index = 0; index < size; index++)
+    {
+        while (!(SPI0_REG(IFG) & UCTXIFG));	// TX buffer ready?
+        SPI0_REG(IFG) &= ~(UCRXIFG);        // clear RX flags
+        SPI0_REG(TXBUF) = tx ? tx[index] : 0x00; // write data
+
+        while (SPI0_REG(STAT) & UCBUSY);    // TX buffer ready?    
+        while (!(SPI0_REG(IFG) & UCRXIFG));	// RX buffer ready?
+        rxByte = SPI0_REG(RXBUF);           // read data byte
+        if(rx)
+            rx[index] = rxByte;
+    }
+}
+
+#ifdef SPI0_ASYNCHRONOUS
+//------------------------------------------------------------------------------
+// Function:	
+//              SPI0_start()
+// Description:
+//! \brief      Start transfer via SPI0, handler is called on completion
+//! \details    Receive channel reads every byte (NULL buffer - discarded),
+//!             so completion is signalled when the last byte is shifted in
+//!             and the bus is idle. The first byte is written by CPU: its
+//!             move to shift register is TXIFG edge for transmit channel.
+//!             Short transfers are polled and complete before return.
+//!
+//! \param rx       received data (NULL - discarded)
+//! \param tx       transmitted data (NULL - dummy 0x00 is sent)
+//! \param size     number of bytes
+//! \param handler  operation complete handler
+//------------------------------------------------------------------------------
+static void SPI0_start(uint8_t* rx, const uint8_t* tx, uint16_t size,
+                       void (*handler)(void))
+{
+    SPI0_handler = handler;
+    SPI0_busy = true;
+
+#if ( defined(SPI0_dmaWrite) && defined(SPI0_dmaRead) )
+    if(size > 1 && size >= SPI0_DMA_THRESHOLD)
+    {
+        (void)SPI0_REG(RXBUF);              // clear RXIFG
+        SPI0_dmaRead(rx, size, SPI0_operationComplete);
+        SPI0_dmaWrite(tx ? tx + 1 : NULL, size - 1, NULL);
+        SPI0_REG(TXBUF) = tx ? tx[0] : 0x00;// write the first byte
+        return;
+    }
+#endif
+
+    SPI0_poll(rx, tx, size);
+    SPI0_operationComplete();
+}
+#endif // SPI0_ASYNCHRONOUS
+
 //------------------------------------------------------------------------------
 // Function:	
 //              SPI0_exchange()
@@ -223,13 +302,12 @@ void SPI0_startTx(void)
 void SPI0_exchange(void* rxPacket, const void* txPacket,
                     uint16_t size,  void (*handler)(void))
 {
-#if ( defined(SPI0_dmaWrite) && defined(SPI0_dmaRead) )
-    SPI0_dmaRead(rxPacket, size, handler);
-    SPI0_dmaWrite(txPacket, size, NULL);
-    SPI0_startTx();
+#ifdef SPI0_ASYNCHRONOUS
+    SPI0_start((uint8_t*)rxPacket, (const uint8_t*)txPacket, size, handler);
 #else
-    // Use ISR
-    // TO DO...
+    SPI0_poll((uint8_t*)rxPacket, (const uint8_t*)txPacket, size);
+    if(handler)
+        handler();
 #endif
 }
 
@@ -238,18 +316,13 @@ void SPI0_exchange(void* rxPacket, const void* txPacket,
 //                  SPI0_transmit()
 // Description:
 //! \brief          Transmit byte array via SPI0 (UCA0)
+//! \details        Asynchronous mode discards received bytes, handler is
+//!                 called when the last byte is shifted out.
 //------------------------------------------------------------------------------
 #ifdef SPI0_ASYNCHRONOUS
 void SPI0_transmit(const void* data, uint16_t size, void (*handler)(void))
 {
-#ifdef SPI0_dmaWrite
-    SPI0_handler = handler;
-    SPI0_dmaWrite(data, size, SPI0_operationComplete);
-    SPI0_startTx();
-#else
-    // Use ISR
-    // TO DO...
-#endif
+    SPI0_start(NULL, (const uint8_t*)data, size, handler);
 }
 #else
 void SPI0_transmit(const void* data, uint16_t size)
@@ -268,36 +341,17 @@ void SPI0_transmit(const void* data, uint16_t size)
 // Function:	
 //                  SPI0_receive()
 // Description:
-//! \brief          Receive byte array via SPI0
+//! \brief          Receive byte array via SPI0 (dummy 0x00 is sent)
 //------------------------------------------------------------------------------
 #ifdef SPI0_ASYNCHRONOUS
 void SPI0_receive(void* data, uint16_t size, void (*handler)(void))
 {
-#if ( defined(SPI0_dmaWrite) && defined(SPI0_dmaRead) )
-    SPI0_handler = handler;
-    SPI0_dmaRead(data, size, SPI0_operationComplete);
-    SPI0_dmaWrite(data, size, NULL);
-    SPI0_startTx();
-#else
-    // Use ISR
-    // TO DO...
-#endif
+    SPI0_start((uint8_t*)data, NULL, size, handler);
 }
 #else
 void SPI0_receive(void* data, uint16_t size)
 {
-    uint16_t index;
-    
-    for(index = 0; index < size; index++)
-    {
-        while (!(SPI0_REG(IFG) & UCTXIFG));	// TX buffer ready?
-        SPI0_REG(IFG) &= ~(UCRXIFG);        // clear RX flags
-        SPI0_REG(TXBUF) = 0x00;             // write dummy data
-
-        while (SPI0_REG(STAT) & UCBUSY);    // TX buffer ready?    
-        while (!(SPI0_REG(IFG) & UCRXIFG));	// RX buffer ready?
-        ((uint8_t*)data)[index] = SPI0_REG(RXBUF); // read data byte
-    }
+    SPI0_poll((uint8_t*)data, NULL, size);
 }
 #endif // SPI0_ASYNCHRONOUS
 
@@ -307,9 +361,15 @@ void SPI0_receive(void* data, uint16_t size)
 //              SPI0_operationComplete()
 // Description:
 //! \brief      SPI0 operation complete handler wraper
+//! \details    SPI0 is free in handler, so it could start the next transfer.
 //------------------------------------------------------------------------------
 void SPI0_operationComplete(void)
 {
+    SPI0_busy = false;
+
+    if(!SPI0_handler)
+        return;
+
     #ifdef SPI_handlerCaller
         SPI_handlerCaller(SPI0_handler);
     #else
@@ -18,6 +18,7 @@
 //!  30/01/2014 | Bogdan Kokotenko | Initial draft
 //!  21/01/2015 | Bogdan Kokotenko | Added universal SPI APIs
 //!  30/11/2015 | Bogdan Kokotenko | Improved SPI APIs
+//!  18/10/2026 | Bogdan Kokotenko | Added SPI0 DMA threshold
 //
 //******************************************************************************
 #ifndef SPI_H
@@ -30,6 +31,13 @@ extern "C" {
 // Include configurations
 #include "spi_config.h"    
 
+//! SPI0 asynchronous transfers shorter than threshold are polled
+//! (DMA setup cost is higher than transfer time), handler is called
+//! before return
+#ifndef SPI0_DMA_THRESHOLD
+#define SPI0_DMA_THRESHOLD      8
+#endif
+
 //! SPI chip select initialization
 #define SPI_chipInit(port, pin)        GPIO_setOut(port, pin)
 
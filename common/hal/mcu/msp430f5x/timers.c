@@ -14,6 +14,7 @@
 //!   2/04/2015 | Bogdan Kokotenko | Fixed wrong timer interrupt handling
 //!  05/10/2015 | Bogdan Kokotenko | Fixed clock() timer overflow issue
 //!  13/01/2016 | Bogdan Kokotenko | Improved timers settings
+//!  18/10/2026 | Bogdan Kokotenko | Added CPU load meter hooks to TIMER0 ISRs
 //
 //******************************************************************************
 #include "project.h"
@@ -24,6 +25,7 @@
 #include "devtime.h"
 #include "timers.h"
 #include "thread.h"
+#include "load.h"
 
 // Warn of inappropriate MCU core selection
 #if ( !defined (_MSP430F5x_HAL_) )
@@ -368,13 +370,17 @@ void TIMER0_stop4(void)
 #pragma vector=TIMER0_A0_VECTOR
 __interrupt void TIMER0_isr0(void)
 {
+    LOAD_enterIsr();
+
     TA0CCTL0 &= ~CCIFG;                         // clear CCR0 IFG
     TA0CCR0 += TIMER0_context[0].compare;       // update CCR
         
     #ifdef SysTick_Handler
         SysTick_Handler();
     #endif //SysTick_Handler
-        
+
+    LOAD_leaveIsr();
+
     #ifdef USE_LOW_POWER_MODE
         LPM_disable();                              // Wake-up MCU
     #endif 
@@ -389,6 +395,8 @@ __interrupt void TIMER0_isr0(void)
 #pragma vector=TIMER0_A1_VECTOR
 __interrupt void TIMER0_isr1(void)
 {
+    LOAD_enterIsr();
+
     if(TA0CCTL1 & CCIFG)
     {
         TA0CCTL1 &= ~CCIFG;                     // clear CCR IFG
@@ -433,7 +441,9 @@ __interrupt void TIMER0_isr1(void)
             TIMER0_Overflow();
         #endif //TIMER0_Overflow
     }
-   
+
+    LOAD_leaveIsr();
+
     #ifdef USE_LOW_POWER_MODE
         LPM_disable();                           // Wake-up MCU
     #endif 
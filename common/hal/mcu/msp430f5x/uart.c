@@ -15,6 +15,9 @@
 //!  26/04/2015 | Bogdan Kokotenko | Fixed issue with RS485 RX/TX switching 
 //!  02/10/2015 | Bogdan Kokotenko | Added framing error detection
 //!  05/10/2015 | Bogdan Kokotenko | Added RXIFG checking if DMA hang off
+//!  18/10/2026 | Bogdan Kokotenko | Added continuous reception by DMA stream
+//!  18/10/2026 | Bogdan Kokotenko | Added baud-aware idle line detection
+//!  18/10/2026 | Bogdan Kokotenko | TX drain delay at current baudrate
 //
 //******************************************************************************
 #include "project.h"
@@ -25,6 +28,7 @@
 #include "uart.h"
 #include "dma.h"
 #include "task.h"
+#include "stimer.h"
 
 // Warn of inappropriate MCU core selection
 #if ( !defined (_MSP430F5x_HAL_) )
@@ -176,9 +180,21 @@ const struct UART_BaudrateConfig_t{
     #endif
 };
 
+//! UART baudrate values (bps)
+static const uint32_t UART_BaudrateValue[] = {
+    [UART_9600] =   9600,
+    [UART_115200] = 115200,
+    [UART_921600] = 921600
+};
+
 // Check if UART0 enabled
 #ifdef UART0_ENABLED
 
+//! Idle line time ending the frame (bit times), 3.5 characters of 10 bits
+#ifndef UART0_IDLE_BITS
+#define UART0_IDLE_BITS         35
+#endif
+
 //! Initialize TX pin
 #define UART0_TX_init()         GPIO_func2(UART0_TX_PIN)
 //! Initialize RX pin
@@ -200,6 +216,34 @@ static bool UART0_rxFramingErrorFlag = false;
 //! UART0 frame received handler
 static void (*UART0_frameReceivedHandler)(bool);
 
+//! UART0 baudrate (bps)
+static uint32_t UART0_baudrate = UART0_BAUDRATE;
+
+#ifdef UART0_IDLE_TIMER
+
+//! Idle timer control word, written by DMA on every received character:
+//! timer is cleared and started in up mode
+static uint16_t UART0_idleCtl;
+
+//! Idle time (timer ticks)
+static uint16_t UART0_idleTicks;
+
+//! Size of last received frame
+static uint16_t UART0_rxCount;
+
+//! Start idle line detection, timer waits for the first character
+static void UART0_startIdleTimer(void);
+
+//! Stop idle line detection
+static void UART0_stopIdleTimer(void);
+
+#else
+
+//! Framing timeout (ms)
+static int32_t UART0_rxTimeout;
+
+#endif // UART0_IDLE_TIMER
+
 //! Handler for frame complete
 static void UART0_frameComplete(void);
 
@@ -226,6 +270,24 @@ void UART0_init(UART_BAUDRATE_t baud)
     UART0_REG(BR0) = UART_BaudrateConfig[baud].br0;
     UART0_REG(BR1) = UART_BaudrateConfig[baud].br1;
     UART0_REG(MCTL) = UART_BaudrateConfig[baud].mctl;
+    UART0_baudrate = UART_BaudrateValue[baud];
+
+    #ifdef UART0_IDLE_TIMER
+    {
+        // Idle time in SMCLK ticks, divider keeps it in 16 bits
+        uint32_t ticks = (UART0_IDLE_BITS*(uint32_t)SMCLK_FREQ)/UART0_baudrate;
+        uint16_t divider = ID_0;
+
+        while(ticks > 0xFFFF && divider != ID_3)
+        {
+            ticks >>= 1;
+            divider += ID_1;
+        }
+        UART0_idleTicks = (ticks > 0xFFFF) ? 0xFFFF : (uint16_t)ticks;
+        UART0_idleCtl = TASSEL__SMCLK + divider + MC_1 + TACLR;
+        UART0_stopIdleTimer();
+    }
+    #endif // UART0_IDLE_TIMER
             
     // Initialize GPIO for RS485 RDE control
     #ifdef UART0_RS485_RDE_PIN
@@ -289,7 +351,11 @@ void UART0_startTx(void)
 //------------------------------------------------------------------------------
 void UART0_reset(void)
 {
-    UART0_stopTimeoutTimer(&UART0_checkFramingError);
+    #ifdef UART0_IDLE_TIMER
+        UART0_stopIdleTimer();
+    #else
+        UART0_stopTimeoutTimer(&UART0_checkFramingError);
+    #endif // UART0_IDLE_TIMER
     UART0_resetBuffer();
 }
                   
@@ -319,9 +385,11 @@ void UART0_send(const void* packet, uint16_t size, void (*handler)(void))
 //------------------------------------------------------------------------------
 void UART0_receive(void* packet, uint16_t size, void (*handler)(bool))
 {
-    // wait till transmission complete
+    // wait till transmission complete (8 bits at current baudrate)
     //while (!(UART0_REG(IFG)&UCTXIFG));    // UART0 TX buffer ready?
-    __delay_us((8*1000000L)/UART0_BAUDRATE);
+    uint16_t counter = (uint16_t)((8*1000000L)/UART0_baudrate) + 1;
+    while(counter--)
+        __delay_us(1);
     
     #ifdef UART0_RS485_RDE_PIN
         UART0_RS485_receive();
@@ -339,13 +407,15 @@ void UART0_receive(void* packet, uint16_t size, void (*handler)(bool))
     
     UART0_rxFramingErrorFlag = false;
     
-    // Proper timeout depends on baudrate and packet size
-    // For baudrate = 921600, size = 0..128 => timeout = ~1.5 ms OK
-    // For baudrate = 921600, size = 0..512 => timeout = ~7 ms OK
-    if(UART0_rxFrameSize < 128)
-        UART0_startTimeoutTimer(&UART0_checkFramingError, 2);
-    else
-        UART0_startTimeoutTimer(&UART0_checkFramingError, 7);
+    #ifdef UART0_IDLE_TIMER
+        // Frame ends by idle line, detected by timer without CPU load
+        UART0_startIdleTimer();
+    #else
+        // Timeout covers frame and idle time at current baudrate
+        UART0_rxTimeout = (((uint32_t)size*10 + UART0_IDLE_BITS)*1000L)/
+                          UART0_baudrate + 1;
+        UART0_startTimeoutTimer(&UART0_checkFramingError, UART0_rxTimeout);
+    #endif // UART0_IDLE_TIMER
 }
                   
 //------------------------------------------------------------------------------
@@ -356,8 +426,7 @@ void UART0_receive(void* packet, uint16_t size, void (*handler)(bool))
 //------------------------------------------------------------------------------
 void UART0_checkFramingError(void)
 {
-    IntFlag_t intState;
-    EnterCriticalSection(intState);
+    EnterCriticalSection();
 
     if(UART0_rxFramingErrorFlag)
     {
@@ -373,16 +442,12 @@ void UART0_checkFramingError(void)
             UART0_rxFramingErrorFlag = true;
         }
 
-        // Proper timeout depends on baudrate and packet size
-        // For baudrate = 921600, size = 0..128 => timeout = ~1.5 ms OK
-        // For baudrate = 921600, size = 0..512 => timeout = ~7 ms OK
-        if(UART0_rxFrameSize < 128)
-            UART0_startTimeoutTimer(&UART0_checkFramingError, 2);
-        else
-            UART0_startTimeoutTimer(&UART0_checkFramingError, 7);
+        #ifndef UART0_IDLE_TIMER
+            UART0_startTimeoutTimer(&UART0_checkFramingError, UART0_rxTimeout);
+        #endif // UART0_IDLE_TIMER
     }
     
-    LeaveCriticalSection(intState);
+    LeaveCriticalSection();
 }
                   
 //------------------------------------------------------------------------------
@@ -393,22 +458,162 @@ void UART0_checkFramingError(void)
 //------------------------------------------------------------------------------
 void UART0_frameComplete(void)
 {
-    IntFlag_t intState;
-    EnterCriticalSection(intState);
+    EnterCriticalSection();
     
     UART0_rxFramingErrorFlag = false;
+
+    #ifdef UART0_IDLE_TIMER
+        UART0_rxCount = UART0_rxFrameSize;
+        UART0_stopIdleTimer();
+    #else
+        UART0_stopTimeoutTimer(&UART0_checkFramingError);
+    #endif // UART0_IDLE_TIMER
     UART0_rxFrameSize = 0;
     
-    UART0_stopTimeoutTimer(&UART0_checkFramingError);
     if(UART0_frameReceivedHandler)
     {
         UART0_frameReceivedHandler(true);
         UART0_frameReceivedHandler = NULL;
     }
     
-    LeaveCriticalSection(intState);
+    LeaveCriticalSection();
+}
+
+#ifdef UART0_IDLE_TIMER
+
+//------------------------------------------------------------------------------
+// Function:	
+//             UART0_startIdleTimer()
+// Description:
+//! \brief     Start idle line detection
+//! \details   DMA writes UART0_idleCtl to timer control on every received
+//!            character: timer is cleared and runs in up mode to CCR0. So
+//!            compare interrupt happens once, idle time after the last
+//!            character, and timer does not run till the first one.
+//------------------------------------------------------------------------------
+static void UART0_startIdleTimer(void)
+{
+    UART0_IDLE_TIMER(CTL) = MC_0;                   // stopped
+    UART0_IDLE_TIMER(CCR0) = UART0_idleTicks;       // idle time
+    UART0_IDLE_TIMER(CCTL0) = CCIE;                 // enable CCR0 interrupt
+    UART0_dmaIdleRestart(&UART0_IDLE_TIMER(CTL), &UART0_idleCtl);
+}
+
+//------------------------------------------------------------------------------
+// Function:	
+//             UART0_stopIdleTimer()
+// Description:
+//! \brief     Stop idle line detection
+//------------------------------------------------------------------------------
+static void UART0_stopIdleTimer(void)
+{
+    UART0_dmaIdleStop();                            // no more restarts
+    UART0_IDLE_TIMER(CTL) = MC_0;                   // stop timer
+    UART0_IDLE_TIMER(CCTL0) = 0;                    // clear CCIE and CCIFG
+}
+
+//------------------------------------------------------------------------------
+// Function:	
+//             UART0_getReceivedSize()
+// Description:
+//! \brief     Size of last received frame (valid in frame handler)
+//------------------------------------------------------------------------------
+uint16_t UART0_getReceivedSize(void)
+{
+    return UART0_rxCount;
+}
+
+//------------------------------------------------------------------------------
+// Function:	
+//              UART0_idleIsr()
+// Description:
+//! \brief      Idle line after frame shorter than expected
+//------------------------------------------------------------------------------
+#pragma vector=UART0_IDLE_TIMER_VECTOR
+__interrupt void UART0_idleIsr(void)
+{
+    UART0_stopIdleTimer();
+
+    UART0_rxCount = UART0_rxFrameSize - UART0_getRxBufferSize();
+    UART0_rxFrameSize = 0;
+    UART0_resetBuffer();
+
+    if(UART0_frameReceivedHandler)
+    {
+        UART0_frameReceivedHandler(false);
+        UART0_frameReceivedHandler = NULL;
+    }
+
+    #ifdef USE_LOW_POWER_MODE
+        LPM_disable();                      // Wake-up MCU
+    #endif
+}
+
+#endif // UART0_IDLE_TIMER
+
+#ifdef UART0_dmaStream
+
+//! UART0 stream block handler (task)
+static void (*UART0_streamHandler)(void);
+
+//------------------------------------------------------------------------------
+// Function:	
+//             UART0_streamBlock()
+// Description:
+//! \brief     Stream block is filled (DMA ISR): post handler task
+//------------------------------------------------------------------------------
+static void UART0_streamBlock(void)
+{
+    if(UART0_streamHandler)
+        TASK_createUnique(UART0_streamHandler);
 }
 
+//------------------------------------------------------------------------------
+// Function:	
+//             UART0_startStream()
+// Description:
+//! \brief     Start continuous reception via UART0
+//! \details   Blocks are taken by UART0_getStreamBlock() and released by
+//!            UART0_releaseStreamBlock() (uart_config.h) before the other
+//!            block is filled: size characters time.
+//------------------------------------------------------------------------------
+bool UART0_startStream(uint8_t* buffer, uint16_t size, void (*handler)(void))
+{
+    // Stream is already running
+    if(UART0_streamHandler)
+        return false;
+
+    #ifdef UART0_RS485_RDE_PIN
+        UART0_RS485_receive();
+    #endif // UART0_RS485_RDE_PIN
+
+    // Stop single packet reception
+    UART0_reset();
+    UART0_streamHandler = handler;
+
+    UART0_REG(IFG) &= ~UCRXIFG;                 // clear UART0 IFG
+    if(!UART0_dmaStream(buffer, size, UART0_streamBlock))
+    {
+        UART0_streamHandler = NULL;
+        return false;
+    }
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// Function:	
+//             UART0_stopStream()
+// Description:
+//! \brief     Stop continuous reception via UART0
+//------------------------------------------------------------------------------
+void UART0_stopStream(void)
+{
+    UART0_dmaStreamStop();
+    UART0_streamHandler = NULL;
+}
+
+#endif // UART0_dmaStream
+
 #endif // UART0_ENABLED
 
 //------------------------------------------------------------------------------
@@ -18,6 +18,8 @@
 //!  16/08/2014 | Bogdan Kokotenko | Initial draft
 //!  16/04/2015 | Bogdan Kokotenko | Added RS845 control macros
 //!  02/12/2015 | Bogdan Kokotenko | Added advanced UART configuration
+//!  18/10/2026 | Bogdan Kokotenko | Added continuous reception by DMA stream
+//!  18/10/2026 | Bogdan Kokotenko | Added baud-aware idle line detection
 //
 //******************************************************************************
 #ifndef UART_H
@@ -58,17 +60,32 @@ uint8_t UART0_getchar(void);	// for synchronous mode
 //! Send packet via UART0
 void UART0_send(const void* packet, uint16_t size, void (*handler)(void));
 
-//! Receive packet via UART0
+//! Receive packet via UART0, handler gets false if the frame is shorter:
+//! line is idle for UART0_IDLE_BITS (3.5 characters) before size bytes
 void UART0_receive(void* packet, uint16_t size, void (*handler)(bool));
 
+#ifdef UART0_IDLE_TIMER
+//! Size of last received frame (valid in receive handler)
+uint16_t UART0_getReceivedSize(void);
+#endif // UART0_IDLE_TIMER
+
+#ifdef UART0_dmaStream
+//! Start continuous reception to buffer of 2*size bytes (two blocks),
+//! handler is posted as task for every filled block
+bool UART0_startStream(uint8_t* buffer, uint16_t size, void (*handler)(void));
+
+//! Stop continuous reception
+void UART0_stopStream(void);
+#endif // UART0_dmaStream
+
 //------------------------------------------------------------------------------
 // UART0 callbacks 
 
 #define UART0_startTimeoutTimer(Handler, Timeout)   \
-                            TASK_SCHEDULE_create(Handler, Timeout)
+                            STIMER_add(Handler, Timeout)
 
 #define UART0_stopTimeoutTimer(Handler)             \
-                            TASK_SCHEDULE_delete(Handler)
+                            STIMER_remove(Handler)
 
 #endif // UART0_ENABLED
 
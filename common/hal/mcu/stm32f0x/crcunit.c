@@ -0,0 +1,134 @@
+//******************************************************************************
+// Copyright (C) 2026 Bogdan Kokotenko
+//
+//	File description:
+//! \file       hal/mcu/stm32f0x/crcunit.c
+//! \brief      STM32F0x CRC calculation unit
+//!
+//! \details    Unit calculates MSB-first CRC, so input words are bit
+//!             reversed (REV_IN) and so is the output (REV_OUT) to get
+//!             reflected CRC32. Calculation context of lib/crc is the
+//!             reflected remainder, hence it is loaded to INIT reversed.
+//!
+//!*****************************************************************************
+//! __Revisions:__
+//!  Date       | Author           | Comments
+//!  ---------- | ---------------- | ----------------
+//!  18/10/2026 | Bogdan Kokotenko | Initial draft
+//!
+//******************************************************************************
+#include "project.h"
+#include "types.h"
+#include "hal.h"
+#include "crcunit.h"
+
+// Warn of inappropriate MCU core selection
+#if ( !defined (_STM32F0X_HAL_) )
+#warning CRCUNIT: Unknown MCU core, check HAL configuration!
+#else
+
+//! CRC unit is in use
+static bool CRCUNIT_busy;
+
+//------------------------------------------------------------------------------
+// Function:
+//              CRCUNIT_reverse()
+// Description:
+//! \brief      Reverse bits of 32-bit word (Cortex-M0 has no RBIT)
+//------------------------------------------------------------------------------
+static uint32_t CRCUNIT_reverse(uint32_t value)
+{
+    value = ((value >> 1) & 0x55555555) | ((value & 0x55555555) << 1);
+    value = ((value >> 2) & 0x33333333) | ((value & 0x33333333) << 2);
+    value = ((value >> 4) & 0x0F0F0F0F) | ((value & 0x0F0F0F0F) << 4);
+    return __REV(value);
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              CRCUNIT_crc32()
+// Description:
+//! \brief      Feed data to CRC32 calculation
+//!
+//! \param *crc     current CRC value (context), updated
+//! \param *data    pointer to word aligned data chunk
+//! \param size     size of data chunk
+//! \return         number of processed bytes (from the chunk start),
+//!                 0 - if the unit is busy
+//------------------------------------------------------------------------------
+uint32_t CRCUNIT_crc32(uint32_t* crc, const void* data, uint32_t size)
+{
+    const uint32_t* dataPtr = (const uint32_t*)data;
+    uint32_t words = size/4;
+    uint32_t count;
+#if (CRCUNIT_DMA_MIN_SIZE > 0)
+    uint32_t status;
+#endif
+
+    // Take the unit
+    EnterCriticalSection();
+    if(CRCUNIT_busy)
+    {
+        LeaveCriticalSection();
+        return 0;
+    }
+    CRCUNIT_busy = true;
+    LeaveCriticalSection();
+
+    // Reflected CRC32: words bit reversed on input and output
+    RCC->AHBENR |= RCC_AHBENR_CRCEN;
+    CRC->CR = CRC_CR_REV_IN_0 | CRC_CR_REV_IN_1 | CRC_CR_REV_OUT;
+    CRC->INIT = CRCUNIT_reverse(*crc);
+    CRC->CR |= CRC_CR_RESET;
+
+#if (CRCUNIT_DMA_MIN_SIZE > 0)
+    if(size >= CRCUNIT_DMA_MIN_SIZE)
+    {
+        // Feed by DMA: up to 65535 words per transfer
+        RCC->AHBENR |= RCC_AHBENR_DMAEN;
+        while(words)
+        {
+            count = (words > 0xFFFF) ? 0xFFFF : words;
+
+            CRCUNIT_DMA_CHANNEL->CCR = 0;
+            CRCUNIT_DMA_CHANNEL->CPAR = (uint32_t)&CRC->DR;
+            CRCUNIT_DMA_CHANNEL->CMAR = (uint32_t)dataPtr;
+            CRCUNIT_DMA_CHANNEL->CNDTR = count;
+            CRCUNIT_DMA_CHANNEL->CCR = DMA_CCR_MEM2MEM | DMA_CCR_DIR |
+                                       DMA_CCR_MINC | DMA_CCR_PSIZE_1 |
+                                       DMA_CCR_MSIZE_1 | DMA_CCR_EN;
+            while(!(DMA1->ISR & (CRCUNIT_DMA_TCIF | CRCUNIT_DMA_TEIF)));
+            status = DMA1->ISR;
+            DMA1->IFCR = CRCUNIT_DMA_CGIF;
+            CRCUNIT_DMA_CHANNEL->CCR = 0;
+
+            // Context is kept, so data is processed by tables
+            if(status & CRCUNIT_DMA_TEIF)
+            {
+                CRCUNIT_busy = false;
+                return 0;
+            }
+
+            dataPtr += count;
+            words -= count;
+        }
+    }
+    else
+#endif
+    {
+        // Feed by CPU
+        for(count = words; count; count--)
+            CRC->DR = *dataPtr++;
+    }
+
+    *crc = CRC->DR;
+    CRCUNIT_busy = false;
+
+    return size & ~(uint32_t)3;
+}
+
+#endif // _STM32F0X_HAL_
+
+//******************************************************************************
+// End of file
+//******************************************************************************
@@ -0,0 +1,70 @@
+//******************************************************************************
+// Copyright (C) 2026 Bogdan Kokotenko
+//
+//! \addtogroup stm32f0x_hal
+//! @{
+//******************************************************************************
+//   File description:
+//! \file   hal/mcu/stm32f0x/crcunit.h
+//! \brief  STM32F0x CRC calculation unit APIs
+//!
+//! \details Backend of lib/crc (USE_CRC_UNIT) for CRC32 (IEEE 802.3),
+//!          the only polynomial of STM32F03x/F04x/F05x CRC unit.
+//!          Word aligned data is written to the unit by CPU or, starting
+//!          from CRCUNIT_DMA_MIN_SIZE bytes, by memory-to-memory DMA.
+//!          The unit is shared: if it is busy (e.g. used by interrupted
+//!          code) nothing is processed and lib/crc falls back to tables.
+//!
+//!*****************************************************************************
+//! __Revisions:__
+//!  Date       | Author           | Comments
+//!  ---------- | ---------------- | --------------------------------
+//!  18/10/2026 | Bogdan Kokotenko | Initial draft
+//!
+//******************************************************************************
+#ifndef CRCUNIT_H
+#define CRCUNIT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Include configurations
+#include "crcunit_config.h"
+
+//! CRC unit supports CRC32 (IEEE 802.3)
+#define CRCUNIT_CRC32
+
+//! Data alignment required by CRC unit (bytes)
+#define CRCUNIT_ALIGN           4
+
+//! Minimal data chunk passed to CRC unit (bytes)
+#ifndef CRCUNIT_MIN_SIZE
+#define CRCUNIT_MIN_SIZE        16
+#endif
+
+//! Minimal data chunk fed by DMA (0 - DMA is not used)
+#ifndef CRCUNIT_DMA_MIN_SIZE
+#define CRCUNIT_DMA_MIN_SIZE    256
+#endif
+
+// DMA channel selection (memory-to-memory, any free channel)
+#ifndef CRCUNIT_DMA_CHANNEL
+#define CRCUNIT_DMA_CHANNEL     DMA1_Channel5
+#define CRCUNIT_DMA_TCIF        DMA_ISR_TCIF5
+#define CRCUNIT_DMA_TEIF        DMA_ISR_TEIF5
+#define CRCUNIT_DMA_CGIF        DMA_IFCR_CGIF5
+#endif
+
+//! Feed data to CRC32 calculation, return number of processed bytes
+uint32_t CRCUNIT_crc32(uint32_t* crc, const void* data, uint32_t size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // CRCUNIT_H
+//! @}
+//******************************************************************************
+// End of file
+//******************************************************************************
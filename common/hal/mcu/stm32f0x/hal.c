@@ -10,11 +10,13 @@
 //!  Date       | Author           | Comments			
 //!  ---------- | ---------------- | ----------------
 //!  22/05/2016 | Bogdan Kokotenko | Initial draft
+//!  18/10/2026 | Bogdan Kokotenko | Added startup stack painting
 //
 //******************************************************************************
 #include "project.h"
 #include "types.h"
 #include "hal.h"
+#include "stack.h"
 
 // Warn of inappropriate MCU core selection
 #if ( !defined (_STM32F0X_HAL_) )
@@ -32,6 +34,9 @@ uint16_t GINT_criticalNesting = 0;
 //------------------------------------------------------------------------------
 void SystemInit(void)
 {
+    // Fill free stack for high-water mark measurement
+    SYS_stackPaint();
+
     // Enabled events and all interrupts can wakeup the processor
     SCB->SCR |= SCB_SCR_SEVONPEND_Msk;
 }
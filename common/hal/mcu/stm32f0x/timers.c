@@ -10,6 +10,7 @@
 //!  Date       | Author           | Comments			
 //!  ---------- | ---------------- | --------------------------------
 //!  22/05/2016 | Bogdan Kokotenko | Initial draft
+//!  18/10/2026 | Bogdan Kokotenko | Added CPU load meter hooks to SysTick
 //
 //******************************************************************************
 #include "project.h"
@@ -19,6 +20,7 @@
 #include "devtime.h"
 #include "timers.h"
 #include "task.h"
+#include "load.h"
 
 // Warn of inappropriate MCU core selection
 #if ( !defined (_STM32F0X_HAL_) )
@@ -94,9 +96,13 @@ void SysTick_init(uint32_t tickInterval)
 //------------------------------------------------------------------------------
 void SysTick_Handler(void)
 {
+    LOAD_enterIsr();
+
 #ifdef Systick_OverflowHandler
     Systick_OverflowHandler();
 #endif
+
+    LOAD_leaveIsr();
 }
 
 //------------------------------------------------------------------------------
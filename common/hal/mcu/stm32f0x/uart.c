@@ -10,6 +10,8 @@
 //!  Date       | Author           | Comments			
 //!  ---------- | ---------------- | ----------------
 //!  22/05/2016 | Bogdan Kokotenko | Initial draft
+//!  18/10/2026 | Bogdan Kokotenko | Added DMA transmission and circular DMA
+//!             |                  | reception with idle line interrupt
 //
 //******************************************************************************
 #include "project.h"
@@ -17,7 +19,6 @@
 #include "hal.h"
 #include "gpio.h"
 #include "clocks.h"
-#include "slip.h"
 #include "uart.h"
 
 // Warn of inappropriate MCU core selection
@@ -25,6 +26,36 @@
 #warning UART: Unknown MCU core, check HAL configuration!
 #else
 
+#ifdef UART_DMA_ENABLED
+
+//! USART1 TX DMA channel
+#define UART_TX_DMA             DMA1_Channel2
+//! USART1 RX DMA channel
+#define UART_RX_DMA             DMA1_Channel3
+
+//! DMA address register value
+#ifndef DMA_ADDRESS
+#define DMA_ADDRESS(Address)    ((uint32_t)(Address))
+#endif
+
+//! UART transmission state
+static struct UART_Tx_t{
+    void (*handler)(void);          //!< packet sent handler
+}UART_tx;
+
+//! UART circular reception state
+static struct UART_Rx_t{
+    uint8_t*    buffer;             //!< circular buffer
+    uint16_t    size;               //!< buffer size
+    uint16_t    head;               //!< DMA position at last update
+    uint16_t    tail;               //!< first unread byte
+    uint16_t    count;              //!< unread bytes
+    uint16_t    lost;               //!< bytes overwritten before read
+    void (*handler)(void);          //!< data received handler
+}UART_rx;
+
+#endif // UART_DMA_ENABLED
+
 //------------------------------------------------------------------------------
 // Function:	
 //				UART0_init()
@@ -45,19 +76,263 @@ void UART_init(void)
     RCC->APB2ENR |= RCC_APB2ENR_USART1EN;// Enable the peripheral clock USART1
     USART1->BRR = (PCLK1_FREQ/UART_BAUDRATE);  // set baudrate
     //USART1->CR2 = (USART_CR2_MSBFIRST+USART_CR2_CLKEN+USART_CR2_LBCL);
+#ifdef UART_DMA_ENABLED
+    RCC->AHBENR |= RCC_AHBENR_DMA1EN;   // Enable the peripheral clock DMA1
+    USART1->CR3 = (USART_CR3_DMAT+USART_CR3_DMAR);  // DMA requests
+    USART1->CR1 = (USART_CR1_TE+USART_CR1_RE+USART_CR1_UE);
+
+    // Configure DMA IT
+    NVIC_SetPriority(DMA1_Channel2_3_IRQn, 0);
+    NVIC_EnableIRQ(DMA1_Channel2_3_IRQn);
+#else
     USART1->CR1 = (USART_CR1_TE+USART_CR1_RXNEIE+USART_CR1_RE+USART_CR1_UE);
+#endif
 
     // Polling idle frame Transmission w/o clock
     while ((USART1->ISR & USART_ISR_TC) != USART_ISR_TC);
 
     USART1->ICR |= USART_ICR_TCCF;      // Clear TC flag
+#ifndef UART_DMA_ENABLED
     USART1->CR1 |= USART_CR1_TCIE;      // Enable TC interrupt
+#endif
     
     // Configure IT
     NVIC_SetPriority(USART1_IRQn, 0);   // Set priority for USART1_IRQn
     NVIC_EnableIRQ(USART1_IRQn);        // Enable USART1_IRQn
 }
 
+#ifdef UART_DMA_ENABLED
+
+//------------------------------------------------------------------------------
+// Function:	
+//              UART_send()
+// Description:
+//! \brief      Send packet by DMA
+//! \details    Handler is called from ISR when the last stop bit is sent
+//!             (USART TC). Packet has to stay valid till then.
+//------------------------------------------------------------------------------
+void UART_send(const void* packet, uint16_t size, void (*handler)(void))
+{
+    EnterCriticalSection();
+
+    // Abort previous transmission
+    UART_TX_DMA->CCR &= ~DMA_CCR_EN;
+    USART1->CR1 &= ~USART_CR1_TCIE;
+    DMA1->IFCR = DMA_IFCR_CGIF2;
+    UART_tx.handler = handler;
+
+    UART_TX_DMA->CPAR = DMA_ADDRESS(&USART1->TDR);
+    UART_TX_DMA->CMAR = DMA_ADDRESS(packet);
+    UART_TX_DMA->CNDTR = size;
+    UART_TX_DMA->CCR = (DMA_CCR_DIR +   // memory to peripheral
+                        DMA_CCR_MINC +  // memory increment, bytes
+                        DMA_CCR_TCIE);  // transfer complete interrupt
+    UART_TX_DMA->CCR |= DMA_CCR_EN;
+
+    LeaveCriticalSection();
+}
+
+//------------------------------------------------------------------------------
+// Function:	
+//              UART_rxUpdate()
+// Description:
+//! \brief      Account bytes written by DMA since last update
+//! \details    Called from ISR or critical section. Interrupts on half and
+//!             full buffer guarantee update every size/2 bytes.
+//------------------------------------------------------------------------------
+static void UART_rxUpdate(void)
+{
+    uint16_t head = UART_rx.size - (uint16_t)UART_RX_DMA->CNDTR;
+    uint16_t received;
+
+    if(head >= UART_rx.size)
+        head = 0;
+    received = (head >= UART_rx.head) ? (head - UART_rx.head) :
+                                        (head + UART_rx.size - UART_rx.head);
+    UART_rx.head = head;
+    UART_rx.count += received;
+
+    // Buffer overwritten: the oldest data is lost
+    if(UART_rx.count > UART_rx.size)
+    {
+        UART_rx.lost += UART_rx.count - UART_rx.size;
+        UART_rx.count = UART_rx.size;
+        UART_rx.tail = head;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Function:	
+//              UART_receive()
+// Description:
+//! \brief      Start continuous reception by circular DMA
+//! \details    Handler is called from ISR on idle line, half and full
+//!             buffer; data are taken by UART_read().
+//------------------------------------------------------------------------------
+void UART_receive(void* buffer, uint16_t size, void (*handler)(void))
+{
+    EnterCriticalSection();
+
+    UART_RX_DMA->CCR &= ~DMA_CCR_EN;
+    DMA1->IFCR = DMA_IFCR_CGIF3;
+
+    UART_rx.buffer = (uint8_t*)buffer;
+    UART_rx.size = size;
+    UART_rx.head = 0;
+    UART_rx.tail = 0;
+    UART_rx.count = 0;
+    UART_rx.lost = 0;
+    UART_rx.handler = handler;
+
+    UART_RX_DMA->CPAR = DMA_ADDRESS(&USART1->RDR);
+    UART_RX_DMA->CMAR = DMA_ADDRESS(buffer);
+    UART_RX_DMA->CNDTR = size;
+    UART_RX_DMA->CCR = (DMA_CCR_MINC +  // memory increment, bytes
+                        DMA_CCR_CIRC +  // circular mode
+                        DMA_CCR_HTIE +  // half transfer interrupt
+                        DMA_CCR_TCIE);  // transfer complete interrupt
+    UART_RX_DMA->CCR |= DMA_CCR_EN;
+
+    // Idle line interrupt ends the frame
+    USART1->ICR = (USART_ICR_IDLECF+USART_ICR_ORECF);
+    USART1->CR1 |= USART_CR1_IDLEIE;
+
+    LeaveCriticalSection();
+}
+
+//------------------------------------------------------------------------------
+// Function:	
+//              UART_stopReceive()
+// Description:
+//! \brief      Stop reception
+//------------------------------------------------------------------------------
+void UART_stopReceive(void)
+{
+    EnterCriticalSection();
+
+    USART1->CR1 &= ~USART_CR1_IDLEIE;
+    UART_RX_DMA->CCR &= ~DMA_CCR_EN;
+    DMA1->IFCR = DMA_IFCR_CGIF3;
+    UART_rx.handler = NULL;
+
+    LeaveCriticalSection();
+}
+
+//------------------------------------------------------------------------------
+// Function:	
+//              UART_read()
+// Description:
+//! \brief      Take received bytes
+//! \return     number of bytes copied to data
+//------------------------------------------------------------------------------
+uint16_t UART_read(void* data, uint16_t size)
+{
+    uint8_t* dst = (uint8_t*)data;
+    uint16_t tail, count, part;
+
+    EnterCriticalSection();
+    if(UART_rx.size)
+        UART_rxUpdate();
+    tail = UART_rx.tail;
+    count = (size < UART_rx.count) ? size : UART_rx.count;
+    LeaveCriticalSection();
+
+    if(count == 0)
+        return 0;
+
+    // Copy up to the buffer end, then from the beginning
+    part = UART_rx.size - tail;
+    if(part > count)
+        part = count;
+    memcpy(dst, &UART_rx.buffer[tail], part);
+    memcpy(&dst[part], UART_rx.buffer, count - part);
+
+    EnterCriticalSection();
+    tail += count;
+    UART_rx.tail = (tail >= UART_rx.size) ? (tail - UART_rx.size) : tail;
+    UART_rx.count -= count;
+    LeaveCriticalSection();
+
+    return count;
+}
+
+//------------------------------------------------------------------------------
+// Function:	
+//              UART_getLost()
+// Description:
+//! \brief      Bytes overwritten in reception buffer before read
+//------------------------------------------------------------------------------
+uint16_t UART_getLost(void)
+{
+    return UART_rx.lost;
+}
+
+//------------------------------------------------------------------------------
+// Function:	
+//              DMA1_Channel2_3_IRQHandler()
+// Description:
+//! \brief      UART TX (channel 2) and RX (channel 3) DMA ISR
+//------------------------------------------------------------------------------
+void DMA1_Channel2_3_IRQHandler(void)
+{
+    uint32_t flags = DMA1->ISR;
+
+    // Clear all flags of channels 2 and 3
+    DMA1->IFCR = flags & (DMA_IFCR_CGIF2 | DMA_IFCR_CGIF3);
+
+    if(flags & DMA_ISR_TCIF2)
+    {
+        // Last byte is in TDR: wait for transmission complete
+        UART_TX_DMA->CCR &= ~DMA_CCR_EN;
+        USART1->CR1 |= USART_CR1_TCIE;
+    }
+
+    if(flags & (DMA_ISR_HTIF3 | DMA_ISR_TCIF3))
+    {
+        UART_rxUpdate();
+        if(UART_rx.handler)
+            UART_rx.handler();
+    }
+}
+
+//------------------------------------------------------------------------------
+// Function:	
+//              USART1_IRQHandler()
+// Description:
+//! \brief      UART0 transmission complete and idle line ISR
+//------------------------------------------------------------------------------
+void USART1_IRQHandler(void)
+{
+    uint32_t flags = USART1->ISR;
+
+    // Clear served flags (ICR bits match ISR ones)
+    USART1->ICR = flags & (USART_ICR_PECF+      // Parity Error
+                           USART_ICR_FECF+      // Framing Error
+                           USART_ICR_NCF+       // Noise detected
+                           USART_ICR_ORECF+     // OverRun Error
+                           USART_ICR_IDLECF+    // IDLE line detected
+                           USART_ICR_TCCF);     // Transmission Complete
+
+    if((USART1->CR1 & USART_CR1_TCIE) && (flags & USART_ISR_TC))
+    {
+        void (*handler)(void) = UART_tx.handler;
+
+        USART1->CR1 &= ~USART_CR1_TCIE;
+        UART_tx.handler = NULL;
+        if(handler)
+            handler();
+    }
+
+    if(flags & USART_ISR_IDLE)
+    {
+        UART_rxUpdate();
+        if(UART_rx.handler)
+            UART_rx.handler();
+    }
+}
+
+#else
+
 //------------------------------------------------------------------------------
 // Function:	
 //              UART0_startTx()
@@ -111,6 +386,8 @@ void USART1_IRQHandler(void)
                         USART_ICR_CMCF);    // Clear Character Match Flag
     }
 }
+
+#endif // UART_DMA_ENABLED
             
 #endif // _STM32F0X_HAL_
 
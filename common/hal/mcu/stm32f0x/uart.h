@@ -16,6 +16,7 @@
 //!  Date       | Author           | Comments			
 //!  ---------- | ---------------- | ----------------
 //!  21/05/2016 | Bogdan Kokotenko | Initial draft
+//!  18/10/2026 | Bogdan Kokotenko | Added DMA mode (UART_DMA_ENABLED)
 //
 //******************************************************************************
 #ifndef UART_H
@@ -31,9 +32,31 @@ extern "C" {
 //! Initialize UART0
 void UART_init(void);
 
+#ifdef UART_DMA_ENABLED
+
+//! Send packet by DMA (DMA1 channel 2), handler is called when sent
+void UART_send(const void* packet, uint16_t size, void (*handler)(void));
+
+//! Start continuous reception by circular DMA (DMA1 channel 3), handler is
+//! called on idle line, half and full buffer
+void UART_receive(void* buffer, uint16_t size, void (*handler)(void));
+
+//! Stop reception
+void UART_stopReceive(void);
+
+//! Take received bytes, returns number of bytes copied
+uint16_t UART_read(void* data, uint16_t size);
+
+//! Bytes overwritten in reception buffer before read
+uint16_t UART_getLost(void);
+
+#else
+
 //! Start UART0 transmition 
 void UART_startTx(void);	    // for asynchronous mode	
 
+#endif // UART_DMA_ENABLED
+
 #ifdef __cplusplus
 }
 #endif
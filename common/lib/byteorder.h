@@ -0,0 +1,266 @@
+//******************************************************************************
+// Copyright (C) 2026 Bogdan Kokotenko
+//
+//! \addtogroup libs
+//! @{
+//******************************************************************************
+//   File description:
+//! \file   lib\byteorder.h
+//! \brief  Byte swap, endian and unaligned load/store helpers (header only)
+//!
+//! \details Functions take byte pointers, so fields of packed wire buffers
+//!          are read and written in place, at any alignment:
+//!          - bswap16()/bswap32(): compiler intrinsics where available
+//!            (GCC __builtin_bswap, IAR __REV/__REV16 on ARM and
+//!            __swap_bytes() on MSP430 - SWPB), shifts otherwise
+//!          - load_le16/le32/be16/be32(), store_le16/le32/be16/be32()
+//!
+//!          With GCC access is done by memcpy() into native word and swap
+//!          for foreign byte order: compiler emits single load/store where
+//!          unaligned access is allowed (Cortex-M3/M4, x86) and byte access
+//!          otherwise (MSP430, Cortex-M0). Other compilers assemble bytes
+//!          with shifts. Arguments are evaluated once.
+//!
+//!          BYTEORDER_BIG_ENDIAN is defined for big-endian targets (all
+//!          supported MCUs are little-endian).
+//!
+//! \code
+//!   // Modbus RTU: big-endian register address and count
+//!   uint16_t address = load_be16(&frame[2]);
+//!   uint16_t count = load_be16(&frame[4]);
+//!   store_be16(&reply[3], value);
+//! \endcode
+//!
+//!*****************************************************************************
+//! __Revisions:__
+//!  Date       | Author           | Comments
+//!  ---------- | ---------------- | ----------------
+//!  18/10/2026 | Bogdan Kokotenko | Initial draft
+//
+//******************************************************************************
+#ifndef BYTEORDER_H
+#define BYTEORDER_H
+
+#include "types.h"
+
+#if defined(__IAR_SYSTEMS_ICC__)
+#include <intrinsics.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+#define BYTEORDER_BIG_ENDIAN
+#elif defined(__IAR_SYSTEMS_ICC__) && defined(__LITTLE_ENDIAN__) &&          \
+      (__LITTLE_ENDIAN__ == 0)
+#define BYTEORDER_BIG_ENDIAN
+#endif
+
+//------------------------------------------------------------------------------
+// Function:        bswap16()
+// Description:
+//! \brief          Swap bytes of 16-bit word
+//------------------------------------------------------------------------------
+static inline uint16_t bswap16(uint16_t x)
+{
+#if defined(__GNUC__)
+    return __builtin_bswap16(x);
+#elif defined(__IAR_SYSTEMS_ICC__) && defined(__ICCARM__)
+    return (uint16_t)__REV16(x);
+#elif defined(__IAR_SYSTEMS_ICC__) && defined(__ICC430__)
+    return __swap_bytes(x);
+#else
+    return (uint16_t)((x << 8) | (x >> 8));
+#endif
+}
+
+//------------------------------------------------------------------------------
+// Function:        bswap32()
+// Description:
+//! \brief          Swap bytes of 32-bit word
+//------------------------------------------------------------------------------
+static inline uint32_t bswap32(uint32_t x)
+{
+#if defined(__GNUC__)
+    return __builtin_bswap32(x);
+#elif defined(__IAR_SYSTEMS_ICC__) && defined(__ICCARM__)
+    return __REV(x);
+#else
+    return (x << 24) | ((x & 0xFF00ul) << 8) |
+           ((x >> 8) & 0xFF00ul) | (x >> 24);
+#endif
+}
+
+//------------------------------------------------------------------------------
+// Function:        load_le16()
+// Description:
+//! \brief          Read little-endian 16-bit field at any address
+//------------------------------------------------------------------------------
+static inline uint16_t load_le16(const void* ptr)
+{
+#if defined(__GNUC__)
+    uint16_t x;
+    memcpy(&x, ptr, sizeof(x));
+  #ifdef BYTEORDER_BIG_ENDIAN
+    x = bswap16(x);
+  #endif
+    return x;
+#else
+    const uint8_t* p = (const uint8_t*)ptr;
+    return (uint16_t)(p[0] | ((uint16_t)p[1] << 8));
+#endif
+}
+
+//------------------------------------------------------------------------------
+// Function:        load_be16()
+// Description:
+//! \brief          Read big-endian 16-bit field at any address
+//------------------------------------------------------------------------------
+static inline uint16_t load_be16(const void* ptr)
+{
+#if defined(__GNUC__)
+    uint16_t x;
+    memcpy(&x, ptr, sizeof(x));
+  #ifndef BYTEORDER_BIG_ENDIAN
+    x = bswap16(x);
+  #endif
+    return x;
+#else
+    const uint8_t* p = (const uint8_t*)ptr;
+    return (uint16_t)(((uint16_t)p[0] << 8) | p[1]);
+#endif
+}
+
+//------------------------------------------------------------------------------
+// Function:        load_le32()
+// Description:
+//! \brief          Read little-endian 32-bit field at any address
+//------------------------------------------------------------------------------
+static inline uint32_t load_le32(const void* ptr)
+{
+#if defined(__GNUC__)
+    uint32_t x;
+    memcpy(&x, ptr, sizeof(x));
+  #ifdef BYTEORDER_BIG_ENDIAN
+    x = bswap32(x);
+  #endif
+    return x;
+#else
+    const uint8_t* p = (const uint8_t*)ptr;
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) |
+           ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+#endif
+}
+
+//------------------------------------------------------------------------------
+// Function:        load_be32()
+// Description:
+//! \brief          Read big-endian 32-bit field at any address
+//------------------------------------------------------------------------------
+static inline uint32_t load_be32(const void* ptr)
+{
+#if defined(__GNUC__)
+    uint32_t x;
+    memcpy(&x, ptr, sizeof(x));
+  #ifndef BYTEORDER_BIG_ENDIAN
+    x = bswap32(x);
+  #endif
+    return x;
+#else
+    const uint8_t* p = (const uint8_t*)ptr;
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) |
+           ((uint32_t)p[2] << 8) | (uint32_t)p[3];
+#endif
+}
+
+//------------------------------------------------------------------------------
+// Function:        store_le16()
+// Description:
+//! \brief          Write little-endian 16-bit field at any address
+//------------------------------------------------------------------------------
+static inline void store_le16(void* ptr, uint16_t x)
+{
+#if defined(__GNUC__)
+  #ifdef BYTEORDER_BIG_ENDIAN
+    x = bswap16(x);
+  #endif
+    memcpy(ptr, &x, sizeof(x));
+#else
+    uint8_t* p = (uint8_t*)ptr;
+    p[0] = (uint8_t)x;
+    p[1] = (uint8_t)(x >> 8);
+#endif
+}
+
+//------------------------------------------------------------------------------
+// Function:        store_be16()
+// Description:
+//! \brief          Write big-endian 16-bit field at any address
+//------------------------------------------------------------------------------
+static inline void store_be16(void* ptr, uint16_t x)
+{
+#if defined(__GNUC__)
+  #ifndef BYTEORDER_BIG_ENDIAN
+    x = bswap16(x);
+  #endif
+    memcpy(ptr, &x, sizeof(x));
+#else
+    uint8_t* p = (uint8_t*)ptr;
+    p[0] = (uint8_t)(x >> 8);
+    p[1] = (uint8_t)x;
+#endif
+}
+
+//------------------------------------------------------------------------------
+// Function:        store_le32()
+// Description:
+//! \brief          Write little-endian 32-bit field at any address
+//------------------------------------------------------------------------------
+static inline void store_le32(void* ptr, uint32_t x)
+{
+#if defined(__GNUC__)
+  #ifdef BYTEORDER_BIG_ENDIAN
+    x = bswap32(x);
+  #endif
+    memcpy(ptr, &x, sizeof(x));
+#else
+    uint8_t* p = (uint8_t*)ptr;
+    p[0] = (uint8_t)x;
+    p[1] = (uint8_t)(x >> 8);
+    p[2] = (uint8_t)(x >> 16);
+    p[3] = (uint8_t)(x >> 24);
+#endif
+}
+
+//------------------------------------------------------------------------------
+// Function:        store_be32()
+// Description:
+//! \brief          Write big-endian 32-bit field at any address
+//------------------------------------------------------------------------------
+static inline void store_be32(void* ptr, uint32_t x)
+{
+#if defined(__GNUC__)
+  #ifndef BYTEORDER_BIG_ENDIAN
+    x = bswap32(x);
+  #endif
+    memcpy(ptr, &x, sizeof(x));
+#else
+    uint8_t* p = (uint8_t*)ptr;
+    p[0] = (uint8_t)(x >> 24);
+    p[1] = (uint8_t)(x >> 16);
+    p[2] = (uint8_t)(x >> 8);
+    p[3] = (uint8_t)x;
+#endif
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // BYTEORDER_H
+//! @}
+//******************************************************************************
+// End of file
+//******************************************************************************
@@ -8,12 +8,38 @@
 //! \file   lib\crc.h
 //! \brief  CRC APIs.
 //!
+//! \details Every CRC is available for the whole buffer at once or as
+//!          streaming calculation: crc = xxx_init(), then any number of
+//!          crc = xxx_update(crc, chunk, size) calls (e.g. for DMA blocks
+//!          as they arrive) and xxx_final(crc) to get the result.
+//!          The CRC value itself is the calculation context.
+//!
+//!          CRC16CCITT, CRC32 and CRC32C process CRC_SLICE_BY bytes per
+//!          iteration with CRC_SLICE_BY tables (slicing-by-4/8), which is
+//!          faster on 32-bit cores and host, but takes extra 1.5/3.5 KB
+//!          (CRC16CCITT) or 3/7 KB (CRC32, CRC32C) of constant data.
+//!          Default is 1 (byte table only) for 8/16-bit targets.
+//!
+//!          CRC8 (1-Wire) is table-driven with CRC8_TABLE_SIZE 256 (one
+//!          lookup per byte, 256 bytes of table), 16 (two lookups per
+//!          byte, 16 bytes) or bitwise with 0 (no table, 8 steps per byte).
+//!
+//!          With USE_CRC_UNIT defined, CRC32/CRC32C chunks of at least
+//!          CRCUNIT_MIN_SIZE bytes are passed to the hardware backend of
+//!          the HAL (crcunit.h): STM32 CRC unit, PCLMULQDQ folding on x86
+//!          host. Unaligned head, tail and chunks the unit cannot take
+//!          (busy, unsupported CPU) are processed by tables.
+//!
 //!*****************************************************************************
 //! __Revisions:__										
 //!  Date       | Author           | Comments			
 //!  ---------- | ---------------- | ----------------
 //!        2000 | Michael Barr     | Initial draft(http://www.netrino.com/code/)
 //!  19/02/2015 | Bogdan Kokotenko | Added CRC16CCITT
+//!  18/10/2026 | Bogdan Kokotenko | Streaming API, 32-bit sizes, CRC32/CRC32C
+//!  18/10/2026 | Bogdan Kokotenko | Slicing-by-4/8 option (CRC_SLICE_BY)
+//!  18/10/2026 | Bogdan Kokotenko | CRC unit backend option (USE_CRC_UNIT)
+//!  18/10/2026 | Bogdan Kokotenko | CRC8 table size option (CRC8_TABLE_SIZE)
 //
 //******************************************************************************
 #ifndef CRC_H
@@ -23,17 +49,93 @@
 extern "C" {
 #endif
 
+//! Bytes per iteration of CRC16CCITT/CRC32/CRC32C: 1, 4 or 8
+#ifndef CRC_SLICE_BY
+#define CRC_SLICE_BY    1
+#endif
+
+//! CRC8 (1-Wire) table entries: 256, 16 (nibble) or 0 (bitwise)
+#ifndef CRC8_TABLE_SIZE
+#define CRC8_TABLE_SIZE 256
+#endif
+
+//------------------------------- CRC16 ----------------------------------------
+//! Start CRC16 calculation
+uint16_t crc16_init(void);
+
+//! Feed data chunk to CRC16 calculation
+uint16_t crc16_update(uint16_t crc, const void* data, uint32_t size);
+
+//! Finish CRC16 calculation
+uint16_t crc16_final(uint16_t crc);
+
 //! Compute the CRC16 of a given data
-uint16_t crc16(const void* data, uint16_t size);
+uint16_t crc16(const void* data, uint32_t size);
+
+//------------------------------- CRC16IBM -------------------------------------
+//! Start CRC16IBM calculation
+uint16_t crc16ibm_init(void);
+
+//! Feed data chunk to CRC16IBM calculation
+uint16_t crc16ibm_update(uint16_t crc, const void* data, uint32_t size);
+
+//! Finish CRC16IBM calculation
+uint16_t crc16ibm_final(uint16_t crc);
 
 //! Compute the CRC16IBM of a given data
-uint16_t crc16ibm(const void* data, uint16_t size);
+uint16_t crc16ibm(const void* data, uint32_t size);
+
+//------------------------------- CRC16CCITT -----------------------------------
+//! Start CRC16CCITT calculation
+uint16_t crc16ccitt_init(void);
+
+//! Feed data chunk to CRC16CCITT calculation
+uint16_t crc16ccitt_update(uint16_t crc, const void* data, uint32_t size);
+
+//! Finish CRC16CCITT calculation
+uint16_t crc16ccitt_final(uint16_t crc);
 
 //! Compute the CRC16CCITT of a given data
-uint16_t crc16ccitt(const void* data, uint16_t size);
+uint16_t crc16ccitt(const void* data, uint32_t size);
+
+//------------------------------- CRC32 ----------------------------------------
+//! Start CRC32 (IEEE 802.3) calculation
+uint32_t crc32_init(void);
+
+//! Feed data chunk to CRC32 (IEEE 802.3) calculation
+uint32_t crc32_update(uint32_t crc, const void* data, uint32_t size);
+
+//! Finish CRC32 (IEEE 802.3) calculation
+uint32_t crc32_final(uint32_t crc);
+
+//! Compute the CRC32 (IEEE 802.3) of a given data
+uint32_t crc32(const void* data, uint32_t size);
+
+//------------------------------- CRC32C ---------------------------------------
+//! Start CRC32C (Castagnoli) calculation
+uint32_t crc32c_init(void);
+
+//! Feed data chunk to CRC32C (Castagnoli) calculation
+uint32_t crc32c_update(uint32_t crc, const void* data, uint32_t size);
+
+//! Finish CRC32C (Castagnoli) calculation
+uint32_t crc32c_final(uint32_t crc);
+
+//! Compute the CRC32C (Castagnoli) of a given data
+uint32_t crc32c(const void* data, uint32_t size);
+
+//------------------------------- CRC8 -----------------------------------------
+//! Start CRC8 (1-Wire) calculation
+uint8_t crc8_init(void);
+
+//! Feed data chunk to CRC8 (1-Wire) calculation
+uint8_t crc8_update(uint8_t crc, const void* data, uint32_t size);
+
+//! Finish CRC8 (1-Wire) calculation
+uint8_t crc8_final(uint8_t crc);
 
 //! Compute the CRC8 (1-Wire) of a given data
-uint8_t crc8(const void* data, uint8_t size );
+uint8_t crc8(const void* data, uint32_t size);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,245 @@
+//******************************************************************************
+// Copyright (C) 2026 Bogdan Kokotenko
+//
+//   File description:
+//! \file       lib\crcmodel.c
+//! \brief      Implementation of the parameterised CRC engine.
+//!
+//! \details    Register holds the CRC as it is shifted: reflected for refin
+//!             models (LSB first, init is reflected at start), unreflected
+//!             otherwise. Final value is reflected when refout differs
+//!             from refin.
+//!
+//!             Split table layout (T[0..15] is the nibble table):
+//!             - reflected: byte entry = T[hi nibble] ^ T[16 + lo nibble]
+//!             - MSB-first: byte entry = T[16 + hi nibble] ^ T[lo nibble]
+//!
+//!*****************************************************************************
+//! __Revisions:__
+//!  Date       | Author           | Comments
+//!  ---------- | ---------------- | ----------------
+//!  18/10/2026 | Bogdan Kokotenko | Initial draft
+//
+//******************************************************************************
+#include "stdint.h"
+#include "stdbool.h"
+#include "crcmodel.h"
+
+// Predefined models tables
+static const uint16_t crc16arcTable[CRC_MODEL_TABLE_SIZE] =
+    { CRC_MODEL_TABLE_REF(0xA001) };
+static const uint16_t crc16xmodemTable[CRC_MODEL_TABLE_SIZE] =
+    { CRC_MODEL_TABLE_MSB(16, 0x1021) };
+static const uint16_t crc16kermitTable[CRC_MODEL_TABLE_SIZE] =
+    { CRC_MODEL_TABLE_REF(0x8408) };
+static const uint8_t crc8smbusTable[CRC_MODEL_TABLE_SIZE] =
+    { CRC_MODEL_TABLE_MSB(8, 0x07) };
+static const uint8_t crc8maximTable[CRC_MODEL_TABLE_SIZE] =
+    { CRC_MODEL_TABLE_REF(0x8C) };
+static const uint32_t crc32hdlcTable[CRC_MODEL_TABLE_SIZE] =
+    { CRC_MODEL_TABLE_REF(0xEDB88320) };
+static const uint32_t crc32mpeg2Table[CRC_MODEL_TABLE_SIZE] =
+    { CRC_MODEL_TABLE_MSB(32, 0x04C11DB7) };
+
+// Predefined models: width, refin, refout, table kind, init, xorout, check
+const CRC_Model_t crc16modbusModel = { 16, true, true, CRC_MODEL_TABLE_KIND,
+    0xFFFF, 0x0000, 0x4B37, crc16arcTable };
+const CRC_Model_t crc16arcModel = { 16, true, true, CRC_MODEL_TABLE_KIND,
+    0x0000, 0x0000, 0xBB3D, crc16arcTable };
+const CRC_Model_t crc16xmodemModel = { 16, false, false, CRC_MODEL_TABLE_KIND,
+    0x0000, 0x0000, 0x31C3, crc16xmodemTable };
+const CRC_Model_t crc16kermitModel = { 16, true, true, CRC_MODEL_TABLE_KIND,
+    0x0000, 0x0000, 0x2189, crc16kermitTable };
+const CRC_Model_t crc16ibm3740Model = { 16, false, false, CRC_MODEL_TABLE_KIND,
+    0xFFFF, 0x0000, 0x29B1, crc16xmodemTable };
+const CRC_Model_t crc8smbusModel = { 8, false, false, CRC_MODEL_TABLE_KIND,
+    0x00, 0x00, 0xF4, crc8smbusTable };
+const CRC_Model_t crc8maximModel = { 8, true, true, CRC_MODEL_TABLE_KIND,
+    0x00, 0x00, 0xA1, crc8maximTable };
+const CRC_Model_t crc32hdlcModel = { 32, true, true, CRC_MODEL_TABLE_KIND,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xCBF43926, crc32hdlcTable };
+const CRC_Model_t crc32mpeg2Model = { 32, false, false, CRC_MODEL_TABLE_KIND,
+    0xFFFFFFFF, 0x00000000, 0x0376E6E7, crc32mpeg2Table };
+
+//------------------------------------------------------------------------------
+// Function:	
+//				    crcModel_reflect()
+// Description:
+//! \brief          Reflect the lowest bits of the value
+//------------------------------------------------------------------------------
+static uint32_t crcModel_reflect(uint32_t data, uint8_t nBits)
+{
+    uint32_t reflection = 0;
+
+    while(nBits--)
+    {
+        reflection = (reflection << 1) | (data & 0x01);
+        data >>= 1;
+    }
+
+    return reflection;
+}
+
+//------------------------------------------------------------------------------
+// Function:	
+//				    crcModel_entry()
+// Description:
+//! \brief          Read table entry of given size
+//------------------------------------------------------------------------------
+static inline uint32_t crcModel_entry(const void* table, uint8_t index,
+                                      uint8_t entrySize)
+{
+    if(entrySize == 1)
+        return ((const uint8_t*)table)[index];
+    if(entrySize == 2)
+        return ((const uint16_t*)table)[index];
+    return ((const uint32_t*)table)[index];
+}
+
+//------------------------------------------------------------------------------
+// Function:	
+//				    crcModel_kernel()
+// Description:
+//! \brief          Table-driven CRC update for given entry size
+//! \details        Inlined with constant entrySize, the loop is selected
+//!                 once per chunk, so there are no per-byte decisions.
+//------------------------------------------------------------------------------
+static inline uint32_t crcModel_kernel(const CRC_Model_t* model, uint32_t crc,
+                                       const uint8_t* dataPtr, uint32_t size,
+                                       uint8_t entrySize)
+{
+    const void* table = model->table;
+    uint8_t index;
+
+    if(model->refin)
+    {
+        if(model->tableKind == CRC_TABLE_NIBBLE)
+        {
+            while(size--)
+            {
+                crc ^= *dataPtr++;
+                crc = (crc >> 4) ^
+                      crcModel_entry(table, (uint8_t)(crc & 0x0F), entrySize);
+                crc = (crc >> 4) ^
+                      crcModel_entry(table, (uint8_t)(crc & 0x0F), entrySize);
+            }
+        }
+        else
+        {
+            while(size--)
+            {
+                index = (uint8_t)crc ^ *dataPtr++;
+                crc = (crc >> 8) ^
+                      crcModel_entry(table, index >> 4, entrySize) ^
+                      crcModel_entry(table, 16 + (index & 0x0F), entrySize);
+            }
+        }
+    }
+    else
+    {
+        uint8_t  shift = model->width - 8;
+        uint32_t mask = 0xFFFFFFFFUL >> (32 - model->width);
+
+        if(model->tableKind == CRC_TABLE_NIBBLE)
+        {
+            while(size--)
+            {
+                crc ^= (uint32_t)*dataPtr++ << shift;
+                crc = ((crc << 4) ^ crcModel_entry(table,
+                        (uint8_t)((crc >> (shift + 4)) & 0x0F), entrySize)) & mask;
+                crc = ((crc << 4) ^ crcModel_entry(table,
+                        (uint8_t)((crc >> (shift + 4)) & 0x0F), entrySize)) & mask;
+            }
+        }
+        else
+        {
+            while(size--)
+            {
+                index = (uint8_t)(crc >> shift) ^ *dataPtr++;
+                crc = ((crc << 8) ^
+                      crcModel_entry(table, 16 + (index >> 4), entrySize) ^
+                      crcModel_entry(table, index & 0x0F, entrySize)) & mask;
+            }
+        }
+    }
+
+    return crc;
+}
+
+//------------------------------------------------------------------------------
+// Function:	
+//				    crcModel_init()
+// Description:
+//! \brief          Start CRC calculation by model
+//!
+//! \param *model   CRC model
+//! \return         initial CRC value (context)
+//------------------------------------------------------------------------------
+uint32_t crcModel_init(const CRC_Model_t* model)
+{
+    if(model->refin)
+        return crcModel_reflect(model->init, model->width);
+    return model->init;
+}
+
+//------------------------------------------------------------------------------
+// Function:	
+//				    crcModel_update()
+// Description:
+//! \brief          Feed data chunk to CRC calculation by model
+//!
+//! \param *model   CRC model
+//! \param crc      current CRC value (context)
+//! \param *data    pointer to data chunk
+//! \param size     size of data chunk
+//! \return         updated CRC value
+//------------------------------------------------------------------------------
+uint32_t crcModel_update(const CRC_Model_t* model, uint32_t crc,
+                         const void* data, uint32_t size)
+{
+    const uint8_t* dataPtr = (const uint8_t*)data;
+
+    if(model->width <= 8)
+        return crcModel_kernel(model, crc, dataPtr, size, 1);
+    if(model->width <= 16)
+        return crcModel_kernel(model, crc, dataPtr, size, 2);
+    return crcModel_kernel(model, crc, dataPtr, size, 4);
+}
+
+//------------------------------------------------------------------------------
+// Function:	
+//				    crcModel_final()
+// Description:
+//! \brief          Finish CRC calculation by model
+//!
+//! \param *model   CRC model
+//! \param crc      current CRC value (context)
+//! \return         the CRC value of the data
+//------------------------------------------------------------------------------
+uint32_t crcModel_final(const CRC_Model_t* model, uint32_t crc)
+{
+    if(model->refin != model->refout)
+        crc = crcModel_reflect(crc, model->width);
+    return crc ^ model->xorout;
+}
+
+//------------------------------------------------------------------------------
+// Function:	
+//				    crcModel()
+// Description:
+//! \brief          Compute the CRC of a given data by model
+//!
+//! \param *model   CRC model
+//! \param *data    pointer to data array
+//! \param size     size of data array
+//! \return         the CRC value of the data
+//------------------------------------------------------------------------------
+uint32_t crcModel(const CRC_Model_t* model, const void* data, uint32_t size)
+{
+    return crcModel_final(model,
+        crcModel_update(model, crcModel_init(model), data, size));
+}
+
+//******************************************************************************
+// End of file
+//******************************************************************************
@@ -0,0 +1,182 @@
+//******************************************************************************
+// Copyright (C) 2026 Bogdan Kokotenko
+//
+//! \addtogroup libs
+//! @{
+//******************************************************************************
+//   File description:
+//! \file   lib\crcmodel.h
+//! \brief  Parameterised (Rocksoft model) CRC engine.
+//!
+//! \details Any CRC of width 8..32 bits is described by CRC_Model_t:
+//!          width, poly, init, refin, refout, xorout (as in CRC catalogues)
+//!          and a lookup table, generated at compile time by
+//!          CRC_MODEL_TABLE_MSB(width, poly) for MSB-first (refin = 0) or
+//!          CRC_MODEL_TABLE_REF(rpoly) for reflected (refin = 1) models,
+//!          where rpoly is bit-reflected poly (e.g. 0xA001 for 0x8005).
+//!
+//!          Table kinds:
+//!          - CRC_TABLE_SPLIT: 2x16 entries, one step per byte, two
+//!            independent lookups (byte table is the XOR of them)
+//!          - CRC_TABLE_NIBBLE: 16 entries, two dependent steps per byte,
+//!            about twice slower, for flash-starved parts (MSP430G2)
+//!
+//!          Predefined models use split tables, or nibble tables with
+//!          CRC_MODEL_NIBBLE defined. Footprint per model (CRC16):
+//!          64 bytes (split) or 32 bytes (nibble) versus 512 bytes of
+//!          256-entry table in crc.c.
+//!
+//!          The engine follows crc.h streaming API: crc = crcModel_init(),
+//!          crc = crcModel_update(crc, chunk, size), crcModel_final(crc).
+//!
+//! \note    256-entry tables are not generated: the preprocessor expands
+//!          a bitwise step twice per bit, so one 256-entry table is
+//!          256 times more text than a nibble table (seconds of compile
+//!          time per table). Use crc.c for byte-table CRC16/CRC32.
+//!
+//! \code
+//!   static const uint16_t myTable[CRC_MODEL_TABLE_SIZE] =
+//!       { CRC_MODEL_TABLE_MSB(16, 0x1021) };
+//!   const CRC_Model_t myModel = { 16, false, false, CRC_MODEL_TABLE_KIND,
+//!       0xFFFF, 0x0000, 0x29B1, myTable };
+//! \endcode
+//!
+//!*****************************************************************************
+//! __Revisions:__
+//!  Date       | Author           | Comments
+//!  ---------- | ---------------- | ----------------
+//!  18/10/2026 | Bogdan Kokotenko | Initial draft
+//
+//******************************************************************************
+#ifndef CRCMODEL_H
+#define CRCMODEL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//! Lookup table kinds
+enum CRC_TableKind_t{
+    CRC_TABLE_SPLIT = 0,                //!< 2x16 entries, step per byte
+    CRC_TABLE_NIBBLE                    //!< 16 entries, step per nibble
+};
+
+//! CRC model (Rocksoft parameters and lookup table)
+typedef struct _CRC_Model_t{
+    uint8_t     width;                  //!< CRC width, 8..32 bits
+    bool        refin;                  //!< input bytes reflected (LSB first)
+    bool        refout;                 //!< result reflected
+    uint8_t     tableKind;              //!< CRC_TABLE_SPLIT or CRC_TABLE_NIBBLE
+    uint32_t    init;                   //!< initial register value
+    uint32_t    xorout;                 //!< final XOR value
+    uint32_t    check;                  //!< CRC of "123456789"
+    const void* table;                  //!< uint8/16/32_t entries by width
+}CRC_Model_t;
+
+//------------------------------------------------------------------------------
+// Compile-time table generation
+//------------------------------------------------------------------------------
+//! Register mask of given width
+#define CRC_MODEL_MASK(w)           (0xFFFFFFFFUL >> (32 - (w)))
+
+//! MSB-first bitwise steps
+#define CRC_MODEL_MSB1(c, w, p)     ((((c) << 1) ^ ((((c) >> ((w) - 1)) & 1UL)\
+                                    ? (unsigned long)(p) : 0UL)) & CRC_MODEL_MASK(w))
+#define CRC_MODEL_MSB2(c, w, p)     CRC_MODEL_MSB1(CRC_MODEL_MSB1(c, w, p), w, p)
+#define CRC_MODEL_MSB4(c, w, p)     CRC_MODEL_MSB2(CRC_MODEL_MSB2(c, w, p), w, p)
+#define CRC_MODEL_MSB8(c, w, p)     CRC_MODEL_MSB4(CRC_MODEL_MSB4(c, w, p), w, p)
+
+//! Reflected (LSB-first) bitwise steps
+#define CRC_MODEL_REF1(c, p)        (((c) >> 1) ^ (((c) & 1UL) ?              \
+                                    (unsigned long)(p) : 0UL))
+#define CRC_MODEL_REF2(c, p)        CRC_MODEL_REF1(CRC_MODEL_REF1(c, p), p)
+#define CRC_MODEL_REF4(c, p)        CRC_MODEL_REF2(CRC_MODEL_REF2(c, p), p)
+#define CRC_MODEL_REF8(c, p)        CRC_MODEL_REF4(CRC_MODEL_REF4(c, p), p)
+
+//! Table entries: nibble and complementary half of split table
+#define CRC_MODEL_MSB_NIBBLE(w, p, n)   CRC_MODEL_MSB4((unsigned long)(n) << ((w) - 4), w, p)
+#define CRC_MODEL_MSB_HIGH(w, p, n)     CRC_MODEL_MSB8((unsigned long)(n) << ((w) - 4), w, p)
+#define CRC_MODEL_REF_NIBBLE(w, p, n)   CRC_MODEL_REF4((unsigned long)(n), p)
+#define CRC_MODEL_REF_LOW(w, p, n)      CRC_MODEL_REF8((unsigned long)(n), p)
+
+//! 16 table entries
+#define CRC_MODEL_X16(entry, w, p)                                             \
+    entry(w, p, 0),  entry(w, p, 1),  entry(w, p, 2),  entry(w, p, 3),         \
+    entry(w, p, 4),  entry(w, p, 5),  entry(w, p, 6),  entry(w, p, 7),         \
+    entry(w, p, 8),  entry(w, p, 9),  entry(w, p, 10), entry(w, p, 11),        \
+    entry(w, p, 12), entry(w, p, 13), entry(w, p, 14), entry(w, p, 15)
+
+//! Nibble tables: crc = (crc << 4) ^ T[top nibble] or (crc >> 4) ^ T[low nibble]
+#define CRC_NIBBLE_TABLE_MSB(w, p)  CRC_MODEL_X16(CRC_MODEL_MSB_NIBBLE, w, p)
+#define CRC_NIBBLE_TABLE_REF(rp)    CRC_MODEL_X16(CRC_MODEL_REF_NIBBLE, 0, rp)
+
+//! Split tables: nibble table followed by complementary half of byte table
+#define CRC_SPLIT_TABLE_MSB(w, p)   CRC_NIBBLE_TABLE_MSB(w, p),                \
+                                    CRC_MODEL_X16(CRC_MODEL_MSB_HIGH, w, p)
+#define CRC_SPLIT_TABLE_REF(rp)     CRC_NIBBLE_TABLE_REF(rp),                  \
+                                    CRC_MODEL_X16(CRC_MODEL_REF_LOW, 0, rp)
+
+//! Default table kind of models
+#ifdef CRC_MODEL_NIBBLE
+    #define CRC_MODEL_TABLE_KIND    CRC_TABLE_NIBBLE
+    #define CRC_MODEL_TABLE_SIZE    16
+    #define CRC_MODEL_TABLE_MSB(w, p)   CRC_NIBBLE_TABLE_MSB(w, p)
+    #define CRC_MODEL_TABLE_REF(rp)     CRC_NIBBLE_TABLE_REF(rp)
+#else
+    #define CRC_MODEL_TABLE_KIND    CRC_TABLE_SPLIT
+    #define CRC_MODEL_TABLE_SIZE    32
+    #define CRC_MODEL_TABLE_MSB(w, p)   CRC_SPLIT_TABLE_MSB(w, p)
+    #define CRC_MODEL_TABLE_REF(rp)     CRC_SPLIT_TABLE_REF(rp)
+#endif
+
+//------------------------------- Models ---------------------------------------
+//! CRC-16/MODBUS: 0x8005, init 0xFFFF, reflected
+extern const CRC_Model_t crc16modbusModel;
+
+//! CRC-16/ARC: 0x8005, init 0x0000, reflected
+extern const CRC_Model_t crc16arcModel;
+
+//! CRC-16/XMODEM: 0x1021, init 0x0000
+extern const CRC_Model_t crc16xmodemModel;
+
+//! CRC-16/KERMIT: 0x1021, init 0x0000, reflected
+extern const CRC_Model_t crc16kermitModel;
+
+//! CRC-16/IBM-3740 (CCITT-FALSE): 0x1021, init 0xFFFF
+extern const CRC_Model_t crc16ibm3740Model;
+
+//! CRC-8/SMBUS: 0x07, init 0x00
+extern const CRC_Model_t crc8smbusModel;
+
+//! CRC-8/MAXIM-DOW (1-Wire): 0x31, init 0x00, reflected
+extern const CRC_Model_t crc8maximModel;
+
+//! CRC-32/ISO-HDLC: 0x04C11DB7, init/xorout 0xFFFFFFFF, reflected
+extern const CRC_Model_t crc32hdlcModel;
+
+//! CRC-32/MPEG-2: 0x04C11DB7, init 0xFFFFFFFF
+extern const CRC_Model_t crc32mpeg2Model;
+
+//------------------------------- Engine ---------------------------------------
+//! Start CRC calculation by model
+uint32_t crcModel_init(const CRC_Model_t* model);
+
+//! Feed data chunk to CRC calculation by model
+uint32_t crcModel_update(const CRC_Model_t* model, uint32_t crc,
+                         const void* data, uint32_t size);
+
+//! Finish CRC calculation by model
+uint32_t crcModel_final(const CRC_Model_t* model, uint32_t crc);
+
+//! Compute the CRC of a given data by model
+uint32_t crcModel(const CRC_Model_t* model, const void* data, uint32_t size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // CRCMODEL_H
+//! @}
+//******************************************************************************
+// End of file
+//******************************************************************************
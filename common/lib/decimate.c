@@ -0,0 +1,206 @@
+//******************************************************************************
+// Copyright (C) 2026 Bogdan Kokotenko
+//
+//	File description:
+//! \file       lib\decimate.c
+//! \brief      CIC and polyphase FIR decimators for oversampled ADC blocks
+//!
+//! \details    Output is taken at input samples 0, ratio, 2*ratio... (as
+//!             CMSIS arm_fir_decimate_q15), both decimators have the same
+//!             alignment. CIC registers are unsigned: wrap-around of
+//!             integrators is cancelled by combs.
+//!
+//!*****************************************************************************
+//! __Revisions:__
+//!  Date       | Author           | Comments
+//!  ---------- | ---------------- | --------------------------------
+//!  18/10/2026 | Bogdan Kokotenko | Initial draft
+//
+//******************************************************************************
+#include "types.h"
+#include "decimate.h"
+
+//------------------------------------------------------------------------------
+// Function:        decimate_sat16()
+// Description:
+//! \brief          Saturate to 16 bits
+//------------------------------------------------------------------------------
+static inline int16_t decimate_sat16(int64_t x)
+{
+    if(x > INT16_MAX)
+        return INT16_MAX;
+    if(x < INT16_MIN)
+        return INT16_MIN;
+    return (int16_t)x;
+}
+
+//------------------------------------------------------------------------------
+// Function:        cic_init()
+// Description:
+//! \brief          Initialize CIC decimator
+//! \param cic      decimator instance
+//! \param order    number of integrator/comb stages, 1..CIC_MAX_ORDER
+//! \param ratio    decimation ratio
+//! \param shift    output shift, order*log2(ratio) for unity gain
+//! \return         false, if 32-bit registers overflow for order and ratio
+//------------------------------------------------------------------------------
+bool cic_init(CIC_t* cic, uint8_t order, uint16_t ratio, uint8_t shift)
+{
+    uint8_t bits = 0;
+
+    if(order == 0 || order > CIC_MAX_ORDER || ratio == 0 || shift > 31)
+        return false;
+
+    // Register growth: order*ceil(log2(ratio)) over 16-bit input
+    while((1ul << bits) < ratio)
+        bits++;
+    if(order*bits > 16)
+        return false;
+
+    cic->order = order;
+    cic->ratio = ratio;
+    cic->shift = shift;
+    cic_reset(cic);
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// Function:        cic_reset()
+// Description:
+//! \brief          Clear CIC state
+//------------------------------------------------------------------------------
+void cic_reset(CIC_t* cic)
+{
+    memset(cic->integrator, 0, sizeof(cic->integrator));
+    memset(cic->comb, 0, sizeof(cic->comb));
+    cic->phase = 0;
+}
+
+//------------------------------------------------------------------------------
+// Function:        cic_decimate()
+// Description:
+//! \brief          Decimate block of samples
+//! \param cic      decimator instance
+//! \param src      input samples
+//! \param count    number of input samples
+//! \param dst      output samples, up to count/ratio + 1
+//! \return         number of output samples
+//------------------------------------------------------------------------------
+uint16_t cic_decimate(CIC_t* cic, const int16_t* src, uint16_t count,
+                      int16_t* dst)
+{
+    uint32_t integrator[CIC_MAX_ORDER];
+    uint16_t phase = cic->phase;
+    uint16_t outputs = 0;
+    uint8_t order = cic->order;
+    uint8_t stage;
+
+    memcpy(integrator, cic->integrator, sizeof(integrator));
+
+    while(count--)
+    {
+        uint32_t value = (uint32_t)(int32_t)*src++;
+
+        // Integrators at input rate
+        for(stage = 0; stage < order; stage++)
+            value = integrator[stage] += value;
+
+        // Combs at output rate
+        if(phase == 0)
+        {
+            for(stage = 0; stage < order; stage++)
+            {
+                uint32_t delayed = cic->comb[stage];
+                cic->comb[stage] = value;
+                value -= delayed;
+            }
+            *dst++ = decimate_sat16((int32_t)value >> cic->shift);
+            outputs++;
+        }
+
+        if(++phase == cic->ratio)
+            phase = 0;
+    }
+
+    memcpy(cic->integrator, integrator, sizeof(integrator));
+    cic->phase = phase;
+    return outputs;
+}
+
+//------------------------------------------------------------------------------
+// Function:        fir_decimate_q15_init()
+// Description:
+//! \brief          Initialize Q15 FIR decimator
+//! \param fir      decimator instance
+//! \param numTaps  number of coefficients
+//! \param ratio    decimation ratio
+//! \param coeffs   time-reversed coefficients
+//! \param state    FIR_STATE_SIZE(numTaps, blockSize) samples
+//! \param blockSize maximal block size, multiple of ratio
+//! \return         false, if parameters are invalid
+//------------------------------------------------------------------------------
+bool fir_decimate_q15_init(FIR_DECIMATE_Q15_t* fir, uint16_t numTaps,
+                           uint8_t ratio, const q15_t* coeffs, q15_t* state,
+                           uint32_t blockSize)
+{
+    if(numTaps == 0 || ratio == 0)
+        return false;
+
+#ifdef USE_CMSIS_DSP
+    return arm_fir_decimate_init_q15(fir, numTaps, ratio, (q15_t*)coeffs,
+                                     state, blockSize) == ARM_MATH_SUCCESS;
+#else
+    if(blockSize % ratio)
+        return false;
+
+    fir->M = ratio;
+    fir->numTaps = numTaps;
+    fir->pCoeffs = (q15_t*)coeffs;
+    fir->pState = state;
+    memset(state, 0, FIR_STATE_SIZE(numTaps, blockSize)*sizeof(q15_t));
+    return true;
+#endif
+}
+
+//------------------------------------------------------------------------------
+// Function:        fir_decimate_q15()
+// Description:
+//! \brief          Decimate block of Q15 samples
+//! \param fir      decimator instance
+//! \param src      input samples
+//! \param dst      blockSize/ratio output samples
+//! \param blockSize number of input samples, multiple of ratio
+//------------------------------------------------------------------------------
+void fir_decimate_q15(const FIR_DECIMATE_Q15_t* fir, const q15_t* src,
+                      q15_t* dst, uint32_t blockSize)
+{
+#ifdef USE_CMSIS_DSP
+    arm_fir_decimate_q15(fir, (q15_t*)src, dst, blockSize);
+#else
+    q15_t* history = fir->pState;
+    q15_t* input = fir->pState + (fir->numTaps - 1);
+    uint32_t outputs = blockSize/fir->M;
+    uint32_t index;
+    uint16_t tap;
+
+    memcpy(input, src, blockSize*sizeof(q15_t));
+
+    // Dot product only at output instants
+    for(index = 0; index < outputs; index++)
+    {
+        const q15_t* sample = history + index*fir->M;
+        int64_t acc = 0;
+
+        for(tap = 0; tap < fir->numTaps; tap++)
+            acc += (int32_t)sample[tap]*fir->pCoeffs[tap];
+
+        dst[index] = decimate_sat16(acc >> 15);
+    }
+
+    memmove(history, history + blockSize, (fir->numTaps - 1)*sizeof(q15_t));
+#endif
+}
+
+//******************************************************************************
+// End of file
+//******************************************************************************
@@ -0,0 +1,118 @@
+//******************************************************************************
+// Copyright (C) 2026 Bogdan Kokotenko
+//
+//! \addtogroup libs
+//! @{
+//******************************************************************************
+//   File description:
+//! \file   lib\decimate.h
+//! \brief  CIC and polyphase FIR decimators for oversampled ADC blocks
+//!
+//! \details Decimators take blocks of samples (e.g. DMA ADC buffers) and
+//!          emit every ratio-th output, so per-sample cost is a few adds
+//!          (CIC) or numTaps/ratio MACs (FIR), and the call overhead is
+//!          paid once per block. State is kept between blocks, any block
+//!          split gives the same output.
+//!          - CIC: order 1..CIC_MAX_ORDER integrators at input rate and
+//!            combs at output rate, gain ratio^order is removed by shift
+//!            (shift below order*log2(ratio) keeps extra resolution bits).
+//!            Registers wrap modulo 2^32, so order*ceil(log2(ratio)) has
+//!            to be up to 16.
+//!          - FIR: only every ratio-th output of FIR is calculated (same
+//!            cost as polyphase sub-filters). Layout and arithmetic of
+//!            CMSIS arm_fir_decimate_q15(): time-reversed coefficients,
+//!            state of FIR_STATE_SIZE(numTaps, blockSize) samples, block
+//!            size multiple of ratio. With USE_CMSIS_DSP calls are passed
+//!            to CMSIS-DSP.
+//!
+//!          Typical chain: CIC for the high ratio, then short FIR to
+//!          compensate CIC droop and decimate by 2..4.
+//!
+//! \code
+//!   // MSP430F5x: ADC12 results by DMA0 (ADC_USE_DMA), two buffers
+//!   static int16_t adcBlock[2][64], output[8];
+//!   void ADC_blockHandler(void)
+//!   {
+//!       DMA0_ADC_transfer(adcBlock[next ^= 1], &ADC12MEM0, 64, ADC_blockHandler);
+//!       count = cic_decimate(&cic, adcBlock[next ^ 1], 64, output);
+//!   }
+//! \endcode
+//!
+//!*****************************************************************************
+//! __Revisions:__
+//!  Date       | Author           | Comments
+//!  ---------- | ---------------- | ----------------
+//!  18/10/2026 | Bogdan Kokotenko | Initial draft
+//
+//******************************************************************************
+#ifndef DECIMATE_H
+#define DECIMATE_H
+
+#include "filter.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//! Maximal CIC order
+#ifndef CIC_MAX_ORDER
+#define CIC_MAX_ORDER       4
+#endif
+
+//! CIC decimator
+typedef struct _CIC_t{
+    uint32_t    integrator[CIC_MAX_ORDER];  //!< integrators (input rate)
+    uint32_t    comb[CIC_MAX_ORDER];        //!< comb delays (output rate)
+    uint16_t    ratio;              //!< decimation ratio
+    uint16_t    phase;              //!< inputs since last output
+    uint8_t     order;              //!< number of stages
+    uint8_t     shift;              //!< output shift
+}CIC_t;
+
+#ifdef USE_CMSIS_DSP
+
+// CMSIS-DSP instance
+typedef arm_fir_decimate_instance_q15   FIR_DECIMATE_Q15_t;
+
+#else
+
+//! Q15 FIR decimator (layout of arm_fir_decimate_instance_q15)
+typedef struct _FIR_DECIMATE_Q15_t{
+    uint8_t     M;                  //!< decimation ratio
+    uint16_t    numTaps;            //!< number of coefficients
+    q15_t*      pCoeffs;            //!< time-reversed coefficients
+    q15_t*      pState;             //!< numTaps + blockSize - 1 samples
+}FIR_DECIMATE_Q15_t;
+
+#endif // USE_CMSIS_DSP
+
+//------------------------------- CIC ------------------------------------------
+//! Initialize CIC decimator, state is cleared
+bool cic_init(CIC_t* cic, uint8_t order, uint16_t ratio, uint8_t shift);
+
+//! Clear CIC state
+void cic_reset(CIC_t* cic);
+
+//! Decimate block of samples, returns number of outputs
+uint16_t cic_decimate(CIC_t* cic, const int16_t* src, uint16_t count,
+                      int16_t* dst);
+
+//------------------------------- FIR ------------------------------------------
+//! Initialize FIR decimator, state is cleared
+bool fir_decimate_q15_init(FIR_DECIMATE_Q15_t* fir, uint16_t numTaps,
+                           uint8_t ratio, const q15_t* coeffs, q15_t* state,
+                           uint32_t blockSize);
+
+//! Decimate block (multiple of ratio), blockSize/ratio outputs
+void fir_decimate_q15(const FIR_DECIMATE_Q15_t* fir, const q15_t* src,
+                      q15_t* dst, uint32_t blockSize);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // DECIMATE_H
+//! @}
+//******************************************************************************
+// End of file
+//******************************************************************************
@@ -10,12 +10,48 @@
 //!  Date       | Author           | Comments			
 //!  ---------- | ---------------- | --------------------------------
 //!  03/04/2016 | Bogdan Kokotenko | Initial draft
+//!  18/10/2026 | Bogdan Kokotenko | Added table-seeded isqrt and block RMS
 //
 //******************************************************************************
 #include "types.h"
+#include "dsp.h"
 
 #include <stdlib.h>
 
+//! Most significant bit position of non-zero value
+#if defined(__GNUC__) && !defined(__MSP430__)
+    // CLZ instruction or libgcc routine (Cortex-M0)
+    #define DSP_MSB16(x)    (31 - __builtin_clz(x))
+    #define DSP_MSB32(x)    (31 - __builtin_clz(x))
+    #define DSP_MSB64(x)    (63 - __builtin_clzll(x))
+#else
+    // Non-GNU compilers (IAR, Keil C51) and MSP430 GCC: binary search
+    #define DSP_MSB16(x)    dsp_msb32(x)
+    #define DSP_MSB32(x)    dsp_msb32(x)
+    #define DSP_MSB64(x)    (((x) >> 32) ? 32 + dsp_msb32((uint32_t)((x) >> 32)) \
+                                         : dsp_msb32((uint32_t)(x)))
+#endif
+
+//! Integral root of 0..255 (isqrt seed)
+static const uint8_t dsp_rootTable[256] = {
+     0,  1,  1,  1,  2,  2,  2,  2,  2,  3,  3,  3,  3,  3,  3,  3,
+     4,  4,  4,  4,  4,  4,  4,  4,  4,  5,  5,  5,  5,  5,  5,  5,
+     5,  5,  5,  5,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+     8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+     8,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,
+     9,  9,  9,  9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15
+};
+
 //------------------------------------------------------------------------------
 // Function:        fastRoot16()
 // Description:
@@ -68,6 +104,162 @@ uint16_t fastRoot32(uint32_t x)
     return y;
 }
 
+#if !defined(__GNUC__) || defined(__MSP430__)
+//------------------------------------------------------------------------------
+// Function:        dsp_msb32()
+// Description:
+//! \brief          Most significant bit position of non-zero value
+//------------------------------------------------------------------------------
+static uint8_t dsp_msb32(uint32_t x)
+{
+    uint8_t msb = 0;
+
+    if(x >> 16) { x >>= 16; msb += 16; }
+    if(x >> 8)  { x >>= 8;  msb += 8; }
+    if(x >> 4)  { x >>= 4;  msb += 4; }
+    if(x >> 2)  { x >>= 2;  msb += 2; }
+    if(x >> 1)  { msb += 1; }
+    return msb;
+}
+#endif
+
+//------------------------------------------------------------------------------
+// Function:        isqrt16()
+// Description:
+//! \brief          Integral root of 16-bit value (rounded down)
+//! \details        Top 8 bits (even shift) give first 4 root bits by table,
+//!                 remaining bits are found digit by digit, leading zeros
+//!                 are skipped and zero remainder exits.
+//! \param x        input integral value
+//------------------------------------------------------------------------------
+uint8_t isqrt16(uint16_t x)
+{
+    uint16_t root, rem;
+    uint8_t shift;
+
+    if(x < 256)
+        return dsp_rootTable[x];
+
+    // Even shift leaves 64..255 in table index
+    shift = (DSP_MSB16(x) - 6) & ~0x01;
+    root = dsp_rootTable[x >> shift];
+    rem = x - ((root*root) << shift);
+
+    while(shift)
+    {
+        uint16_t b;
+
+        if(rem == 0)
+            return (uint8_t)(root << (shift >> 1));
+
+        shift -= 2;
+        b = ((root << 2) + 1) << shift;
+        root <<= 1;
+        if(rem >= b)
+        {
+            rem -= b;
+            root |= 1;
+        }
+    }
+    return (uint8_t)root;
+}
+
+//------------------------------------------------------------------------------
+// Function:        isqrt32()
+// Description:
+//! \brief          Integral root of 32-bit value (rounded down)
+//! \param x        input integral value
+//------------------------------------------------------------------------------
+uint16_t isqrt32(uint32_t x)
+{
+    uint32_t root, rem;
+    uint8_t shift;
+
+    if(x < 256)
+        return dsp_rootTable[x];
+
+    shift = (DSP_MSB32(x) - 6) & ~0x01;
+    root = dsp_rootTable[x >> shift];
+    rem = x - ((root*root) << shift);
+
+    while(shift)
+    {
+        uint32_t b;
+
+        if(rem == 0)
+            return (uint16_t)(root << (shift >> 1));
+
+        shift -= 2;
+        b = ((root << 2) + 1) << shift;
+        root <<= 1;
+        if(rem >= b)
+        {
+            rem -= b;
+            root |= 1;
+        }
+    }
+    return (uint16_t)root;
+}
+
+//------------------------------------------------------------------------------
+// Function:        isqrt64()
+// Description:
+//! \brief          Integral root of 64-bit value (rounded down)
+//! \param x        input integral value
+//------------------------------------------------------------------------------
+uint32_t isqrt64(uint64_t x)
+{
+    uint64_t root, rem;
+    uint8_t shift;
+
+    if((x >> 32) == 0)
+        return isqrt32((uint32_t)x);
+
+    shift = (DSP_MSB64(x) - 6) & ~0x01;
+    root = dsp_rootTable[x >> shift];
+    rem = x - ((root*root) << shift);
+
+    while(shift)
+    {
+        uint64_t b;
+
+        if(rem == 0)
+            return (uint32_t)(root << (shift >> 1));
+
+        shift -= 2;
+        b = ((root << 2) + 1) << shift;
+        root <<= 1;
+        if(rem >= b)
+        {
+            rem -= b;
+            root |= 1;
+        }
+    }
+    return (uint32_t)root;
+}
+
+//------------------------------------------------------------------------------
+// Function:        blockRms16()
+// Description:
+//! \brief          Root mean square of block of samples (rounded down)
+//! \details        Squares are accumulated in 64 bits, single root per block.
+//! \param samples  input samples
+//! \param count    number of samples
+//------------------------------------------------------------------------------
+uint16_t blockRms16(const int16_t* samples, uint16_t count)
+{
+    uint64_t sumSq = 0;
+    uint16_t index;
+
+    if(count == 0)
+        return 0;
+
+    for(index = 0; index < count; index++)
+        sumSq += (uint32_t)((int32_t)samples[index]*samples[index]);
+
+    return (uint16_t)isqrt64(sumSq/count);
+}
+
 //******************************************************************************
 // End of file
 //******************************************************************************
@@ -13,11 +13,16 @@
 //!  Date       | Author           | Comments			
 //!  ---------- | ---------------- | ----------------
 //!  03/04/2016 | Bogdan Kokotenko | Initial draft
+//!  18/10/2026 | Bogdan Kokotenko | Added table-seeded isqrt and block RMS
 //
 //******************************************************************************
 #ifndef DSP_H
 #define DSP_H
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 //------------------------------------------------------------------------------
 // Macro:			CircularBuffer()
 // Description: 	
@@ -119,6 +124,22 @@ uint8_t fastRoot16(uint16_t x);
 //! Calculate fast root for 32-bit value
 uint16_t fastRoot32(uint32_t x);
 
+//! Integral root of 16-bit value (table seed, early exit)
+uint8_t isqrt16(uint16_t x);
+
+//! Integral root of 32-bit value (table seed, early exit)
+uint16_t isqrt32(uint32_t x);
+
+//! Integral root of 64-bit value (table seed, early exit)
+uint32_t isqrt64(uint64_t x);
+
+//! Root mean square of block of samples
+uint16_t blockRms16(const int16_t* samples, uint16_t count);
+
+#ifdef __cplusplus
+}
+#endif
+
 //! @}
 #endif // DSP_H
 //******************************************************************************
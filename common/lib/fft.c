@@ -0,0 +1,398 @@
+//******************************************************************************
+// Copyright (C) 2026 Bogdan Kokotenko
+//
+//	File description:
+//! \file       lib\fft.c
+//! \brief      Q15 complex FFT and multi-bin Goertzel tone detector
+//!
+//! \details    Radix-4 decimation in time over bit-reversed samples: four
+//!             sub-transforms of length L lie in the order F0, F2, F1, F3
+//!             (two low index bits are reversed), butterfly takes 3
+//!             complex multiplications and stores (sum >> 2).
+//!
+//!*****************************************************************************
+//! __Revisions:__
+//!  Date       | Author           | Comments
+//!  ---------- | ---------------- | --------------------------------
+//!  18/10/2026 | Bogdan Kokotenko | Initial draft
+//
+//******************************************************************************
+#include "types.h"
+#include "dsp.h"
+#include "fft.h"
+
+#if (FFT_MAX_SIZE < 16) || (FFT_MAX_SIZE > 4096) ||                         \
+    (FFT_MAX_SIZE & (FFT_MAX_SIZE - 1))
+#error "FFT_MAX_SIZE has to be power of two, 16..4096"
+#endif
+
+#ifndef USE_CMSIS_DSP
+
+//! Quarter-wave length of sine table
+#define FFT_QUARTER         (FFT_MAX_SIZE/4)
+
+//! Sine table entry: sin(pi/2*i/FFT_QUARTER)
+#define FFT_SIN_ENTRY(i)    FFT_Q15(FFT_SIN(FFT_PI/2*(i)/FFT_QUARTER))
+
+// Table generators (2^n entries from i)
+#define FFT_TABLE_2(i)      FFT_SIN_ENTRY(i), FFT_SIN_ENTRY(i + 1)
+#define FFT_TABLE_4(i)      FFT_TABLE_2(i), FFT_TABLE_2(i + 2)
+#define FFT_TABLE_8(i)      FFT_TABLE_4(i), FFT_TABLE_4(i + 4)
+#define FFT_TABLE_16(i)     FFT_TABLE_8(i), FFT_TABLE_8(i + 8)
+#define FFT_TABLE_32(i)     FFT_TABLE_16(i), FFT_TABLE_16(i + 16)
+#define FFT_TABLE_64(i)     FFT_TABLE_32(i), FFT_TABLE_32(i + 32)
+#define FFT_TABLE_128(i)    FFT_TABLE_64(i), FFT_TABLE_64(i + 64)
+#define FFT_TABLE_256(i)    FFT_TABLE_128(i), FFT_TABLE_128(i + 128)
+#define FFT_TABLE_512(i)    FFT_TABLE_256(i), FFT_TABLE_256(i + 256)
+#define FFT_TABLE_1024(i)   FFT_TABLE_512(i), FFT_TABLE_512(i + 512)
+
+#if FFT_QUARTER == 4
+    #define FFT_TABLE       FFT_TABLE_4(0)
+#elif FFT_QUARTER == 8
+    #define FFT_TABLE       FFT_TABLE_8(0)
+#elif FFT_QUARTER == 16
+    #define FFT_TABLE       FFT_TABLE_16(0)
+#elif FFT_QUARTER == 32
+    #define FFT_TABLE       FFT_TABLE_32(0)
+#elif FFT_QUARTER == 64
+    #define FFT_TABLE       FFT_TABLE_64(0)
+#elif FFT_QUARTER == 128
+    #define FFT_TABLE       FFT_TABLE_128(0)
+#elif FFT_QUARTER == 256
+    #define FFT_TABLE       FFT_TABLE_256(0)
+#elif FFT_QUARTER == 512
+    #define FFT_TABLE       FFT_TABLE_512(0)
+#else
+    #define FFT_TABLE       FFT_TABLE_1024(0)
+#endif
+
+//! Quarter-wave sine table (Q15)
+static const int16_t fft_sinTable[FFT_QUARTER + 1] = {
+    FFT_TABLE, FFT_SIN_ENTRY(FFT_QUARTER)
+};
+
+//------------------------------------------------------------------------------
+// Function:        fft_twiddle()
+// Description:
+//! \brief          Cosine and sine of 2*pi*m/FFT_MAX_SIZE, m < 3/4 of period
+//------------------------------------------------------------------------------
+static inline void fft_twiddle(uint16_t m, int16_t* c, int16_t* s)
+{
+    if(m <= FFT_QUARTER)
+    {
+        *s = fft_sinTable[m];
+        *c = fft_sinTable[FFT_QUARTER - m];
+    }
+    else if(m <= 2*FFT_QUARTER)
+    {
+        *s = fft_sinTable[2*FFT_QUARTER - m];
+        *c = -fft_sinTable[m - FFT_QUARTER];
+    }
+    else
+    {
+        *s = -fft_sinTable[m - 2*FFT_QUARTER];
+        *c = -fft_sinTable[3*FFT_QUARTER - m];
+    }
+}
+
+//------------------------------------------------------------------------------
+// Function:        fft_sat16()
+// Description:
+//! \brief          Saturate to Q15
+//------------------------------------------------------------------------------
+static inline q15_t fft_sat16(int32_t x)
+{
+    if(x > INT16_MAX)
+        return INT16_MAX;
+    if(x < INT16_MIN)
+        return INT16_MIN;
+    return (q15_t)x;
+}
+
+//------------------------------------------------------------------------------
+// Function:        fft_bitReverse()
+// Description:
+//! \brief          Reorder complex samples by bit-reversed index
+//------------------------------------------------------------------------------
+static void fft_bitReverse(q15_t* data, uint16_t size)
+{
+    uint16_t index, reversed = 0, bit;
+
+    for(index = 0; index < size; index++)
+    {
+        if(index < reversed)
+        {
+            q15_t re = data[2*index], im = data[2*index + 1];
+            data[2*index] = data[2*reversed];
+            data[2*index + 1] = data[2*reversed + 1];
+            data[2*reversed] = re;
+            data[2*reversed + 1] = im;
+        }
+
+        bit = size >> 1;
+        while(reversed & bit)
+        {
+            reversed ^= bit;
+            bit >>= 1;
+        }
+        reversed |= bit;
+    }
+}
+
+#endif // USE_CMSIS_DSP
+
+//------------------------------------------------------------------------------
+// Function:        fft_q15_init()
+// Description:
+//! \brief          Initialize complex FFT
+//! \param fft      FFT instance
+//! \param size     number of complex samples, power of two 16..FFT_MAX_SIZE
+//! \return         false, if size is invalid
+//------------------------------------------------------------------------------
+bool fft_q15_init(FFT_Q15_t* fft, uint16_t size)
+{
+    if(size < 16 || size > FFT_MAX_SIZE || (size & (size - 1)))
+        return false;
+
+    fft->size = size;
+#ifdef USE_CMSIS_DSP
+    switch(size)
+    {
+    case 16:   fft->pCfft = &arm_cfft_sR_q15_len16;   break;
+    case 32:   fft->pCfft = &arm_cfft_sR_q15_len32;   break;
+    case 64:   fft->pCfft = &arm_cfft_sR_q15_len64;   break;
+    case 128:  fft->pCfft = &arm_cfft_sR_q15_len128;  break;
+    case 256:  fft->pCfft = &arm_cfft_sR_q15_len256;  break;
+    case 512:  fft->pCfft = &arm_cfft_sR_q15_len512;  break;
+    case 1024: fft->pCfft = &arm_cfft_sR_q15_len1024; break;
+    case 2048: fft->pCfft = &arm_cfft_sR_q15_len2048; break;
+    default:   fft->pCfft = &arm_cfft_sR_q15_len4096; break;
+    }
+#else
+    fft->stride = FFT_MAX_SIZE/size;
+    for(fft->log2Size = 0; (1u << fft->log2Size) < size; fft->log2Size++);
+#endif
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// Function:        fft_q15()
+// Description:
+//! \brief          In-place complex FFT of interleaved samples {re, im}
+//! \details        Output is scaled by 1/size, both directions.
+//! \param fft      FFT instance
+//! \param data     2*size samples, natural order in and out
+//! \param inverse  true for inverse transform
+//------------------------------------------------------------------------------
+void fft_q15(const FFT_Q15_t* fft, q15_t* data, bool inverse)
+{
+#ifdef USE_CMSIS_DSP
+    arm_cfft_q15(fft->pCfft, data, inverse, 1);
+#else
+    uint16_t size = fft->size;
+    uint16_t length = 1;
+    uint16_t k, base;
+
+    fft_bitReverse(data, size);
+
+    // Radix-2 stage for odd log2(size)
+    if(fft->log2Size & 0x01)
+    {
+        for(base = 0; base < 2*size; base += 4)
+        {
+            int16_t re = data[base], im = data[base + 1];
+            data[base] = (q15_t)((re + data[base + 2]) >> 1);
+            data[base + 1] = (q15_t)((im + data[base + 3]) >> 1);
+            data[base + 2] = (q15_t)((re - data[base + 2]) >> 1);
+            data[base + 3] = (q15_t)((im - data[base + 3]) >> 1);
+        }
+        length = 2;
+    }
+
+    // Radix-4 stages, twiddles are taken once per k for all groups
+    for(; length < size; length *= 4)
+    {
+        uint16_t span = 4*length;
+        uint16_t step = FFT_MAX_SIZE/span;
+
+        for(k = 0; k < length; k++)
+        {
+            int16_t c1, s1, c2, s2, c3, s3;
+
+            fft_twiddle(k*step, &c1, &s1);
+            fft_twiddle(2*k*step, &c2, &s2);
+            fft_twiddle(3*k*step, &c3, &s3);
+            if(inverse)
+            {
+                s1 = -s1;
+                s2 = -s2;
+                s3 = -s3;
+            }
+
+            for(base = k; base < size; base += span)
+            {
+                q15_t* x0 = data + 2*base;
+                q15_t* x1 = x0 + 2*length;      // F2
+                q15_t* x2 = x1 + 2*length;      // F1
+                q15_t* x3 = x2 + 2*length;      // F3
+                int32_t t1r, t1i, t2r, t2i, t3r, t3i;
+                int32_t ar, ai, br, bi, cr, ci, dr, di;
+
+                // t = x*(c - js)
+                t1r = ((int32_t)x2[0]*c1 + (int32_t)x2[1]*s1) >> 15;
+                t1i = ((int32_t)x2[1]*c1 - (int32_t)x2[0]*s1) >> 15;
+                t2r = ((int32_t)x1[0]*c2 + (int32_t)x1[1]*s2) >> 15;
+                t2i = ((int32_t)x1[1]*c2 - (int32_t)x1[0]*s2) >> 15;
+                t3r = ((int32_t)x3[0]*c3 + (int32_t)x3[1]*s3) >> 15;
+                t3i = ((int32_t)x3[1]*c3 - (int32_t)x3[0]*s3) >> 15;
+
+                ar = x0[0] + t2r;
+                ai = x0[1] + t2i;
+                br = x0[0] - t2r;
+                bi = x0[1] - t2i;
+                cr = t1r + t3r;
+                ci = t1i + t3i;
+                dr = t1r - t3r;
+                di = t1i - t3i;
+
+                x0[0] = fft_sat16((ar + cr) >> 2);
+                x0[1] = fft_sat16((ai + ci) >> 2);
+                x2[0] = fft_sat16((ar - cr) >> 2);
+                x2[1] = fft_sat16((ai - ci) >> 2);
+                if(inverse)
+                {
+                    // b + jd, b - jd
+                    x1[0] = fft_sat16((br - di) >> 2);
+                    x1[1] = fft_sat16((bi + dr) >> 2);
+                    x3[0] = fft_sat16((br + di) >> 2);
+                    x3[1] = fft_sat16((bi - dr) >> 2);
+                }
+                else
+                {
+                    // b - jd, b + jd
+                    x1[0] = fft_sat16((br + di) >> 2);
+                    x1[1] = fft_sat16((bi - dr) >> 2);
+                    x3[0] = fft_sat16((br - di) >> 2);
+                    x3[1] = fft_sat16((bi + dr) >> 2);
+                }
+            }
+        }
+    }
+#endif
+}
+
+//------------------------------------------------------------------------------
+// Function:        fft_magnitude_q15()
+// Description:
+//! \brief          Magnitudes of complex samples
+//! \param data     interleaved complex samples
+//! \param magnitude output, same scale as samples (up to 46341)
+//! \param count    number of complex samples
+//------------------------------------------------------------------------------
+void fft_magnitude_q15(const q15_t* data, uint16_t* magnitude,
+                       uint16_t count)
+{
+    while(count--)
+    {
+        int32_t re = data[0], im = data[1];
+        *magnitude++ = isqrt32((uint32_t)(re*re) + (uint32_t)(im*im));
+        data += 2;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Function:        goertzel_init()
+// Description:
+//! \brief          Initialize Goertzel detector
+//! \param goertzel detector instance
+//! \param coeffs   GOERTZEL_COEFF() per bin
+//! \param state    GOERTZEL_STATE_SIZE(bins) accumulators
+//! \param bins     number of bins
+//------------------------------------------------------------------------------
+void goertzel_init(GOERTZEL_t* goertzel, const int16_t* coeffs,
+                   int32_t* state, uint8_t bins)
+{
+    goertzel->coeffs = coeffs;
+    goertzel->state = state;
+    goertzel->bins = bins;
+    goertzel_reset(goertzel);
+}
+
+//------------------------------------------------------------------------------
+// Function:        goertzel_reset()
+// Description:
+//! \brief          Clear accumulators
+//------------------------------------------------------------------------------
+void goertzel_reset(GOERTZEL_t* goertzel)
+{
+    memset(goertzel->state, 0,
+           GOERTZEL_STATE_SIZE(goertzel->bins)*sizeof(int32_t));
+    goertzel->count = 0;
+}
+
+//------------------------------------------------------------------------------
+// Function:        goertzel_block()
+// Description:
+//! \brief          Process block of samples for all bins
+//! \details        s = x + 2cos(w)*s1 - s2
+//------------------------------------------------------------------------------
+void goertzel_block(GOERTZEL_t* goertzel, const q15_t* samples,
+                    uint16_t count)
+{
+    uint8_t bin;
+
+    for(bin = 0; bin < goertzel->bins; bin++)
+    {
+        int32_t coeff = goertzel->coeffs[bin];
+        int32_t s1 = goertzel->state[2*bin];
+        int32_t s2 = goertzel->state[2*bin + 1];
+        uint16_t index;
+
+        for(index = 0; index < count; index++)
+        {
+            int32_t s0 = samples[index] +
+                         (int32_t)(((int64_t)coeff*s1) >> 14) - s2;
+            s2 = s1;
+            s1 = s0;
+        }
+
+        goertzel->state[2*bin] = s1;
+        goertzel->state[2*bin + 1] = s2;
+    }
+    goertzel->count += count;
+}
+
+//------------------------------------------------------------------------------
+// Function:        goertzel_magnitude()
+// Description:
+//! \brief          DFT magnitude of bin: s1^2 + s2^2 - 2cos(w)*s1*s2
+//------------------------------------------------------------------------------
+uint32_t goertzel_magnitude(const GOERTZEL_t* goertzel, uint8_t bin)
+{
+    int64_t s1 = goertzel->state[2*bin];
+    int64_t s2 = goertzel->state[2*bin + 1];
+    int64_t power = s1*s1 + s2*s2 -
+                    ((goertzel->coeffs[bin]*s1) >> 14)*s2;
+
+    return (power > 0) ? isqrt64((uint64_t)power) : 0;
+}
+
+//------------------------------------------------------------------------------
+// Function:        goertzel_amplitude()
+// Description:
+//! \brief          Tone amplitude of bin (2*magnitude/samples)
+//------------------------------------------------------------------------------
+uint16_t goertzel_amplitude(const GOERTZEL_t* goertzel, uint8_t bin)
+{
+    uint32_t amplitude;
+
+    if(goertzel->count == 0)
+        return 0;
+
+    amplitude = 2*(uint64_t)goertzel_magnitude(goertzel, bin)/goertzel->count;
+    return (amplitude > UINT16_MAX) ? UINT16_MAX : (uint16_t)amplitude;
+}
+
+//******************************************************************************
+// End of file
+//******************************************************************************
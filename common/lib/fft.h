@@ -0,0 +1,157 @@
+//******************************************************************************
+// Copyright (C) 2026 Bogdan Kokotenko
+//
+//! \addtogroup libs
+//! @{
+//******************************************************************************
+//   File description:
+//! \file   lib\fft.h
+//! \brief  Q15 complex FFT and multi-bin Goertzel tone detector
+//!
+//! \details FFT works in place on interleaved complex samples {re, im, ...}
+//!          of power-of-two length 16..FFT_MAX_SIZE: bit reversal, one
+//!          radix-2 stage for odd log2(size), then radix-4 stages. Every
+//!          stage scales down by its radix, so output is X[k]/size (same
+//!          format as CMSIS arm_cfft_q15). Input complex magnitude has to
+//!          be below 1.0 (any real Q15 signal).
+//!
+//!          Twiddles are taken from quarter-wave sine table of
+//!          FFT_MAX_SIZE/4 + 1 entries generated at compile time, smaller
+//!          sizes use it with stride.
+//!
+//!          With USE_CMSIS_DSP defined (STM32 projects) fft_q15() calls
+//!          arm_cfft_q15() with predefined arm_cfft_sR_q15_lenXX instance.
+//!
+//!          Goertzel detector updates selected bins per sample (O(bins) per
+//!          sample, no buffering), e.g. DTMF or vibration harmonics check.
+//!          Accumulator limit: samples*32768/sin(2*pi*Freq/Rate) < 2^31.
+//!
+//! \code
+//!   static const int16_t coeffs[2] = { GOERTZEL_COEFF(697, 8000),
+//!                                      GOERTZEL_COEFF(1209, 8000) };
+//!   static int32_t state[GOERTZEL_STATE_SIZE(2)];
+//!   goertzel_init(&tone, coeffs, state, 2);
+//!   goertzel_block(&tone, adcBlock, 205);
+//!   if(goertzel_amplitude(&tone, 0) > THRESHOLD) ...
+//! \endcode
+//!
+//!*****************************************************************************
+//! __Revisions:__
+//!  Date       | Author           | Comments
+//!  ---------- | ---------------- | ----------------
+//!  18/10/2026 | Bogdan Kokotenko | Initial draft
+//
+//******************************************************************************
+#ifndef FFT_H
+#define FFT_H
+
+#include "filter.h"
+
+#ifdef USE_CMSIS_DSP
+#include "arm_const_structs.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//! Maximal FFT size (sine table size)
+#ifndef FFT_MAX_SIZE
+#define FFT_MAX_SIZE        1024
+#endif
+
+//! Pi for compile time tables
+#define FFT_PI              3.14159265358979323846
+
+//------------------------------------------------------------------------------
+// Macro:			FFT_SIN()
+// Description:
+//! \brief          Sine of argument in [-pi/2, pi/2] (Taylor series, double)
+//! \details        Constant expression: used for tables at compile time.
+//! \hideinitializer
+//------------------------------------------------------------------------------
+#define FFT_SIN(t)                                                          \
+    ((t)*(1 - (t)*(t)/6*(1 - (t)*(t)/20*(1 - (t)*(t)/42*(1 - (t)*(t)/72*  \
+    (1 - (t)*(t)/110*(1 - (t)*(t)/156*(1 - (t)*(t)/210))))))))
+
+//------------------------------------------------------------------------------
+// Macro:			FFT_Q15()
+// Description:
+//! \brief          Round value in [-1, 1] to Q15 (1.0 is saturated)
+//! \hideinitializer
+//------------------------------------------------------------------------------
+#define FFT_Q15(x)                                                          \
+    ((int16_t)((x)*32768 >= 32767 ? 32767 :                                 \
+               (x)*32768 + ((x) >= 0 ? 0.5 : -0.5)))
+
+//------------------------------------------------------------------------------
+// Macro:			GOERTZEL_COEFF()
+// Description:
+//! \brief          Goertzel coefficient 2*cos(2*pi*Freq/Rate) in Q14
+//! \param Freq     tone frequency, up to Rate/2
+//! \param Rate     sampling rate
+//! \hideinitializer
+//------------------------------------------------------------------------------
+#define GOERTZEL_COEFF(Freq, Rate)                                          \
+    FFT_Q15(FFT_SIN(FFT_PI/2 - 2*FFT_PI*(double)(Freq)/(Rate)))
+
+//! Goertzel state size (accumulators)
+#define GOERTZEL_STATE_SIZE(bins)   (2*(bins))
+
+//! Complex FFT instance
+typedef struct _FFT_Q15_t{
+    uint16_t    size;               //!< number of complex samples
+#ifdef USE_CMSIS_DSP
+    const arm_cfft_instance_q15* pCfft; //!< CMSIS-DSP instance
+#else
+    uint16_t    stride;             //!< sine table stride
+    uint8_t     log2Size;           //!< log2(size)
+#endif
+}FFT_Q15_t;
+
+//! Goertzel multi-bin detector
+typedef struct _GOERTZEL_t{
+    const int16_t*  coeffs;         //!< 2*cos(w) in Q14 per bin
+    int32_t*        state;          //!< {s1, s2} per bin
+    uint16_t        count;          //!< samples since reset
+    uint8_t         bins;           //!< number of bins
+}GOERTZEL_t;
+
+//------------------------------- FFT ------------------------------------------
+//! Initialize FFT of size (power of two, 16..FFT_MAX_SIZE) complex samples
+bool fft_q15_init(FFT_Q15_t* fft, uint16_t size);
+
+//! In-place complex FFT (scaled by 1/size) of interleaved samples
+void fft_q15(const FFT_Q15_t* fft, q15_t* data, bool inverse);
+
+//! Magnitudes of count complex samples (same scale as samples)
+void fft_magnitude_q15(const q15_t* data, uint16_t* magnitude,
+                       uint16_t count);
+
+//------------------------------- Goertzel -------------------------------------
+//! Initialize detector, state is cleared
+void goertzel_init(GOERTZEL_t* goertzel, const int16_t* coeffs,
+                   int32_t* state, uint8_t bins);
+
+//! Clear accumulators (start of the next block)
+void goertzel_reset(GOERTZEL_t* goertzel);
+
+//! Process block of samples for all bins
+void goertzel_block(GOERTZEL_t* goertzel, const q15_t* samples,
+                    uint16_t count);
+
+//! DFT magnitude of bin over samples since reset
+uint32_t goertzel_magnitude(const GOERTZEL_t* goertzel, uint8_t bin);
+
+//! Tone amplitude of bin (2*magnitude/samples, sample scale)
+uint16_t goertzel_amplitude(const GOERTZEL_t* goertzel, uint8_t bin);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // FFT_H
+//! @}
+//******************************************************************************
+// End of file
+//******************************************************************************
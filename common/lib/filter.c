@@ -0,0 +1,334 @@
+//******************************************************************************
+// Copyright (C) 2026 Bogdan Kokotenko
+//
+//	File description:
+//! \file       lib\filter.c
+//! \brief      Q15/Q31 FIR and cascaded biquad filters for blocks of samples
+//!
+//! \details    Portable path follows CMSIS-DSP Cortex-M0 implementation:
+//!             FIR copies new samples after numTaps - 1 previous ones in
+//!             the state, so every output is a contiguous dot product,
+//!             then moves the last numTaps - 1 samples to the state start.
+//!
+//!*****************************************************************************
+//! __Revisions:__
+//!  Date       | Author           | Comments
+//!  ---------- | ---------------- | --------------------------------
+//!  18/10/2026 | Bogdan Kokotenko | Initial draft
+//
+//******************************************************************************
+#include "types.h"
+#include "filter.h"
+
+#ifndef USE_CMSIS_DSP
+
+//------------------------------------------------------------------------------
+// Function:        filter_sat16()
+// Description:
+//! \brief          Saturate accumulator to Q15
+//------------------------------------------------------------------------------
+static inline q15_t filter_sat16(int64_t acc)
+{
+    if(acc > INT16_MAX)
+        return INT16_MAX;
+    if(acc < INT16_MIN)
+        return INT16_MIN;
+    return (q15_t)acc;
+}
+
+#endif // USE_CMSIS_DSP
+
+//------------------------------------------------------------------------------
+// Function:        fir_q15_init()
+// Description:
+//! \brief          Initialize Q15 FIR filter
+//! \param fir      filter instance
+//! \param numTaps  number of coefficients, even and at least 4
+//! \param coeffs   time-reversed coefficients
+//! \param state    FIR_STATE_SIZE(numTaps, blockSize) samples
+//! \param blockSize maximal block size
+//! \return         false, if numTaps is invalid
+//------------------------------------------------------------------------------
+bool fir_q15_init(FIR_Q15_t* fir, uint16_t numTaps, const q15_t* coeffs,
+                  q15_t* state, uint32_t blockSize)
+{
+#ifdef USE_CMSIS_DSP
+    return arm_fir_init_q15(fir, numTaps, (q15_t*)coeffs, state,
+                            blockSize) == ARM_MATH_SUCCESS;
+#else
+    if(numTaps < 4 || (numTaps & 0x01))
+        return false;
+
+    fir->numTaps = numTaps;
+    fir->pCoeffs = (q15_t*)coeffs;
+    fir->pState = state;
+    memset(state, 0, FIR_STATE_SIZE(numTaps, blockSize)*sizeof(q15_t));
+    return true;
+#endif
+}
+
+//------------------------------------------------------------------------------
+// Function:        fir_q15()
+// Description:
+//! \brief          Filter block of Q15 samples
+//! \param fir      filter instance
+//! \param src      input samples
+//! \param dst      output samples (could be the same as src)
+//! \param blockSize number of samples, up to blockSize of init
+//------------------------------------------------------------------------------
+void fir_q15(const FIR_Q15_t* fir, const q15_t* src, q15_t* dst,
+             uint32_t blockSize)
+{
+#ifdef USE_CMSIS_DSP
+    arm_fir_q15(fir, (q15_t*)src, dst, blockSize);
+#else
+    q15_t* history = fir->pState;
+    q15_t* input = fir->pState + (fir->numTaps - 1);
+    uint32_t index;
+    uint16_t tap;
+
+    for(index = 0; index < blockSize; index++)
+    {
+        const q15_t* sample = history + index;
+        int64_t acc = 0;
+
+        input[index] = src[index];
+        for(tap = 0; tap < fir->numTaps; tap++)
+            acc += (int32_t)sample[tap]*fir->pCoeffs[tap];
+
+        dst[index] = filter_sat16(acc >> 15);
+    }
+
+    memmove(history, history + blockSize, (fir->numTaps - 1)*sizeof(q15_t));
+#endif
+}
+
+//------------------------------------------------------------------------------
+// Function:        fir_q31_init()
+// Description:
+//! \brief          Initialize Q31 FIR filter
+//! \param fir      filter instance
+//! \param numTaps  number of coefficients
+//! \param coeffs   time-reversed coefficients
+//! \param state    FIR_STATE_SIZE(numTaps, blockSize) samples
+//! \param blockSize maximal block size
+//! \return         false, if numTaps is invalid
+//------------------------------------------------------------------------------
+bool fir_q31_init(FIR_Q31_t* fir, uint16_t numTaps, const q31_t* coeffs,
+                  q31_t* state, uint32_t blockSize)
+{
+    if(numTaps == 0)
+        return false;
+
+#ifdef USE_CMSIS_DSP
+    arm_fir_init_q31(fir, numTaps, (q31_t*)coeffs, state, blockSize);
+#else
+    fir->numTaps = numTaps;
+    fir->pCoeffs = (q31_t*)coeffs;
+    fir->pState = state;
+    memset(state, 0, FIR_STATE_SIZE(numTaps, blockSize)*sizeof(q31_t));
+#endif
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// Function:        fir_q31()
+// Description:
+//! \brief          Filter block of Q31 samples
+//! \details        Output is truncated: coefficients have to provide
+//!                 guard bits (sum of |b| below 1).
+//! \param fir      filter instance
+//! \param src      input samples
+//! \param dst      output samples (could be the same as src)
+//! \param blockSize number of samples, up to blockSize of init
+//------------------------------------------------------------------------------
+void fir_q31(const FIR_Q31_t* fir, const q31_t* src, q31_t* dst,
+             uint32_t blockSize)
+{
+#ifdef USE_CMSIS_DSP
+    arm_fir_q31(fir, (q31_t*)src, dst, blockSize);
+#else
+    q31_t* history = fir->pState;
+    q31_t* input = fir->pState + (fir->numTaps - 1);
+    uint32_t index;
+    uint16_t tap;
+
+    for(index = 0; index < blockSize; index++)
+    {
+        const q31_t* sample = history + index;
+        int64_t acc = 0;
+
+        input[index] = src[index];
+        for(tap = 0; tap < fir->numTaps; tap++)
+            acc += (int64_t)sample[tap]*fir->pCoeffs[tap];
+
+        dst[index] = (q31_t)(acc >> 31);
+    }
+
+    memmove(history, history + blockSize, (fir->numTaps - 1)*sizeof(q31_t));
+#endif
+}
+
+//------------------------------------------------------------------------------
+// Function:        biquad_q15_init()
+// Description:
+//! \brief          Initialize Q15 biquad cascade
+//! \param biquad   filter instance
+//! \param numStages number of 2nd order stages
+//! \param coeffs   {b0, 0, b1, b2, a1, a2} per stage
+//! \param state    BIQUAD_STATE_SIZE(numStages) samples
+//! \param postShift coefficients scale (2^postShift)
+//------------------------------------------------------------------------------
+void biquad_q15_init(BIQUAD_Q15_t* biquad, uint8_t numStages,
+                     const q15_t* coeffs, q15_t* state, int8_t postShift)
+{
+#ifdef USE_CMSIS_DSP
+    arm_biquad_cascade_df1_init_q15(biquad, numStages, (q15_t*)coeffs,
+                                    state, postShift);
+#else
+    biquad->numStages = (int8_t)numStages;
+    biquad->pCoeffs = (q15_t*)coeffs;
+    biquad->pState = state;
+    biquad->postShift = postShift;
+    memset(state, 0, BIQUAD_STATE_SIZE(numStages)*sizeof(q15_t));
+#endif
+}
+
+//------------------------------------------------------------------------------
+// Function:        biquad_q15()
+// Description:
+//! \brief          Filter block of Q15 samples
+//! \param biquad   filter instance
+//! \param src      input samples
+//! \param dst      output samples (could be the same as src)
+//! \param blockSize number of samples
+//------------------------------------------------------------------------------
+void biquad_q15(const BIQUAD_Q15_t* biquad, const q15_t* src, q15_t* dst,
+                uint32_t blockSize)
+{
+#ifdef USE_CMSIS_DSP
+    arm_biquad_cascade_df1_q15(biquad, (q15_t*)src, dst, blockSize);
+#else
+    const q15_t* coeffs = biquad->pCoeffs;
+    q15_t* state = biquad->pState;
+    uint8_t shift = 15 - biquad->postShift;
+    int8_t stage;
+
+    for(stage = 0; stage < biquad->numStages; stage++)
+    {
+        q15_t b0 = coeffs[0], b1 = coeffs[2], b2 = coeffs[3];
+        q15_t a1 = coeffs[4], a2 = coeffs[5];
+        q15_t x1 = state[0], x2 = state[1], y1 = state[2], y2 = state[3];
+        uint32_t index;
+
+        // Stage output overwrites dst, next stage takes it as input
+        for(index = 0; index < blockSize; index++)
+        {
+            q15_t x = src[index];
+            int64_t acc = (int32_t)b0*x;
+
+            acc += (int32_t)b1*x1;
+            acc += (int32_t)b2*x2;
+            acc += (int32_t)a1*y1;
+            acc += (int32_t)a2*y2;
+
+            x2 = x1;
+            x1 = x;
+            y2 = y1;
+            y1 = filter_sat16(acc >> shift);
+            dst[index] = y1;
+        }
+
+        state[0] = x1;
+        state[1] = x2;
+        state[2] = y1;
+        state[3] = y2;
+
+        coeffs += 6;
+        state += 4;
+        src = dst;
+    }
+#endif
+}
+
+//------------------------------------------------------------------------------
+// Function:        biquad_q31_init()
+// Description:
+//! \brief          Initialize Q31 biquad cascade
+//! \param biquad   filter instance
+//! \param numStages number of 2nd order stages
+//! \param coeffs   {b0, b1, b2, a1, a2} per stage
+//! \param state    BIQUAD_STATE_SIZE(numStages) samples
+//! \param postShift coefficients scale (2^postShift)
+//------------------------------------------------------------------------------
+void biquad_q31_init(BIQUAD_Q31_t* biquad, uint8_t numStages,
+                     const q31_t* coeffs, q31_t* state, int8_t postShift)
+{
+#ifdef USE_CMSIS_DSP
+    arm_biquad_cascade_df1_init_q31(biquad, numStages, (q31_t*)coeffs,
+                                    state, postShift);
+#else
+    biquad->numStages = numStages;
+    biquad->pCoeffs = (q31_t*)coeffs;
+    biquad->pState = state;
+    biquad->postShift = (uint8_t)postShift;
+    memset(state, 0, BIQUAD_STATE_SIZE(numStages)*sizeof(q31_t));
+#endif
+}
+
+//------------------------------------------------------------------------------
+// Function:        biquad_q31()
+// Description:
+//! \brief          Filter block of Q31 samples
+//! \details        Output is truncated to Q31 as by CMSIS-DSP.
+//! \param biquad   filter instance
+//! \param src      input samples
+//! \param dst      output samples (could be the same as src)
+//! \param blockSize number of samples
+//------------------------------------------------------------------------------
+void biquad_q31(const BIQUAD_Q31_t* biquad, const q31_t* src, q31_t* dst,
+                uint32_t blockSize)
+{
+#ifdef USE_CMSIS_DSP
+    arm_biquad_cascade_df1_q31(biquad, (q31_t*)src, dst, blockSize);
+#else
+    const q31_t* coeffs = biquad->pCoeffs;
+    q31_t* state = biquad->pState;
+    uint8_t shift = 31 - biquad->postShift;
+    uint32_t stage;
+
+    for(stage = 0; stage < biquad->numStages; stage++)
+    {
+        q31_t b0 = coeffs[0], b1 = coeffs[1], b2 = coeffs[2];
+        q31_t a1 = coeffs[3], a2 = coeffs[4];
+        q31_t x1 = state[0], x2 = state[1], y1 = state[2], y2 = state[3];
+        uint32_t index;
+
+        for(index = 0; index < blockSize; index++)
+        {
+            q31_t x = src[index];
+            int64_t acc = (int64_t)b0*x + (int64_t)b1*x1 + (int64_t)b2*x2 +
+                          (int64_t)a1*y1 + (int64_t)a2*y2;
+
+            x2 = x1;
+            x1 = x;
+            y2 = y1;
+            y1 = (q31_t)(acc >> shift);
+            dst[index] = y1;
+        }
+
+        state[0] = x1;
+        state[1] = x2;
+        state[2] = y1;
+        state[3] = y2;
+
+        coeffs += 5;
+        state += 4;
+        src = dst;
+    }
+#endif
+}
+
+//******************************************************************************
+// End of file
+//******************************************************************************
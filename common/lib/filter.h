@@ -0,0 +1,149 @@
+//******************************************************************************
+// Copyright (C) 2026 Bogdan Kokotenko
+//
+//! \addtogroup libs
+//! @{
+//******************************************************************************
+//   File description:
+//! \file   lib\filter.h
+//! \brief  Q15/Q31 FIR and cascaded biquad filters for blocks of samples
+//!
+//! \details Filters process blocks of samples (e.g. DMA ADC buffers) and
+//!          keep the state between blocks, so any block split gives the
+//!          same output. Data layouts and arithmetic follow CMSIS-DSP:
+//!          - FIR: coefficients in time-reversed order b[N-1]..b[0],
+//!            state of FIR_STATE_SIZE(numTaps, blockSize) samples,
+//!            64-bit accumulator, Q15 output saturated, Q31 truncated
+//!          - biquad (direct form I): per stage {b0, 0, b1, b2, a1, a2}
+//!            (Q15) or {b0, b1, b2, a1, a2} (Q31), coefficients scaled
+//!            down by 2^postShift, y = b0*x + b1*x1 + b2*x2 + a1*y1 + a2*y2
+//!            (feedback signs are inverted compared to MATLAB)
+//!
+//!          With USE_CMSIS_DSP defined (STM32 projects, together with
+//!          ARM_MATH_CM0 and CMSIS-DSP library linked), calls are passed
+//!          to arm_fir_xxx()/arm_biquad_cascade_df1_xxx(). Portable C
+//!          path is bit-exact with them.
+//!
+//! \note    Q15 FIR numTaps has to be even and at least 4 (CMSIS limit).
+//!
+//!*****************************************************************************
+//! __Revisions:__
+//!  Date       | Author           | Comments
+//!  ---------- | ---------------- | ----------------
+//!  18/10/2026 | Bogdan Kokotenko | Initial draft
+//
+//******************************************************************************
+#ifndef FILTER_H
+#define FILTER_H
+
+#ifdef USE_CMSIS_DSP
+#include "arm_math.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//! State size (samples) of FIR filter
+#define FIR_STATE_SIZE(numTaps, blockSize)  ((numTaps) + (blockSize) - 1)
+
+//! Coefficients count of Q15 biquad cascade
+#define BIQUAD_Q15_COEFFS(numStages)        (6*(numStages))
+
+//! Coefficients count of Q31 biquad cascade
+#define BIQUAD_Q31_COEFFS(numStages)        (5*(numStages))
+
+//! State size (samples) of biquad cascade
+#define BIQUAD_STATE_SIZE(numStages)        (4*(numStages))
+
+#ifdef USE_CMSIS_DSP
+
+// CMSIS-DSP instances
+typedef arm_fir_instance_q15            FIR_Q15_t;
+typedef arm_fir_instance_q31            FIR_Q31_t;
+typedef arm_biquad_casd_df1_inst_q15    BIQUAD_Q15_t;
+typedef arm_biquad_casd_df1_inst_q31    BIQUAD_Q31_t;
+
+#else
+
+//! Q15 fixed-point sample (1.15)
+typedef int16_t q15_t;
+
+//! Q31 fixed-point sample (1.31)
+typedef int32_t q31_t;
+
+//! Q15 FIR filter (layout of arm_fir_instance_q15)
+typedef struct _FIR_Q15_t{
+    uint16_t    numTaps;            //!< number of coefficients
+    q15_t*      pState;             //!< numTaps + blockSize - 1 samples
+    q15_t*      pCoeffs;            //!< time-reversed coefficients
+}FIR_Q15_t;
+
+//! Q31 FIR filter (layout of arm_fir_instance_q31)
+typedef struct _FIR_Q31_t{
+    uint16_t    numTaps;            //!< number of coefficients
+    q31_t*      pState;             //!< numTaps + blockSize - 1 samples
+    q31_t*      pCoeffs;            //!< time-reversed coefficients
+}FIR_Q31_t;
+
+//! Q15 biquad cascade (layout of arm_biquad_casd_df1_inst_q15)
+typedef struct _BIQUAD_Q15_t{
+    int8_t      numStages;          //!< number of 2nd order stages
+    q15_t*      pState;             //!< 4 samples per stage
+    q15_t*      pCoeffs;            //!< 6 coefficients per stage
+    int8_t      postShift;          //!< output shift (coefficients scale)
+}BIQUAD_Q15_t;
+
+//! Q31 biquad cascade (layout of arm_biquad_casd_df1_inst_q31)
+typedef struct _BIQUAD_Q31_t{
+    uint32_t    numStages;          //!< number of 2nd order stages
+    q31_t*      pState;             //!< 4 samples per stage
+    q31_t*      pCoeffs;            //!< 5 coefficients per stage
+    uint8_t     postShift;          //!< output shift (coefficients scale)
+}BIQUAD_Q31_t;
+
+#endif // USE_CMSIS_DSP
+
+//------------------------------- FIR ------------------------------------------
+//! Initialize Q15 FIR filter, state is cleared
+bool fir_q15_init(FIR_Q15_t* fir, uint16_t numTaps, const q15_t* coeffs,
+                  q15_t* state, uint32_t blockSize);
+
+//! Filter block of Q15 samples (up to blockSize of init)
+void fir_q15(const FIR_Q15_t* fir, const q15_t* src, q15_t* dst,
+             uint32_t blockSize);
+
+//! Initialize Q31 FIR filter, state is cleared
+bool fir_q31_init(FIR_Q31_t* fir, uint16_t numTaps, const q31_t* coeffs,
+                  q31_t* state, uint32_t blockSize);
+
+//! Filter block of Q31 samples (up to blockSize of init)
+void fir_q31(const FIR_Q31_t* fir, const q31_t* src, q31_t* dst,
+             uint32_t blockSize);
+
+//------------------------------- Biquad ---------------------------------------
+//! Initialize Q15 biquad cascade, state is cleared
+void biquad_q15_init(BIQUAD_Q15_t* biquad, uint8_t numStages,
+                     const q15_t* coeffs, q15_t* state, int8_t postShift);
+
+//! Filter block of Q15 samples
+void biquad_q15(const BIQUAD_Q15_t* biquad, const q15_t* src, q15_t* dst,
+                uint32_t blockSize);
+
+//! Initialize Q31 biquad cascade, state is cleared
+void biquad_q31_init(BIQUAD_Q31_t* biquad, uint8_t numStages,
+                     const q31_t* coeffs, q31_t* state, int8_t postShift);
+
+//! Filter block of Q31 samples
+void biquad_q31(const BIQUAD_Q31_t* biquad, const q31_t* src, q31_t* dst,
+                uint32_t blockSize);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // FILTER_H
+//! @}
+//******************************************************************************
+// End of file
+//******************************************************************************
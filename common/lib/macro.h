@@ -14,6 +14,7 @@
 //!  Date       | Author           | Comments			
 //!  ---------- | ---------------- | ----------------
 //!  21/04/2015 | Bogdan Kokotenko | Initial draft
+//!  18/10/2026 | Bogdan Kokotenko | Fixed precedence of changeEndianness
 //
 //******************************************************************************
 #ifndef MACRO_H
@@ -48,13 +49,21 @@ extern "C" {
 #define isOdd(x)  ((((x)>>1)<<1) != (x) ? 1:0)  
 
 //! \brief Convert endianness (little<->big) of 16-bit word
+//! \details Argument is evaluated twice, use for constants (bswap16() of
+//!          byteorder.h for run time values).
 //! \hideinitializer
-#define changeEndiannessWORD(x)    ((x<<8) | (x>>8)&0xFF)
+#define changeEndiannessWORD(x)    ((unsigned short)((((x)&0xFF)<<8) |     \
+                                                     (((x)>>8)&0xFF)))
 
 //! \brief Convert endianness (little<->big) of 32-bit word
+//! \details Argument is evaluated four times, use for constants (bswap32()
+//!          of byteorder.h for run time values).
 //! \hideinitializer
-#define changeEndiannessDWORD(x)   ((x<<24) | (x>>24)&0xFF | \
-                                     (x<<8)&0xFF0000 | (x>>8)&0xFF00)
+#define changeEndiannessDWORD(x)                                            \
+    ((unsigned long)(((((unsigned long)(x))&0xFFul)<<24) |                  \
+                     ((((unsigned long)(x))&0xFF00ul)<<8) |                 \
+                     ((((unsigned long)(x))>>8)&0xFF00ul) |                 \
+                     ((((unsigned long)(x))>>24)&0xFFul)))
   
 #ifdef __cplusplus
 }
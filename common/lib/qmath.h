@@ -0,0 +1,356 @@
+//******************************************************************************
+// Copyright (C) 2026 Bogdan Kokotenko
+//
+//! \addtogroup libs
+//! @{
+//******************************************************************************
+//   File description:
+//! \file   lib\qmath.h
+//! \brief  Fixed-point math kernels (header only, inline)
+//!
+//! \details No floating point and no division at run time:
+//!          - saturating Q15/Q31 add, subtract, multiply (rounded), abs
+//!          - Q-format conversions, Q15_CONST()/Q31_CONST() for constants
+//!          - q15_sin()/q15_cos(): quarter-wave table of 129 entries with
+//!            linear interpolation
+//!          - q15_atan2()/q15_magnitude(): CORDIC vectoring, 16 iterations
+//!          - qmath_reciprocal(): floor(2^32/d) by table seed, Newton
+//!            steps and exact correction, so x/d = (x*r) >> 32 for many x
+//!          - q15_div(): saturated fractional division by reciprocal,
+//!            truncated toward zero
+//!
+//!          Angles are binary: full turn is 65536 (uint16_t wraps at 2*pi,
+//!          int16_t gives -pi..pi), 1 unit is 2*pi/65536 rad.
+//!
+//! \note    Tables are static const: every unit which calls the functions
+//!          keeps its own copy (less than 0.5 kB).
+//!
+//!*****************************************************************************
+//! __Revisions:__
+//!  Date       | Author           | Comments
+//!  ---------- | ---------------- | ----------------
+//!  18/10/2026 | Bogdan Kokotenko | Initial draft
+//
+//******************************************************************************
+#ifndef QMATH_H
+#define QMATH_H
+
+#include "filter.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//! Constant to Q15 (rounded, saturated)
+#define Q15_CONST(x)                                                        \
+    ((q15_t)((x) >= 32767.0/32768 ? 32767 : (x) <= -1.0 ? -32768 :        \
+             (x)*32768 + ((x) >= 0 ? 0.5 : -0.5)))
+
+//! Constant to Q31 (rounded, saturated)
+#define Q31_CONST(x)                                                        \
+    ((q31_t)((x) >= 2147483647.0/2147483648.0 ? 2147483647 :               \
+             (x) <= -1.0 ? (-2147483647 - 1) :                              \
+             (x)*2147483648.0 + ((x) >= 0 ? 0.5 : -0.5)))
+
+//! Binary angle of degrees (constant)
+#define QMATH_ANGLE(degrees)                                                \
+    ((uint16_t)((int32_t)((degrees)*65536.0/360 + ((degrees) >= 0 ? 0.5 : -0.5))))
+
+//! CORDIC gain compensation 1/1.6468 (Q15)
+#define QMATH_CORDIC_GAIN       19898
+
+//! CORDIC working scale (bits)
+#define QMATH_CORDIC_SHIFT      14
+
+//! Quarter-wave sine (Q15), 128 segments
+static const int16_t qmath_sinTable[129] = {
+        0,   402,   804,  1206,  1608,  2009,  2411,  2811,
+     3212,  3612,  4011,  4410,  4808,  5205,  5602,  5998,
+     6393,  6787,  7180,  7571,  7962,  8351,  8740,  9127,
+     9512,  9896, 10279, 10660, 11039, 11417, 11793, 12167,
+    12540, 12910, 13279, 13646, 14010, 14373, 14733, 15091,
+    15447, 15800, 16151, 16500, 16846, 17190, 17531, 17869,
+    18205, 18538, 18868, 19195, 19520, 19841, 20160, 20475,
+    20788, 21097, 21403, 21706, 22006, 22302, 22595, 22884,
+    23170, 23453, 23732, 24008, 24279, 24548, 24812, 25073,
+    25330, 25583, 25833, 26078, 26320, 26557, 26791, 27020,
+    27246, 27467, 27684, 27897, 28106, 28311, 28511, 28707,
+    28899, 29086, 29269, 29448, 29622, 29792, 29957, 30118,
+    30274, 30425, 30572, 30715, 30853, 30986, 31114, 31238,
+    31357, 31471, 31581, 31686, 31786, 31881, 31972, 32058,
+    32138, 32214, 32286, 32352, 32413, 32470, 32522, 32568,
+    32610, 32647, 32679, 32706, 32729, 32746, 32758, 32766,
+    32767
+};
+
+//! atan(2^-i) in binary angle units
+static const uint16_t qmath_atanTable[16] = {
+    8192, 4836, 2555, 1297, 651, 326, 163, 81,
+    41, 20, 10, 5, 3, 1, 1, 0
+};
+
+//! Reciprocal seed: 1/x in Q30 for x in [0.5, 1) by 5 bits
+static const uint32_t qmath_recipTable[32] = {
+    2114445438, 2051327664, 1991868891, 1935759908,
+    1882725390, 1832519380, 1784921474, 1739733588,
+    1696777203, 1655891006, 1616928864, 1579758086,
+    1544257904, 1510318170, 1477838209, 1446725826,
+    1416896428, 1388272257, 1360781718, 1334358772,
+    1308942414, 1284476201, 1260907830, 1238188770,
+    1216273925, 1195121335, 1174691910, 1154949189,
+    1135859120, 1117389866, 1099511628, 1082196484
+};
+
+//------------------------------------------------------------------------------
+// Function:        q15_sat()
+// Description:
+//! \brief          Saturate to Q15
+//------------------------------------------------------------------------------
+static inline q15_t q15_sat(int32_t x)
+{
+    if(x > INT16_MAX)
+        return INT16_MAX;
+    if(x < INT16_MIN)
+        return INT16_MIN;
+    return (q15_t)x;
+}
+
+//------------------------------------------------------------------------------
+// Function:        q31_sat()
+// Description:
+//! \brief          Saturate to Q31
+//------------------------------------------------------------------------------
+static inline q31_t q31_sat(int64_t x)
+{
+    if(x > INT32_MAX)
+        return INT32_MAX;
+    if(x < INT32_MIN)
+        return INT32_MIN;
+    return (q31_t)x;
+}
+
+//! Saturating Q15 addition
+static inline q15_t q15_add(q15_t a, q15_t b) { return q15_sat((int32_t)a + b); }
+
+//! Saturating Q15 subtraction
+static inline q15_t q15_sub(q15_t a, q15_t b) { return q15_sat((int32_t)a - b); }
+
+//! Saturating Q15 multiplication (rounded)
+static inline q15_t q15_mul(q15_t a, q15_t b)
+{
+    return q15_sat(((int32_t)a*b + 0x4000) >> 15);
+}
+
+//! Saturating Q15 absolute value
+static inline q15_t q15_abs(q15_t a) { return (a < 0) ? q15_sat(-(int32_t)a) : a; }
+
+//! Saturating Q31 addition
+static inline q31_t q31_add(q31_t a, q31_t b) { return q31_sat((int64_t)a + b); }
+
+//! Saturating Q31 subtraction
+static inline q31_t q31_sub(q31_t a, q31_t b) { return q31_sat((int64_t)a - b); }
+
+//! Saturating Q31 multiplication (rounded)
+static inline q31_t q31_mul(q31_t a, q31_t b)
+{
+    return q31_sat(((int64_t)a*b + 0x40000000) >> 31);
+}
+
+//! Q15 to Q31
+static inline q31_t q31_fromQ15(q15_t x) { return (q31_t)((uint32_t)(int32_t)x << 16); }
+
+//! Q31 to Q15 (rounded, saturated)
+static inline q15_t q15_fromQ31(q31_t x) { return q15_sat((int32_t)(((int64_t)x + 0x8000) >> 16)); }
+
+//! Integer with frac fractional bits to Q15 (saturated)
+static inline q15_t q15_fromQ(int32_t x, uint8_t frac)
+{
+    return q15_sat((frac <= 15) ? (int32_t)((uint32_t)x << (15 - frac)) :
+                                  x >> (frac - 15));
+}
+
+//------------------------------------------------------------------------------
+// Function:        q15_sin()
+// Description:
+//! \brief          Sine of binary angle (table, linear interpolation)
+//! \details        Max error is about 1 LSB.
+//------------------------------------------------------------------------------
+static inline q15_t q15_sin(uint16_t angle)
+{
+    uint16_t index = angle & 0x3FFF;
+    int16_t low, high, value;
+
+    // Mirror 2nd and 4th quarters
+    if(angle & 0x4000)
+        index = 0x4000 - index;
+
+    low = qmath_sinTable[index >> 7];
+    high = (index >> 7 < 128) ? qmath_sinTable[(index >> 7) + 1] : low;
+    value = (int16_t)(low + (((int32_t)(high - low)*(index & 0x7F) + 0x40) >> 7));
+
+    return (angle & 0x8000) ? (q15_t)-value : value;
+}
+
+//! Cosine of binary angle
+static inline q15_t q15_cos(uint16_t angle) { return q15_sin((uint16_t)(angle + 0x4000)); }
+
+//------------------------------------------------------------------------------
+// Function:        qmath_cordic()
+// Description:
+//! \brief          CORDIC vectoring: angle and magnitude of (x, y)
+//! \param angle    binary angle of vector, -pi..pi
+//! \return         magnitude, same scale as x and y
+//------------------------------------------------------------------------------
+static inline uint16_t qmath_cordic(int16_t x, int16_t y, int16_t* angle)
+{
+    int32_t cx = x, cy = y;
+    uint16_t a = 0;
+    uint8_t i;
+
+    // Rotate left half-plane by pi, CORDIC covers -pi/2..pi/2
+    if(cx < 0)
+    {
+        cx = -cx;
+        cy = -cy;
+        a = 0x8000;
+    }
+    cx <<= QMATH_CORDIC_SHIFT;
+    cy <<= QMATH_CORDIC_SHIFT;
+
+    // Rotate to x axis, accumulate angle
+    for(i = 0; i < 16; i++)
+    {
+        int32_t dx = cy >> i, dy = cx >> i;
+        if(cy > 0)
+        {
+            cx += dx;
+            cy -= dy;
+            a += qmath_atanTable[i];
+        }
+        else
+        {
+            cx -= dx;
+            cy += dy;
+            a -= qmath_atanTable[i];
+        }
+    }
+
+    *angle = (int16_t)a;
+    return (uint16_t)(((uint64_t)cx*QMATH_CORDIC_GAIN +
+                       (1ul << (QMATH_CORDIC_SHIFT + 14))) >>
+                      (QMATH_CORDIC_SHIFT + 15));
+}
+
+//! Binary angle of vector (x, y), -pi..pi
+static inline int16_t q15_atan2(q15_t y, q15_t x)
+{
+    int16_t angle;
+    qmath_cordic(x, y, &angle);
+    return angle;
+}
+
+//! Magnitude of vector (x, y), up to 46341
+static inline uint16_t q15_magnitude(q15_t x, q15_t y)
+{
+    int16_t angle;
+    return qmath_cordic(x, y, &angle);
+}
+
+//------------------------------------------------------------------------------
+// Function:        qmath_clz16()
+// Description:
+//! \brief          Leading zeros of non-zero 16-bit value
+//------------------------------------------------------------------------------
+static inline uint8_t qmath_clz16(uint16_t x)
+{
+#if defined(__GNUC__) && !defined(__MSP430__)
+    return (uint8_t)(__builtin_clz(x) - 16);
+#else
+    uint8_t zeros = 0;
+    if(!(x & 0xFF00)) { x <<= 8; zeros += 8; }
+    if(!(x & 0xF000)) { x <<= 4; zeros += 4; }
+    if(!(x & 0xC000)) { x <<= 2; zeros += 2; }
+    if(!(x & 0x8000)) { zeros += 1; }
+    return zeros;
+#endif
+}
+
+//------------------------------------------------------------------------------
+// Function:        qmath_reciprocal()
+// Description:
+//! \brief          Reciprocal floor(2^32/d) without division
+//! \details        0 and 1 give UINT32_MAX.
+//------------------------------------------------------------------------------
+static inline uint32_t qmath_reciprocal(uint16_t d)
+{
+    uint8_t shift;
+    uint16_t n;
+    uint32_t y;
+    int64_t rem;
+
+    if(d <= 1)
+        return UINT32_MAX;
+
+    // x = n/2^16 in [0.5, 1), y = 1/x in Q30
+    shift = qmath_clz16(d);
+    n = (uint16_t)(d << shift);
+    y = qmath_recipTable[(n >> 10) & 0x1F];
+
+    // Newton: y = y*(2 - x*y), relative error 2^-6 -> 2^-12 -> 2^-24
+    y = (uint32_t)(((uint64_t)y*(0x80000000u - (uint32_t)(((uint64_t)n*y) >> 16))) >> 30);
+    y = (uint32_t)(((uint64_t)y*(0x80000000u - (uint32_t)(((uint64_t)n*y) >> 16))) >> 30);
+
+    // 2^32/d = y*2^(shift - 14), shift <= 14 for d > 1
+    y >>= 14 - shift;
+
+    // Full precision step (error of Q30 steps is up to ~2^7), then exact
+    // floor: remainder 2^32 - d*y has to be in [0, d)
+    rem = (int64_t)0x100000000ll - (int64_t)d*y;
+    y += (int32_t)((rem*(int64_t)y) >> 32);
+    rem = (int64_t)0x100000000ll - (int64_t)d*y;
+    while(rem < 0)
+    {
+        y--;
+        rem += d;
+    }
+    while(rem >= d)
+    {
+        y++;
+        rem -= d;
+    }
+    return y;
+}
+
+//------------------------------------------------------------------------------
+// Function:        q15_div()
+// Description:
+//! \brief          Saturated fractional division num/den in Q15
+//------------------------------------------------------------------------------
+static inline q15_t q15_div(q15_t num, q15_t den)
+{
+    uint32_t a = (num < 0) ? -(int32_t)num : num;
+    uint32_t b = (den < 0) ? -(int32_t)den : den;
+    bool negative = (num < 0) != (den < 0);
+    uint64_t q;
+
+    if(b == 0)
+        return (num == 0) ? 0 : negative ? INT16_MIN : INT16_MAX;
+
+    // (a << 15)/b = (a*2^32/b) >> 17, may be 1 low: remainder correction
+    q = ((uint64_t)a*qmath_reciprocal((uint16_t)b)) >> 17;
+    if((a << 15) - (uint32_t)q*b >= b)
+        q++;
+    if(negative)
+        return (q >= 32768) ? INT16_MIN : (q15_t)-(int32_t)q;
+    return (q >= 32767) ? INT16_MAX : (q15_t)q;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // QMATH_H
+//! @}
+//******************************************************************************
+// End of file
+//******************************************************************************
@@ -0,0 +1,255 @@
+//******************************************************************************
+// Copyright (C) 2026 Bogdan Kokotenko
+//
+//	File description:
+//! \file       lib\ring.c
+//! \brief      Ring buffer (queue) of fixed-size items
+//!
+//! \details    Head and tail run freely over the whole RING_INDEX_t range,
+//!             item count is their difference and storage position is
+//!             the index masked by (count - 1). Full and empty states are
+//!             distinguished without a spare item.
+//!
+//!*****************************************************************************
+//! __Revisions:__
+//!  Date       | Author           | Comments
+//!  ---------- | ---------------- | --------------------------------
+//!  18/10/2026 | Bogdan Kokotenko | Initial draft
+//
+//******************************************************************************
+#include "types.h"
+#include "ring.h"
+
+//------------------------------------------------------------------------------
+// Function:        ring_init()
+// Description:
+//! \brief          Initialize ring over storage
+//! \param ring     ring context
+//! \param storage  items storage
+//! \param count    items count, power of two up to half of RING_INDEX_t range
+//! \param itemSize item size in bytes
+//! \return         false, if count is invalid
+//------------------------------------------------------------------------------
+bool ring_init(RING_Buffer_t* ring, void* storage, RING_INDEX_t count,
+               uint16_t itemSize)
+{
+    if(!RING_IS_POW2(count) || count > (RING_INDEX_t)(~(RING_INDEX_t)0)/2 + 1)
+        return false;
+
+    ring->buffer = (uint8_t*)storage;
+    ring->mask = count - 1;
+    ring->itemSize = itemSize;
+    ring->head = 0;
+    ring->tail = 0;
+
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// Function:        ring_flush()
+// Description:
+//! \brief          Discard all items (consumer side)
+//------------------------------------------------------------------------------
+void ring_flush(RING_Buffer_t* ring)
+{
+    ring->tail = ring->head;
+}
+
+//------------------------------------------------------------------------------
+// Function:        ring_count()
+// Description:
+//! \brief          Number of items in ring
+//------------------------------------------------------------------------------
+RING_INDEX_t ring_count(const RING_Buffer_t* ring)
+{
+    return (RING_INDEX_t)(ring->head - ring->tail);
+}
+
+//------------------------------------------------------------------------------
+// Function:        ring_space()
+// Description:
+//! \brief          Number of free items in ring
+//------------------------------------------------------------------------------
+RING_INDEX_t ring_space(const RING_Buffer_t* ring)
+{
+    return (RING_INDEX_t)(ring->mask + 1 - (RING_INDEX_t)(ring->head - ring->tail));
+}
+
+//------------------------------------------------------------------------------
+// Function:        ring_push()
+// Description:
+//! \brief          Append single item (producer)
+//! \return         false, if ring is full
+//------------------------------------------------------------------------------
+bool ring_push(RING_Buffer_t* ring, const void* item)
+{
+    RING_INDEX_t head = ring->head;
+    uint8_t* slot;
+
+    if((RING_INDEX_t)(head - ring->tail) > ring->mask)
+        return false;
+
+    slot = ring->buffer + (uint32_t)(head & ring->mask)*ring->itemSize;
+    if(ring->itemSize == 1)
+        *slot = *(const uint8_t*)item;
+    else
+        memcpy(slot, item, ring->itemSize);
+
+    RING_BARRIER();
+    ring->head = head + 1;
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// Function:        ring_pop()
+// Description:
+//! \brief          Take single item (consumer)
+//! \return         false, if ring is empty
+//------------------------------------------------------------------------------
+bool ring_pop(RING_Buffer_t* ring, void* item)
+{
+    RING_INDEX_t tail = ring->tail;
+    const uint8_t* slot;
+
+    if(tail == ring->head)
+        return false;
+    RING_BARRIER();
+
+    slot = ring->buffer + (uint32_t)(tail & ring->mask)*ring->itemSize;
+    if(ring->itemSize == 1)
+        *(uint8_t*)item = *slot;
+    else
+        memcpy(item, slot, ring->itemSize);
+
+    RING_BARRIER();
+    ring->tail = tail + 1;
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// Function:        ring_write()
+// Description:
+//! \brief          Append up to count items (producer)
+//! \details        Copies two contiguous spans at most (before and after
+//!                 the storage end).
+//! \return         number of items written
+//------------------------------------------------------------------------------
+RING_INDEX_t ring_write(RING_Buffer_t* ring, const void* items,
+                        RING_INDEX_t count)
+{
+    RING_INDEX_t head = ring->head;
+    RING_INDEX_t space = ring_space(ring);
+    RING_INDEX_t offset = head & ring->mask;
+    RING_INDEX_t first;
+
+    if(count > space)
+        count = space;
+
+    first = ring->mask + 1 - offset;
+    if(first > count)
+        first = count;
+
+    memcpy(ring->buffer + (uint32_t)offset*ring->itemSize, items,
+           (uint32_t)first*ring->itemSize);
+    memcpy(ring->buffer, (const uint8_t*)items + (uint32_t)first*ring->itemSize,
+           (uint32_t)(count - first)*ring->itemSize);
+
+    RING_BARRIER();
+    ring->head = head + count;
+    return count;
+}
+
+//------------------------------------------------------------------------------
+// Function:        ring_read()
+// Description:
+//! \brief          Take up to count items (consumer)
+//! \details        Copies two contiguous spans at most.
+//! \return         number of items read
+//------------------------------------------------------------------------------
+RING_INDEX_t ring_read(RING_Buffer_t* ring, void* items, RING_INDEX_t count)
+{
+    RING_INDEX_t tail = ring->tail;
+    RING_INDEX_t filled = ring_count(ring);
+    RING_INDEX_t offset = tail & ring->mask;
+    RING_INDEX_t first;
+
+    if(count > filled)
+        count = filled;
+    RING_BARRIER();
+
+    first = ring->mask + 1 - offset;
+    if(first > count)
+        first = count;
+
+    memcpy(items, ring->buffer + (uint32_t)offset*ring->itemSize,
+           (uint32_t)first*ring->itemSize);
+    memcpy((uint8_t*)items + (uint32_t)first*ring->itemSize, ring->buffer,
+           (uint32_t)(count - first)*ring->itemSize);
+
+    RING_BARRIER();
+    ring->tail = tail + count;
+    return count;
+}
+
+//------------------------------------------------------------------------------
+// Function:        ring_peekWrite()
+// Description:
+//! \brief          Get contiguous free span (producer)
+//! \param span     returns pointer to the first free item
+//! \return         number of free items in the span
+//------------------------------------------------------------------------------
+RING_INDEX_t ring_peekWrite(RING_Buffer_t* ring, void** span)
+{
+    RING_INDEX_t offset = ring->head & ring->mask;
+    RING_INDEX_t space = ring_space(ring);
+    RING_INDEX_t contiguous = ring->mask + 1 - offset;
+
+    *span = ring->buffer + (uint32_t)offset*ring->itemSize;
+    return (space < contiguous) ? space : contiguous;
+}
+
+//------------------------------------------------------------------------------
+// Function:        ring_commitWrite()
+// Description:
+//! \brief          Publish items written to the span (producer)
+//! \param count    number of items, up to ring_peekWrite() result
+//------------------------------------------------------------------------------
+void ring_commitWrite(RING_Buffer_t* ring, RING_INDEX_t count)
+{
+    RING_BARRIER();
+    ring->head = ring->head + count;
+}
+
+//------------------------------------------------------------------------------
+// Function:        ring_peekRead()
+// Description:
+//! \brief          Get contiguous filled span (consumer)
+//! \param span     returns pointer to the oldest item
+//! \return         number of items in the span
+//------------------------------------------------------------------------------
+RING_INDEX_t ring_peekRead(RING_Buffer_t* ring, const void** span)
+{
+    RING_INDEX_t offset = ring->tail & ring->mask;
+    RING_INDEX_t filled = ring_count(ring);
+    RING_INDEX_t contiguous = ring->mask + 1 - offset;
+
+    RING_BARRIER();
+    *span = ring->buffer + (uint32_t)offset*ring->itemSize;
+    return (filled < contiguous) ? filled : contiguous;
+}
+
+//------------------------------------------------------------------------------
+// Function:        ring_commitRead()
+// Description:
+//! \brief          Release items read from the span (consumer)
+//! \param count    number of items, up to ring_peekRead() result
+//------------------------------------------------------------------------------
+void ring_commitRead(RING_Buffer_t* ring, RING_INDEX_t count)
+{
+    RING_BARRIER();
+    ring->tail = ring->tail + count;
+}
+
+//******************************************************************************
+// End of file
+//******************************************************************************
@@ -0,0 +1,137 @@
+//******************************************************************************
+// Copyright (C) 2026 Bogdan Kokotenko
+//
+//! \addtogroup libs
+//! @{
+//******************************************************************************
+//   File description:
+//! \file   lib\ring.h
+//! \brief  Ring buffer (queue) of fixed-size items
+//!
+//! \details Items of any type (bytes, samples, structures) are stored in
+//!          the user array of power-of-two length, so positions are found
+//!          by masking of free-running indices, no compare-and-reset.
+//!          Bulk ring_write()/ring_read() copy at most two contiguous spans
+//!          by memcpy(). Zero-copy access: ring_peekWrite()/ring_peekRead()
+//!          return pointer to the contiguous span (e.g. for DMA or parser),
+//!          ring_commitWrite()/ring_commitRead() release it.
+//!
+//!          Single producer, single consumer (e.g. ISR and tasklet) need
+//!          no critical sections: head is written by producer only, tail
+//!          by consumer only, data is copied before the index is published.
+//!          Several producers or consumers have to be serialized by caller.
+//!
+//! \note    RING_INDEX_t has to be read atomically by the core: uint16_t
+//!          for MSP430, STM32 and host, uint8_t for CC254x (8051) rings
+//!          up to 128 items.
+//!
+//! \code
+//!   static uint8_t rxStorage[64];
+//!   static RING_Buffer_t rx;
+//!   RING_init(rx, rxStorage);
+//!   ring_push(&rx, &byte);                        // UART RX ISR
+//!   count = ring_read(&rx, frame, sizeof(frame)); // tasklet
+//! \endcode
+//!
+//!*****************************************************************************
+//! __Revisions:__
+//!  Date       | Author           | Comments
+//!  ---------- | ---------------- | ----------------
+//!  18/10/2026 | Bogdan Kokotenko | Initial draft
+//
+//******************************************************************************
+#ifndef RING_H
+#define RING_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//! Ring index type (free-running)
+#ifndef RING_INDEX_t
+#define RING_INDEX_t        uint16_t
+#endif
+
+//! Memory barrier between data copy and index update
+#ifndef RING_BARRIER
+#if defined(__GNUC__)
+    // Acquire after index read, release before index write
+    #define RING_BARRIER()  __atomic_thread_fence(__ATOMIC_ACQ_REL)
+#else
+    // Single-core MCU: volatile index access keeps the order
+    #define RING_BARRIER()
+#endif
+#endif
+
+//! Ring buffer context
+typedef struct _RING_Buffer_t{
+    uint8_t*                buffer;     //!< items storage
+    RING_INDEX_t            mask;       //!< items count - 1
+    uint16_t                itemSize;   //!< item size in bytes
+    volatile RING_INDEX_t   head;       //!< write index (producer)
+    volatile RING_INDEX_t   tail;       //!< read index (consumer)
+}RING_Buffer_t;
+
+//! Check if value is a power of two
+#define RING_IS_POW2(x)     ((x) != 0 && ((x) & ((x) - 1)) == 0)
+
+//------------------------------------------------------------------------------
+// Macro:			RING_init()
+// Description:
+//! \brief          Initialize ring over array, checks length at compile time
+//! \param Ring     RING_Buffer_t instance
+//! \param Storage  array of items, length has to be power of two
+//! \hideinitializer
+//------------------------------------------------------------------------------
+#define RING_init(Ring, Storage)                                            \
+    (ct_assert(RING_IS_POW2(sizeof(Storage)/sizeof((Storage)[0]))),         \
+     ring_init(&(Ring), (Storage), sizeof(Storage)/sizeof((Storage)[0]),    \
+               sizeof((Storage)[0])))
+
+//! Initialize ring over storage of count (power of two) items
+bool ring_init(RING_Buffer_t* ring, void* storage, RING_INDEX_t count,
+               uint16_t itemSize);
+
+//! Discard all items (consumer side)
+void ring_flush(RING_Buffer_t* ring);
+
+//! Number of items in ring
+RING_INDEX_t ring_count(const RING_Buffer_t* ring);
+
+//! Number of free items in ring
+RING_INDEX_t ring_space(const RING_Buffer_t* ring);
+
+//! Append single item (producer)
+bool ring_push(RING_Buffer_t* ring, const void* item);
+
+//! Take single item (consumer)
+bool ring_pop(RING_Buffer_t* ring, void* item);
+
+//! Append up to count items (producer), returns items written
+RING_INDEX_t ring_write(RING_Buffer_t* ring, const void* items,
+                        RING_INDEX_t count);
+
+//! Take up to count items (consumer), returns items read
+RING_INDEX_t ring_read(RING_Buffer_t* ring, void* items, RING_INDEX_t count);
+
+//! Get contiguous free span (producer), returns its length in items
+RING_INDEX_t ring_peekWrite(RING_Buffer_t* ring, void** span);
+
+//! Publish count items written to the span (producer)
+void ring_commitWrite(RING_Buffer_t* ring, RING_INDEX_t count);
+
+//! Get contiguous filled span (consumer), returns its length in items
+RING_INDEX_t ring_peekRead(RING_Buffer_t* ring, const void** span);
+
+//! Release count items read from the span (consumer)
+void ring_commitRead(RING_Buffer_t* ring, RING_INDEX_t count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RING_H
+//! @}
+//******************************************************************************
+// End of file
+//******************************************************************************
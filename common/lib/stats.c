@@ -0,0 +1,385 @@
+//******************************************************************************
+// Copyright (C) 2026 Bogdan Kokotenko
+//
+//	File description:
+//! \file       lib\stats.c
+//! \brief      Sliding-window statistics of 16-bit samples
+//!
+//! \details    Samples are stored in slots (circular), deques and heaps keep
+//!             slot numbers. Deques are in arrival order, so the outgoing
+//!             slot can only be at the deque front. Heap position of every
+//!             slot is tracked (STATS_HIGH flag marks upper half heap), so
+//!             the outgoing sample is removed without search. Lower half
+//!             holds one sample more for odd count.
+//!
+//!*****************************************************************************
+//! __Revisions:__
+//!  Date       | Author           | Comments
+//!  ---------- | ---------------- | --------------------------------
+//!  18/10/2026 | Bogdan Kokotenko | Initial draft
+//
+//******************************************************************************
+#include "types.h"
+#include "dsp.h"
+#include "stats.h"
+
+//! Position flag of upper half heap
+#define STATS_HIGH      0x8000
+
+//------------------------------------------------------------------------------
+// Function:        stats_above()
+// Description:
+//! \brief          Heap order: slot a has to be above slot b
+//------------------------------------------------------------------------------
+static inline bool stats_above(const STATS_Window_t* window, bool high,
+                               uint16_t a, uint16_t b)
+{
+    return high ? window->samples[a] < window->samples[b] :
+                  window->samples[a] > window->samples[b];
+}
+
+//------------------------------------------------------------------------------
+// Function:        stats_heapSet()
+// Description:
+//! \brief          Place slot to heap index
+//------------------------------------------------------------------------------
+static inline void stats_heapSet(STATS_Window_t* window, bool high,
+                                 uint16_t index, uint16_t slot)
+{
+    if(high)
+    {
+        window->highHeap[index] = slot;
+        window->position[slot] = index | STATS_HIGH;
+    }
+    else
+    {
+        window->lowHeap[index] = slot;
+        window->position[slot] = index;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Function:        stats_siftUp()
+// Description:
+//! \brief          Move heap entry up till the order is restored
+//------------------------------------------------------------------------------
+static void stats_siftUp(STATS_Window_t* window, bool high, uint16_t index)
+{
+    uint16_t* heap = high ? window->highHeap : window->lowHeap;
+    uint16_t slot = heap[index];
+
+    while(index > 0)
+    {
+        uint16_t parent = (index - 1) >> 1;
+        if(!stats_above(window, high, slot, heap[parent]))
+            break;
+        stats_heapSet(window, high, index, heap[parent]);
+        index = parent;
+    }
+    stats_heapSet(window, high, index, slot);
+}
+
+//------------------------------------------------------------------------------
+// Function:        stats_siftDown()
+// Description:
+//! \brief          Move heap entry down till the order is restored
+//------------------------------------------------------------------------------
+static void stats_siftDown(STATS_Window_t* window, bool high, uint16_t index)
+{
+    uint16_t* heap = high ? window->highHeap : window->lowHeap;
+    uint16_t count = high ? window->highCount : window->lowCount;
+    uint16_t slot = heap[index];
+
+    for(;;)
+    {
+        uint16_t child = 2*index + 1;
+        if(child >= count)
+            break;
+        if(child + 1 < count &&
+           stats_above(window, high, heap[child + 1], heap[child]))
+            child++;
+        if(!stats_above(window, high, heap[child], slot))
+            break;
+        stats_heapSet(window, high, index, heap[child]);
+        index = child;
+    }
+    stats_heapSet(window, high, index, slot);
+}
+
+//------------------------------------------------------------------------------
+// Function:        stats_heapPush()
+// Description:
+//! \brief          Add slot to heap
+//------------------------------------------------------------------------------
+static void stats_heapPush(STATS_Window_t* window, bool high, uint16_t slot)
+{
+    uint16_t index = high ? window->highCount++ : window->lowCount++;
+
+    stats_heapSet(window, high, index, slot);
+    stats_siftUp(window, high, index);
+}
+
+//------------------------------------------------------------------------------
+// Function:        stats_heapRemove()
+// Description:
+//! \brief          Remove heap entry, the last one takes its place
+//! \return         removed slot
+//------------------------------------------------------------------------------
+static uint16_t stats_heapRemove(STATS_Window_t* window, bool high,
+                                 uint16_t index)
+{
+    uint16_t* heap = high ? window->highHeap : window->lowHeap;
+    uint16_t last = high ? --window->highCount : --window->lowCount;
+    uint16_t slot = heap[index];
+
+    if(index < last)
+    {
+        uint16_t moved = heap[last];
+
+        stats_heapSet(window, high, index, moved);
+        stats_siftUp(window, high, index);
+        stats_siftDown(window, high, window->position[moved] & ~STATS_HIGH);
+    }
+
+    return slot;
+}
+
+//------------------------------------------------------------------------------
+// Function:        stats_rebalance()
+// Description:
+//! \brief          Keep lower half equal to upper half or one entry longer
+//------------------------------------------------------------------------------
+static void stats_rebalance(STATS_Window_t* window)
+{
+    if(window->lowCount > window->highCount + 1)
+        stats_heapPush(window, true, stats_heapRemove(window, false, 0));
+    else if(window->highCount > window->lowCount)
+        stats_heapPush(window, false, stats_heapRemove(window, true, 0));
+}
+
+//------------------------------------------------------------------------------
+// Function:        stats_init()
+// Description:
+//! \brief          Initialize window over buffer
+//! \param window   window context
+//! \param buffer   STATS_BUFFER_SIZE(size) words
+//! \param size     window size, 1..STATS_MAX_SIZE
+//! \return         false, if size is invalid
+//------------------------------------------------------------------------------
+bool stats_init(STATS_Window_t* window, uint16_t* buffer, uint16_t size)
+{
+    if(size == 0 || size > STATS_MAX_SIZE)
+        return false;
+
+    window->samples = (int16_t*)buffer;
+    window->minDeque = buffer + size;
+    window->maxDeque = buffer + 2*size;
+    window->position = buffer + 3*size;
+    window->lowHeap = buffer + 4*size;
+    window->highHeap = buffer + 4*size + (size/2 + 1);
+    window->size = size;
+    stats_clear(window);
+
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// Function:        stats_clear()
+// Description:
+//! \brief          Remove all samples
+//------------------------------------------------------------------------------
+void stats_clear(STATS_Window_t* window)
+{
+    window->count = 0;
+    window->next = 0;
+    window->minHead = 0;
+    window->minCount = 0;
+    window->maxHead = 0;
+    window->maxCount = 0;
+    window->lowCount = 0;
+    window->highCount = 0;
+    window->sum = 0;
+    window->sumSq = 0;
+}
+
+//------------------------------------------------------------------------------
+// Function:        stats_append()
+// Description:
+//! \brief          Append sample, the oldest one leaves full window
+//------------------------------------------------------------------------------
+void stats_append(STATS_Window_t* window, int16_t sample)
+{
+    uint16_t slot = window->next;
+    uint16_t back;
+
+    // Remove the oldest sample
+    if(window->count == window->size)
+    {
+        int16_t old = window->samples[slot];
+        uint16_t position = window->position[slot];
+
+        window->sum -= old;
+        window->sumSq -= (int32_t)old*old;
+
+        if(window->minDeque[window->minHead] == slot)
+        {
+            if(++window->minHead == window->size)
+                window->minHead = 0;
+            window->minCount--;
+        }
+        if(window->maxDeque[window->maxHead] == slot)
+        {
+            if(++window->maxHead == window->size)
+                window->maxHead = 0;
+            window->maxCount--;
+        }
+
+        stats_heapRemove(window, (position & STATS_HIGH) != 0,
+                         position & ~STATS_HIGH);
+        stats_rebalance(window);
+    }
+    else
+        window->count++;
+
+    window->samples[slot] = sample;
+    window->sum += sample;
+    window->sumSq += (int32_t)sample*sample;
+
+    // Monotonic deques: drop samples which can not be min/max anymore
+    while(window->minCount)
+    {
+        back = window->minHead + window->minCount - 1;
+        if(back >= window->size)
+            back -= window->size;
+        if(window->samples[window->minDeque[back]] < sample)
+            break;
+        window->minCount--;
+    }
+    back = window->minHead + window->minCount++;
+    window->minDeque[(back >= window->size) ? back - window->size : back] = slot;
+
+    while(window->maxCount)
+    {
+        back = window->maxHead + window->maxCount - 1;
+        if(back >= window->size)
+            back -= window->size;
+        if(window->samples[window->maxDeque[back]] > sample)
+            break;
+        window->maxCount--;
+    }
+    back = window->maxHead + window->maxCount++;
+    window->maxDeque[(back >= window->size) ? back - window->size : back] = slot;
+
+    // Median heaps
+    if(window->lowCount == 0 || sample <= window->samples[window->lowHeap[0]])
+        stats_heapPush(window, false, slot);
+    else
+        stats_heapPush(window, true, slot);
+    stats_rebalance(window);
+
+    if(++window->next == window->size)
+        window->next = 0;
+}
+
+//------------------------------------------------------------------------------
+// Function:        stats_appendBlock()
+// Description:
+//! \brief          Append block of samples
+//------------------------------------------------------------------------------
+void stats_appendBlock(STATS_Window_t* window, const int16_t* samples,
+                       uint16_t count)
+{
+    while(count--)
+        stats_append(window, *samples++);
+}
+
+//------------------------------------------------------------------------------
+// Function:        stats_min()
+// Description:
+//! \brief          Minimal sample in window (0 for empty window)
+//------------------------------------------------------------------------------
+int16_t stats_min(const STATS_Window_t* window)
+{
+    if(window->count == 0)
+        return 0;
+    return window->samples[window->minDeque[window->minHead]];
+}
+
+//------------------------------------------------------------------------------
+// Function:        stats_max()
+// Description:
+//! \brief          Maximal sample in window (0 for empty window)
+//------------------------------------------------------------------------------
+int16_t stats_max(const STATS_Window_t* window)
+{
+    if(window->count == 0)
+        return 0;
+    return window->samples[window->maxDeque[window->maxHead]];
+}
+
+//------------------------------------------------------------------------------
+// Function:        stats_mean()
+// Description:
+//! \brief          Mean of window, rounded down (0 for empty window)
+//------------------------------------------------------------------------------
+int16_t stats_mean(const STATS_Window_t* window)
+{
+    int32_t mean;
+
+    if(window->count == 0)
+        return 0;
+
+    mean = window->sum/window->count;
+    if(mean*window->count > window->sum)
+        mean--;
+    return (int16_t)mean;
+}
+
+//------------------------------------------------------------------------------
+// Function:        stats_variance()
+// Description:
+//! \brief          Population variance of window, rounded down
+//------------------------------------------------------------------------------
+uint32_t stats_variance(const STATS_Window_t* window)
+{
+    int64_t count = window->count;
+
+    if(count == 0)
+        return 0;
+
+    return (uint32_t)((count*window->sumSq - (int64_t)window->sum*window->sum)/
+                      (count*count));
+}
+
+//------------------------------------------------------------------------------
+// Function:        stats_stddev()
+// Description:
+//! \brief          Standard deviation of window, rounded down
+//------------------------------------------------------------------------------
+uint16_t stats_stddev(const STATS_Window_t* window)
+{
+    return fastRoot32(stats_variance(window));
+}
+
+//------------------------------------------------------------------------------
+// Function:        stats_median()
+// Description:
+//! \brief          Median of window (0 for empty window)
+//! \details        Mean of two middle samples for even count, rounded down.
+//------------------------------------------------------------------------------
+int16_t stats_median(const STATS_Window_t* window)
+{
+    int32_t low;
+
+    if(window->count == 0)
+        return 0;
+
+    low = window->samples[window->lowHeap[0]];
+    if(window->lowCount > window->highCount)
+        return (int16_t)low;
+    return (int16_t)((low + window->samples[window->highHeap[0]]) >> 1);
+}
+
+//******************************************************************************
+// End of file
+//******************************************************************************
@@ -0,0 +1,122 @@
+//******************************************************************************
+// Copyright (C) 2026 Bogdan Kokotenko
+//
+//! \addtogroup libs
+//! @{
+//******************************************************************************
+//   File description:
+//! \file   lib\stats.h
+//! \brief  Sliding-window statistics of 16-bit samples
+//!
+//! \details Window keeps last `size` samples and updates per sample:
+//!          - min/max: monotonic deques of window slots, amortised O(1)
+//!          - mean/variance: running sum and sum of squares, O(1)
+//!          - median: two indexed heaps (lower half max-heap, upper half
+//!            min-heap), outgoing sample is removed by its heap position,
+//!            O(log n)
+//!
+//!          Memory is provided by user: STATS_BUFFER_SIZE(size) words.
+//!          Samples are fed one by one (e.g. after CircularBuffer_append()
+//!          by STATS_appendCircular()) or by blocks (DMA buffer, ring span).
+//!
+//! \code
+//!   static uint16_t buffer[STATS_BUFFER_SIZE(32)];
+//!   static STATS_Window_t window;
+//!   stats_init(&window, buffer, 32);
+//!   stats_append(&window, sample);
+//!   if(abs(sample - stats_median(&window)) > 4*stats_stddev(&window))
+//!       ...spike...
+//! \endcode
+//!
+//!*****************************************************************************
+//! __Revisions:__
+//!  Date       | Author           | Comments
+//!  ---------- | ---------------- | ----------------
+//!  18/10/2026 | Bogdan Kokotenko | Initial draft
+//
+//******************************************************************************
+#ifndef STATS_H
+#define STATS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//! Maximal window size
+#define STATS_MAX_SIZE              0x7FFF
+
+//! Window buffer size (16-bit words)
+#define STATS_BUFFER_SIZE(size)     (5*(size) + 2)
+
+//! Sliding window context
+typedef struct _STATS_Window_t{
+    int16_t*    samples;            //!< window samples (circular)
+    uint16_t*   minDeque;           //!< slots with increasing samples
+    uint16_t*   maxDeque;           //!< slots with decreasing samples
+    uint16_t*   lowHeap;            //!< max-heap of lower half slots
+    uint16_t*   highHeap;           //!< min-heap of upper half slots
+    uint16_t*   position;           //!< heap position of every slot
+    uint16_t    size;               //!< window size
+    uint16_t    count;              //!< samples in window
+    uint16_t    next;               //!< slot of the next sample
+    uint16_t    minHead;            //!< min deque front
+    uint16_t    minCount;           //!< min deque length
+    uint16_t    maxHead;            //!< max deque front
+    uint16_t    maxCount;           //!< max deque length
+    uint16_t    lowCount;           //!< lower half heap length
+    uint16_t    highCount;          //!< upper half heap length
+    int32_t     sum;                //!< sum of samples
+    int64_t     sumSq;              //!< sum of squared samples
+}STATS_Window_t;
+
+//------------------------------------------------------------------------------
+// Macro:			STATS_appendCircular()
+// Description:
+//! \brief          Feed the last sample of CircularBuffer (dsp.h) to window
+//! \param Window   STATS_Window_t instance
+//! \param Buffer   CircularBufferS16/S8 instance
+//! \hideinitializer
+//------------------------------------------------------------------------------
+#define STATS_appendCircular(Window, Buffer)                                \
+    stats_append(&(Window), (Buffer).buff[(Buffer).index])
+
+//! Initialize window over buffer of STATS_BUFFER_SIZE(size) words
+bool stats_init(STATS_Window_t* window, uint16_t* buffer, uint16_t size);
+
+//! Remove all samples
+void stats_clear(STATS_Window_t* window);
+
+//! Append sample, the oldest one leaves full window
+void stats_append(STATS_Window_t* window, int16_t sample);
+
+//! Append block of samples
+void stats_appendBlock(STATS_Window_t* window, const int16_t* samples,
+                       uint16_t count);
+
+//! Minimal sample in window
+int16_t stats_min(const STATS_Window_t* window);
+
+//! Maximal sample in window
+int16_t stats_max(const STATS_Window_t* window);
+
+//! Mean of window (rounded down)
+int16_t stats_mean(const STATS_Window_t* window);
+
+//! Population variance of window (rounded down)
+uint32_t stats_variance(const STATS_Window_t* window);
+
+//! Standard deviation of window (rounded down)
+uint16_t stats_stddev(const STATS_Window_t* window);
+
+//! Median of window (mean of middle samples for even count, rounded down)
+int16_t stats_median(const STATS_Window_t* window);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // STATS_H
+//! @}
+//******************************************************************************
+// End of file
+//******************************************************************************
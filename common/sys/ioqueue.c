@@ -0,0 +1,351 @@
+//******************************************************************************
+// Copyright (C) 2026 Bogdan Kokotenko
+//
+//   File description:
+//! \file       sys/ioqueue.c
+//! \brief      Asynchronous I/O request queue
+//!
+//! \details    Descriptors of the active request are executed by IOQ_run()
+//!             called by IOQ_submit() for idle bus and by the transfer
+//!             completion handler otherwise. Chip select operations are
+//!             done in place, transfer waits for its completion handler.
+//!             If the handler is called before the driver returns, the
+//!             running loop just continues with the next descriptor.
+//!
+//!*****************************************************************************
+//! __Revisions:__
+//!  Date       | Author           | Comments
+//!  ---------- | ---------------- | -----------------------------------------
+//!  18/10/2026 | Bogdan Kokotenko | Initial draft
+//!  18/10/2026 | Bogdan Kokotenko | Bus index is checked before use
+//
+//******************************************************************************
+#include "project.h"
+#include "types.h"
+#include "hal.h"
+#include "task.h"
+#include "ioqueue.h"
+
+#if (IOQ_BUSES > 4)
+#error IOQ: Up to 4 buses are supported!
+#endif
+
+//! Bus queue context
+static struct IOQ_Bus_t{
+    const IOQ_Driver_t* driver;         //!< bus driver
+    IOQ_Request_t*      first;          //!< active request
+    IOQ_Request_t*      last;           //!< last queued request
+    uint8_t             step;           //!< index of the next descriptor
+    bool                split;          //!< write of split write-then-read
+    bool                failed;         //!< active request has bus error
+    volatile bool       running;        //!< descriptors are executed
+    volatile bool       transfer;       //!< transfer is in progress
+    IOQ_Stats_t         stats;          //!< bus queue statistics
+}IOQ_bus[IOQ_BUSES];                    //!< Bus queues
+
+//! Transfer completion handlers of buses
+static void (* const IOQ_handler[IOQ_BUSES])(void);
+
+//------------------------------------------------------------------------------
+// Function:
+//              IOQ_init()
+// Description:
+//! \brief      Attach bus driver and clear the queue
+//!
+//! \param bus      bus index
+//! \param driver   bus driver interface
+//! \return         true - in case of success, false - otherwise
+//------------------------------------------------------------------------------
+bool IOQ_init(uint8_t bus, const IOQ_Driver_t* driver)
+{
+    if(bus >= IOQ_BUSES || !driver || !driver->write || !driver->read)
+        return false;
+
+    memset(&IOQ_bus[bus], 0x00, sizeof(IOQ_bus[bus]));
+    IOQ_bus[bus].driver = driver;
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              IOQ_finish()
+// Description:
+//! \brief      Complete active request and activate the next one
+//------------------------------------------------------------------------------
+static void IOQ_finish(struct IOQ_Bus_t* ctx)
+{
+    IOQ_Request_t* request = ctx->first;
+
+    EnterCriticalSection();
+    ctx->first = request->next;
+    if(!ctx->first)
+        ctx->last = NULL;
+    else
+        ctx->first->state = IOQ_ACTIVE;
+    LeaveCriticalSection();
+
+    if(ctx->failed)
+        ctx->stats.errors++;
+    else
+        ctx->stats.requests++;
+
+    request->next = NULL;
+    request->state = ctx->failed ? IOQ_ERROR : IOQ_DONE;
+    ctx->step = 0;
+    ctx->split = false;
+    ctx->failed = false;
+
+    if(request->done)
+        TASK_create(request->done);
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              IOQ_start()
+// Description:
+//! \brief      Execute descriptor of active request
+//! \return     true - transfer is started, false - descriptor is done
+//------------------------------------------------------------------------------
+static bool IOQ_start(struct IOQ_Bus_t* ctx, void (*handler)(void))
+{
+    const IOQ_Driver_t* driver = ctx->driver;
+    const IOQ_Op_t* op = &ctx->first->ops[ctx->step++];
+
+    // Skip the rest of failed request, but release chip select
+    if(ctx->failed && op->type != IOQ_RELEASE)
+        return false;
+
+    switch(op->type)
+    {
+    case IOQ_SELECT:
+        if(driver->select)
+            driver->select(op->address);
+        return false;
+
+    case IOQ_RELEASE:
+        if(driver->release)
+            driver->release(op->address);
+        return false;
+
+    case IOQ_WRITE:
+        ctx->transfer = true;
+        driver->write(op->address, op->txData, op->txSize, handler);
+        return true;
+
+    case IOQ_READ:
+        ctx->transfer = true;
+        driver->read(op->address, op->rxData, op->rxSize, handler);
+        return true;
+
+    case IOQ_WRITE_READ:
+        ctx->transfer = true;
+        if(driver->request)
+            driver->request(op->address, op->txData, op->txSize,
+                            op->rxData, op->rxSize, handler);
+        else if(!ctx->split)
+        {
+            // Write phase, the same descriptor reads next time
+            ctx->split = true;
+            ctx->step--;
+            driver->write(op->address, op->txData, op->txSize, handler);
+        }
+        else
+        {
+            ctx->split = false;
+            driver->read(op->address, op->rxData, op->rxSize, handler);
+        }
+        return true;
+
+    default:
+        ctx->failed = true;
+        return false;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              IOQ_run()
+// Description:
+//! \brief      Execute queued descriptors till transfer is in progress
+//!
+//! \param bus      bus index (checked by IOQ_submit)
+//! \param chained  called by transfer completion handler
+//------------------------------------------------------------------------------
+static void IOQ_run(uint8_t bus, bool chained)
+{
+    struct IOQ_Bus_t* ctx = &IOQ_bus[bus];
+
+    ctx->running = true;
+    for(;;)
+    {
+        // Stop on empty queue (new request is started by IOQ_submit)
+        EnterCriticalSection();
+        if(!ctx->first)
+        {
+            ctx->running = false;
+            LeaveCriticalSection();
+            return;
+        }
+        LeaveCriticalSection();
+
+        if(ctx->step >= ctx->first->count)
+        {
+            IOQ_finish(ctx);
+            continue;
+        }
+
+        if(!IOQ_start(ctx, IOQ_handler[bus]))
+            continue;
+
+        ctx->stats.transfers++;
+        if(chained)
+            ctx->stats.chained++;
+        chained = true;
+
+        // Completion handler continues, unless it has already been called
+        EnterCriticalSection();
+        if(ctx->transfer)
+        {
+            ctx->running = false;
+            LeaveCriticalSection();
+            return;
+        }
+        LeaveCriticalSection();
+    }
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              IOQ_complete()
+// Description:
+//! \brief      Transfer completion handler (ISR)
+//------------------------------------------------------------------------------
+static void IOQ_complete(uint8_t bus)
+{
+    struct IOQ_Bus_t* ctx = &IOQ_bus[bus];
+
+    if(!ctx->transfer)
+        return;
+
+    if(ctx->driver->error && ctx->driver->error())
+        ctx->failed = true;
+    ctx->transfer = false;
+
+    // Called before driver returned: running loop goes on
+    if(!ctx->running)
+        IOQ_run(bus, true);
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              IOQ_complete0() .. IOQ_complete3()
+// Description:
+//! \brief      Transfer completion handlers of buses
+//------------------------------------------------------------------------------
+static void IOQ_complete0(void) { IOQ_complete(0); }
+#if (IOQ_BUSES > 1)
+static void IOQ_complete1(void) { IOQ_complete(1); }
+#endif
+#if (IOQ_BUSES > 2)
+static void IOQ_complete2(void) { IOQ_complete(2); }
+#endif
+#if (IOQ_BUSES > 3)
+static void IOQ_complete3(void) { IOQ_complete(3); }
+#endif
+
+//! Transfer completion handlers of buses
+static void (* const IOQ_handler[IOQ_BUSES])(void) = {
+    IOQ_complete0,
+#if (IOQ_BUSES > 1)
+    IOQ_complete1,
+#endif
+#if (IOQ_BUSES > 2)
+    IOQ_complete2,
+#endif
+#if (IOQ_BUSES > 3)
+    IOQ_complete3,
+#endif
+};
+
+//------------------------------------------------------------------------------
+// Function:
+//              IOQ_submit()
+// Description:
+//! \brief      Put request to the bus queue
+//! \details    Request is started at once on idle bus, otherwise it is
+//!             started by completion of the previous request.
+//!
+//! \param bus      bus index
+//! \param request  request with descriptors and completion tasklet
+//! \return         true - in case of success, false - otherwise
+//------------------------------------------------------------------------------
+bool IOQ_submit(uint8_t bus, IOQ_Request_t* request)
+{
+    struct IOQ_Bus_t* ctx;
+    bool start = false;
+
+    if(bus >= IOQ_BUSES || !request || !request->ops || !request->count)
+        return false;
+
+    ctx = &IOQ_bus[bus];
+    if(!ctx->driver)
+        return false;
+
+    EnterCriticalSection();
+
+    // Request is already in the queue
+    if(request->state == IOQ_QUEUED || request->state == IOQ_ACTIVE)
+    {
+        LeaveCriticalSection();
+        return false;
+    }
+
+    request->next = NULL;
+    if(ctx->last)
+    {
+        request->state = IOQ_QUEUED;
+        ctx->last->next = request;
+    }
+    else
+    {
+        request->state = IOQ_ACTIVE;
+        ctx->first = request;
+        ctx->step = 0;
+        start = !ctx->running;
+    }
+    ctx->last = request;
+
+    LeaveCriticalSection();
+
+    if(start)
+        IOQ_run(bus, false);
+
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              IOQ_isBusy()
+// Description:
+//! \brief      Check if bus queue has requests to do
+//------------------------------------------------------------------------------
+bool IOQ_isBusy(uint8_t bus)
+{
+    return bus < IOQ_BUSES && IOQ_bus[bus].first != NULL;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              IOQ_getStats()
+// Description:
+//! \brief      Read bus queue statistics
+//------------------------------------------------------------------------------
+void IOQ_getStats(uint8_t bus, IOQ_Stats_t* stats)
+{
+    if(bus < IOQ_BUSES)
+        *stats = IOQ_bus[bus].stats;
+}
+
+//******************************************************************************
+// End of file
+//******************************************************************************
@@ -0,0 +1,138 @@
+//******************************************************************************
+// Copyright (C) 2026 Bogdan Kokotenko
+//
+//! \addtogroup system
+//! @{
+//! \defgroup ioqueue I/O request queue
+//! \brief Asynchronous bus request queue
+//! @{
+//******************************************************************************
+//   File description:
+//! \file       sys/ioqueue.h
+//! \brief      Asynchronous I/O request queue APIs
+//!
+//! \details    Every bus (UART, SPI, I2C) has its own queue of requests.
+//!             Request is a chain of descriptors (write, read, write-then-
+//!             read, chip select/release) executed in order. The next
+//!             transfer is started from the completion handler (ISR) of
+//!             the previous one, so the bus has no idle gaps between
+//!             descriptors and requests. Request completion is posted to
+//!             the tasklet queue.
+//!
+//!             Bus driver is plugged in by IOQ_Driver_t, I2C0/I2C1 APIs
+//!             match it directly, SPI and UART need thin adapters which
+//!             ignore the address. Transfers completed before the driver
+//!             returns (polled or simulated) are chained without recursion.
+//!
+//! \note       Request and its descriptors are owned by the caller and
+//!             must not be changed till the request is done.
+//!
+//!*****************************************************************************
+//! __Revisions:__
+//!  Date       | Author           | Comments
+//!  ---------- | ---------------- | -----------------------------------
+//!  18/10/2026 | Bogdan Kokotenko | Initial draft
+//!  18/10/2026 | Bogdan Kokotenko | Header is self-contained
+//!
+//******************************************************************************
+#ifndef IOQUEUE_H
+#define IOQUEUE_H
+
+// Include dependencies
+#include "task.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//! Number of buses served by request queues (up to 4)
+#ifndef IOQ_BUSES
+#define IOQ_BUSES           2
+#endif
+
+//! Descriptor operations
+typedef enum{
+    IOQ_WRITE,          //!< transmit txData
+    IOQ_READ,           //!< receive rxData
+    IOQ_WRITE_READ,     //!< transmit txData, (repeated start) receive rxData
+    IOQ_SELECT,         //!< assert chip select
+    IOQ_RELEASE         //!< release chip select (done on error as well)
+}IOQ_OP_t;
+
+//! Request states
+typedef enum{
+    IOQ_IDLE,           //!< never submitted
+    IOQ_QUEUED,         //!< waiting in the queue
+    IOQ_ACTIVE,         //!< descriptors are executed
+    IOQ_DONE,           //!< completed successfully
+    IOQ_ERROR           //!< aborted by bus error
+}IOQ_STATE_t;
+
+//! Request descriptor
+typedef struct _IOQ_Op_t{
+    uint8_t     type;           //!< operation (IOQ_OP_t)
+    uint8_t     address;        //!< slave address or chip select
+    uint16_t    txSize;         //!< number of bytes to transmit
+    uint16_t    rxSize;         //!< number of bytes to receive
+    const void* txData;         //!< transmitted data
+    void*       rxData;         //!< received data
+}IOQ_Op_t;
+
+//! Request (chain of descriptors)
+typedef struct _IOQ_Request_t{
+    const IOQ_Op_t*         ops;        //!< descriptors
+    uint8_t                 count;      //!< number of descriptors
+    task_t                  done;       //!< completion tasklet (optional)
+    volatile uint8_t        state;      //!< request state (IOQ_STATE_t)
+    struct _IOQ_Request_t*  next;       //!< queue link (internal)
+}IOQ_Request_t;
+
+//! Bus driver interface
+typedef struct _IOQ_Driver_t{
+    //! Start transmission, handler is called on completion
+    void (*write)(uint8_t address, const void* data, uint16_t size,
+                  void (*handler)(void));
+    //! Start reception, handler is called on completion
+    void (*read)(uint8_t address, void* data, uint16_t size,
+                 void (*handler)(void));
+    //! Start write-then-read (optional, otherwise write and read are used)
+    void (*request)(uint8_t address, const void* txData, uint16_t txSize,
+                    void* rxData, uint16_t rxSize, void (*handler)(void));
+    //! Assert chip select (optional)
+    void (*select)(uint8_t address);
+    //! Release chip select (optional)
+    void (*release)(uint8_t address);
+    //! Check error of the last transfer (optional)
+    bool (*error)(void);
+}IOQ_Driver_t;
+
+//! Bus queue statistics
+typedef struct _IOQ_Stats_t{
+    uint32_t requests;          //!< completed requests
+    uint32_t errors;            //!< aborted requests
+    uint32_t transfers;         //!< started transfers
+    uint32_t chained;           //!< transfers started by completion handler
+}IOQ_Stats_t;
+
+//! Attach bus driver and clear the queue
+bool IOQ_init(uint8_t bus, const IOQ_Driver_t* driver);
+
+//! Put request to the bus queue
+bool IOQ_submit(uint8_t bus, IOQ_Request_t* request);
+
+//! Check if bus queue has requests to do
+bool IOQ_isBusy(uint8_t bus);
+
+//! Read bus queue statistics
+void IOQ_getStats(uint8_t bus, IOQ_Stats_t* stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // IOQUEUE_H
+//! @}
+//! @}
+//******************************************************************************
+// End of file
+//******************************************************************************
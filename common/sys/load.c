@@ -0,0 +1,233 @@
+//******************************************************************************
+// Copyright (C) 2026 Bogdan Kokotenko
+//
+//   File description:
+//! \file       sys/load.c
+//! \brief      CPU load and idle (LPM) residency meter
+//!
+//! \details    Every hook accounts the time elapsed since the previous hook
+//!             to the current CPU state and switches the state. ISR hooks
+//!             support nesting, the interrupted state is restored by the
+//!             outermost ISR epilogue.
+//!
+//!*****************************************************************************
+//! __Revisions:__
+//!  Date       | Author           | Comments
+//!  ---------- | ---------------- | -----------------------------------
+//!  18/10/2026 | Bogdan Kokotenko | Initial draft
+//
+//******************************************************************************
+#include "project.h"
+#include "types.h"
+#include "hal.h"
+#include "clocks.h"
+#include "timers.h"
+#include "load.h"
+
+#ifdef USE_LOAD_METER
+
+//! CPU states
+enum LOAD_State_t{
+    LOAD_BUSY = 0,                  //!< tasklets and scheduler
+    LOAD_IDLE,                      //!< no tasklets to do
+    LOAD_ISR                        //!< interrupt service routine
+};
+
+//! Load meter context
+static struct LOAD_t{
+    LOAD_COUNTER_t  timestamp;      //!< timer value of the last hook
+    uint8_t         state;          //!< current CPU state
+    uint8_t         interrupted;    //!< state interrupted by outermost ISR
+    uint8_t         isrNesting;     //!< ISR nesting level
+    LOAD_Stats_t    total;          //!< totals since initialization
+    LOAD_Stats_t    window;         //!< current window
+    uint32_t        windowTicks;    //!< current window length
+    uint16_t        cpuLoad;        //!< last window CPU load (permille)
+    uint16_t        isrLoad;        //!< last window ISR load (permille)
+    uint16_t        lpmResidency;   //!< last window LPM residency (permille)
+}LOAD;
+
+//------------------------------------------------------------------------------
+// Function:
+//              LOAD_permille()
+// Description:
+//! \brief      Calculate part of the window in permille
+//------------------------------------------------------------------------------
+static uint16_t LOAD_permille(uint32_t ticks, uint32_t window)
+{
+    return (uint16_t)(((uint64_t)ticks*1000)/window);
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              LOAD_account()
+// Description:
+//! \brief      Account time since the last hook to the current state
+//------------------------------------------------------------------------------
+static void LOAD_account(void)
+{
+    LOAD_COUNTER_t now = (LOAD_COUNTER_t)LOAD_TIMER();
+    uint32_t elapsed = (LOAD_COUNTER_t)(now - LOAD.timestamp);
+
+    LOAD.timestamp = now;
+
+    switch(LOAD.state)
+    {
+        case LOAD_IDLE:
+            LOAD.window.idle += elapsed;
+            #ifdef USE_LOW_POWER_MODE
+                LOAD.window.sleep += elapsed;
+            #endif
+            break;
+        case LOAD_ISR:
+            LOAD.window.isr += elapsed;
+            break;
+        default:
+            LOAD.window.busy += elapsed;
+            break;
+    }
+
+    LOAD.windowTicks += elapsed;
+    if(LOAD.windowTicks < LOAD_WINDOW)
+        return;
+
+    // Close window
+    LOAD.cpuLoad = LOAD_permille(LOAD.window.busy + LOAD.window.isr,
+                                 LOAD.windowTicks);
+    LOAD.isrLoad = LOAD_permille(LOAD.window.isr, LOAD.windowTicks);
+    LOAD.lpmResidency = LOAD_permille(LOAD.window.sleep, LOAD.windowTicks);
+
+    LOAD.total.busy += LOAD.window.busy;
+    LOAD.total.idle += LOAD.window.idle;
+    LOAD.total.isr += LOAD.window.isr;
+    LOAD.total.sleep += LOAD.window.sleep;
+
+    memset(&LOAD.window, 0x00, sizeof(LOAD_Stats_t));
+    LOAD.windowTicks = 0;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              LOAD_init()
+// Description:
+//! \brief      Initialize (clear) load meter
+//------------------------------------------------------------------------------
+void LOAD_init(void)
+{
+    memset(&LOAD, 0x00, sizeof(LOAD));
+    LOAD.timestamp = (LOAD_COUNTER_t)LOAD_TIMER();
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              LOAD_enterIdle()
+// Description:
+//! \brief      Scheduler enters idle (LPM)
+//------------------------------------------------------------------------------
+void LOAD_enterIdle(void)
+{
+    LOAD_account();
+    LOAD.state = LOAD_IDLE;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              LOAD_leaveIdle()
+// Description:
+//! \brief      Scheduler leaves idle (LPM)
+//------------------------------------------------------------------------------
+void LOAD_leaveIdle(void)
+{
+    if(LOAD.state != LOAD_IDLE)
+        return;
+
+    LOAD_account();
+    LOAD.state = LOAD_BUSY;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              LOAD_enterIsr()
+// Description:
+//! \brief      ISR prologue
+//------------------------------------------------------------------------------
+void LOAD_enterIsr(void)
+{
+    LOAD_account();
+
+    if(LOAD.isrNesting++ == 0)
+        LOAD.interrupted = LOAD.state;
+    LOAD.state = LOAD_ISR;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              LOAD_leaveIsr()
+// Description:
+//! \brief      ISR epilogue
+//------------------------------------------------------------------------------
+void LOAD_leaveIsr(void)
+{
+    LOAD_account();
+
+    if(LOAD.isrNesting && --LOAD.isrNesting == 0)
+        LOAD.state = LOAD.interrupted;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              LOAD_getCpuLoad()
+// Description:
+//! \brief      CPU load (busy + ISR) over the last window
+//! \return     Load in permille
+//------------------------------------------------------------------------------
+uint16_t LOAD_getCpuLoad(void)
+{
+    return LOAD.cpuLoad;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              LOAD_getIsrLoad()
+// Description:
+//! \brief      ISR load over the last window
+//! \return     Load in permille
+//------------------------------------------------------------------------------
+uint16_t LOAD_getIsrLoad(void)
+{
+    return LOAD.isrLoad;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              LOAD_getLpmResidency()
+// Description:
+//! \brief      LPM residency over the last window
+//! \return     Residency in permille
+//------------------------------------------------------------------------------
+uint16_t LOAD_getLpmResidency(void)
+{
+    return LOAD.lpmResidency;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              LOAD_getStats()
+// Description:
+//! \brief      Read total accumulated times since LOAD_init()
+//------------------------------------------------------------------------------
+void LOAD_getStats(LOAD_Stats_t* stats)
+{
+    EnterCriticalSection();
+    stats->busy = LOAD.total.busy + LOAD.window.busy;
+    stats->idle = LOAD.total.idle + LOAD.window.idle;
+    stats->isr = LOAD.total.isr + LOAD.window.isr;
+    stats->sleep = LOAD.total.sleep + LOAD.window.sleep;
+    LeaveCriticalSection();
+}
+
+#endif // USE_LOAD_METER
+
+//******************************************************************************
+// End of file
+//******************************************************************************
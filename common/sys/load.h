@@ -0,0 +1,132 @@
+//******************************************************************************
+// Copyright (C) 2026 Bogdan Kokotenko
+//
+//! \addtogroup system
+//! @{
+//! \defgroup load CPU load meter
+//! \brief CPU load and idle (LPM) residency meter
+//! @{
+//******************************************************************************
+//   File description:
+//! \file       sys/load.h
+//! \brief      CPU load and idle (LPM) residency meter
+//!
+//! \details    Time between hooks is measured by free-running timer and
+//!             accumulated as busy (tasklets), idle (scheduler has no
+//!             tasklets, in LPM if USE_LOW_POWER_MODE) or ISR time.
+//!             Load and residency are calculated over the rolling window
+//!             of LOAD_WINDOW timer ticks.
+//!
+//!             Enabled by USE_LOAD_METER in hal_config.h, otherwise hooks
+//!             are compiled out. Hooks have to be called with interrupts
+//!             disabled, so the timer is read and accounted atomically.
+//!
+//!             Meter is started by TASK_runScheduler(), so the timer
+//!             has to run by then. LOAD_init() may be called again to
+//!             restart the measurement.
+//!
+//! \note       Timer has to be read (any hook) at least once per its period.
+//!
+//!*****************************************************************************
+//! __Revisions:__
+//!  Date       | Author           | Comments
+//!  ---------- | ---------------- | -----------------------------------
+//!  18/10/2026 | Bogdan Kokotenko | Initial draft
+//!  18/10/2026 | Bogdan Kokotenko | Meter is started by scheduler
+//!
+//******************************************************************************
+#ifndef LOAD_H
+#define LOAD_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef USE_LOAD_METER
+
+// Include configurations
+#include "load_config.h"
+
+// Free-running timer selection
+#ifndef LOAD_TIMER
+#if defined(_MINGW_HAL_)
+    //! Host time base (usec)
+    #define LOAD_TIMER()        ((uint32_t)(CLK_timeNs()/1000))
+    #define LOAD_TIMER_FREQ     1000000L
+    #define LOAD_COUNTER_t      uint32_t
+#elif defined(_MSP430F5x_HAL_)
+    //! TA0 runs in continuous mode (SysTick uses CCR0)
+    #define LOAD_TIMER()        TA0R
+    #define LOAD_TIMER_FREQ     T0CLK_FREQ
+    #define LOAD_COUNTER_t      uint16_t
+#else
+    #error LOAD: Free-running timer is not configured (LOAD_TIMER)!
+#endif
+#endif // LOAD_TIMER
+
+//! Width of free-running timer counter
+#ifndef LOAD_COUNTER_t
+#define LOAD_COUNTER_t          uint16_t
+#endif
+
+//! Rolling window (timer ticks), 1 sec by default
+#ifndef LOAD_WINDOW
+#define LOAD_WINDOW             (LOAD_TIMER_FREQ)
+#endif
+
+//! CPU time accumulated per state (timer ticks)
+typedef struct _LOAD_Stats_t{
+    uint32_t busy;              //!< tasklets and scheduler
+    uint32_t idle;              //!< no tasklets to do
+    uint32_t isr;               //!< interrupt service routines
+    uint32_t sleep;             //!< idle time spent in LPM
+}LOAD_Stats_t;
+
+//! Initialize (clear) load meter
+void LOAD_init(void);
+
+//! Scheduler enters idle (LPM)
+void LOAD_enterIdle(void);
+
+//! Scheduler leaves idle (LPM)
+void LOAD_leaveIdle(void);
+
+//! ISR prologue
+void LOAD_enterIsr(void);
+
+//! ISR epilogue
+void LOAD_leaveIsr(void);
+
+//! CPU load (busy + ISR) over the last window, permille
+uint16_t LOAD_getCpuLoad(void);
+
+//! ISR load over the last window, permille
+uint16_t LOAD_getIsrLoad(void);
+
+//! LPM residency over the last window, permille
+uint16_t LOAD_getLpmResidency(void);
+
+//! Read total accumulated times since LOAD_init()
+void LOAD_getStats(LOAD_Stats_t* stats);
+
+#else
+
+// Load meter hooks are compiled out
+#define LOAD_init()
+#define LOAD_enterIdle()
+#define LOAD_leaveIdle()
+#define LOAD_enterIsr()
+#define LOAD_leaveIsr()
+
+#endif // USE_LOAD_METER
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // LOAD_H
+//! @}
+//! @}
+//******************************************************************************
+// End of file
+//******************************************************************************
@@ -0,0 +1,126 @@
+//******************************************************************************
+// Copyright (C) 2026 Bogdan Kokotenko
+//
+//   File description:
+//! \file       sys/stack.c
+//! \brief      Stack high-water mark measurement by stack painting
+//!
+//! \details    Only free stack (beyond the current stack pointer) is painted,
+//!             so the startup frames are kept intact. High-water mark is
+//!             found by scanning from the far end of the stack till the
+//!             first overwritten byte, scan time is proportional to the
+//!             free stack left.
+//!
+//!*****************************************************************************
+//! __Revisions:__
+//!  Date       | Author           | Comments
+//!  ---------- | ---------------- | -----------------------------------
+//!  18/10/2026 | Bogdan Kokotenko | Initial draft
+//
+//******************************************************************************
+#include "project.h"
+#include "types.h"
+#include "hal.h"
+#include "stack.h"
+
+#ifdef USE_STACK_MONITOR
+
+//! Stack monitor context
+static struct SYS_Stack_t{
+    uint16_t    checkCounter;       //!< scheduler loops since last check
+    bool        alarm;              //!< margin alarm has been raised
+}SYS_stack;
+
+//------------------------------------------------------------------------------
+// Function:
+//              SYS_stackPaint()
+// Description:
+//! \brief      Fill free stack with pattern
+//! \details    Has to be called at startup with interrupts disabled
+//!             (e.g. from __low_level_init() or SystemInit()).
+//------------------------------------------------------------------------------
+void SYS_stackPaint(void)
+{
+#ifdef SYS_STACK_GROWS_UP
+    SYS_STACK_PTR_t pointer = SYS_STACK_POINTER() + 1;
+
+    while(pointer < SYS_STACK_END)
+        *pointer++ = SYS_STACK_PATTERN;
+#else
+    SYS_STACK_PTR_t pointer = SYS_STACK_BEGIN;
+    SYS_STACK_PTR_t top = SYS_STACK_POINTER();
+
+    while(pointer < top)
+        *pointer++ = SYS_STACK_PATTERN;
+#endif
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              SYS_stackSize()
+// Description:
+//! \brief      Stack size
+//! \return     Size in bytes
+//------------------------------------------------------------------------------
+uint16_t SYS_stackSize(void)
+{
+    return (uint16_t)(SYS_STACK_END - SYS_STACK_BEGIN);
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              SYS_stackHighWater()
+// Description:
+//! \brief      Maximal stack usage since startup
+//! \return     Used stack in bytes
+//------------------------------------------------------------------------------
+uint16_t SYS_stackHighWater(void)
+{
+#ifdef SYS_STACK_GROWS_UP
+    SYS_STACK_PTR_t pointer = SYS_STACK_END;
+
+    while(pointer > SYS_STACK_BEGIN && *(pointer - 1) == SYS_STACK_PATTERN)
+        pointer--;
+
+    return (uint16_t)(pointer - SYS_STACK_BEGIN);
+#else
+    SYS_STACK_PTR_t pointer = SYS_STACK_BEGIN;
+
+    while(pointer < SYS_STACK_END && *pointer == SYS_STACK_PATTERN)
+        pointer++;
+
+    return (uint16_t)(SYS_STACK_END - pointer);
+#endif
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              SYS_stackCheck()
+// Description:
+//! \brief      Periodic stack check
+//! \details    Calls SYS_stackHandler(used) once, when free stack becomes
+//!             less than SYS_STACK_MARGIN bytes.
+//------------------------------------------------------------------------------
+void SYS_stackCheck(void)
+{
+    uint16_t used;
+
+    if(SYS_stack.alarm || ++SYS_stack.checkCounter < SYS_STACK_CHECK_PERIOD)
+        return;
+    SYS_stack.checkCounter = 0;
+
+    used = SYS_stackHighWater();
+    if(used + SYS_STACK_MARGIN < SYS_stackSize())
+        return;
+
+    SYS_stack.alarm = true;
+    #ifdef SYS_stackHandler
+        SYS_stackHandler(used);
+    #endif
+}
+
+#endif // USE_STACK_MONITOR
+
+//******************************************************************************
+// End of file
+//******************************************************************************
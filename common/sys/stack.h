@@ -0,0 +1,124 @@
+//******************************************************************************
+// Copyright (C) 2026 Bogdan Kokotenko
+//
+//! \addtogroup system
+//! @{
+//! \defgroup stack Stack monitor
+//! \brief Stack high-water mark measurement by stack painting
+//! @{
+//******************************************************************************
+//   File description:
+//! \file       sys/stack.h
+//! \brief      Stack high-water mark measurement by stack painting
+//!
+//! \details    Free stack is filled with SYS_STACK_PATTERN at startup
+//!             (before data initialization), the high-water mark is the
+//!             deepest byte which does not hold the pattern anymore.
+//!             Scheduler checks the mark every SYS_STACK_CHECK_PERIOD loops
+//!             and calls SYS_stackHandler(used) once, when less than
+//!             SYS_STACK_MARGIN bytes of stack are left.
+//!
+//!             Enabled by USE_STACK_MONITOR in hal_config.h, otherwise hooks
+//!             are compiled out. Stack bounds are taken from linker segment
+//!             of the port: CSTACK (MSP430, STM32) or ISTACK (CC254x),
+//!             or set by SYS_STACK_BEGIN/END in stack_config.h.
+//!
+//! \note       Measured mark is the lower bound: function could reserve
+//!             stack frame without writing all of it.
+//!
+//!*****************************************************************************
+//! __Revisions:__
+//!  Date       | Author           | Comments
+//!  ---------- | ---------------- | -----------------------------------
+//!  18/10/2026 | Bogdan Kokotenko | Initial draft
+//!
+//******************************************************************************
+#ifndef STACK_H
+#define STACK_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef USE_STACK_MONITOR
+
+// Include configurations
+#include "stack_config.h"
+
+// Stack bounds selection
+#ifndef SYS_STACK_BEGIN
+#if defined(_MSP430F5x_HAL_) || defined(_MSP430G2X_HAL_)
+    #pragma segment="CSTACK"
+    //! Stack grows down from the segment end
+    #define SYS_STACK_BEGIN         ((uint8_t*)__segment_begin("CSTACK"))
+    #define SYS_STACK_END           ((uint8_t*)__segment_end("CSTACK"))
+    #define SYS_STACK_POINTER()     ((uint8_t*)__get_SP_register())
+#elif defined(_STM32F0X_HAL_)
+    #pragma section="CSTACK"
+    //! Stack (MSP) grows down from the section end
+    #define SYS_STACK_BEGIN         ((uint8_t*)__section_begin("CSTACK"))
+    #define SYS_STACK_END           ((uint8_t*)__section_end("CSTACK"))
+    #define SYS_STACK_POINTER()     ((uint8_t*)__get_MSP())
+#elif defined(_CC254x_HAL_)
+    #pragma segment="ISTACK" __idata
+    //! 8051 stack grows up in IDATA, SP points to the last pushed byte
+    #define SYS_STACK_BEGIN         ((uint8_t __idata*)__segment_begin("ISTACK"))
+    #define SYS_STACK_END           ((uint8_t __idata*)__segment_end("ISTACK"))
+    #define SYS_STACK_POINTER()     ((uint8_t __idata*)SP)
+    #define SYS_STACK_GROWS_UP
+    #define SYS_STACK_PTR_t         uint8_t __idata*
+#else
+    #error STACK: Stack bounds are not configured (SYS_STACK_BEGIN)!
+#endif
+#endif // SYS_STACK_BEGIN
+
+//! Pointer to stack memory
+#ifndef SYS_STACK_PTR_t
+#define SYS_STACK_PTR_t             uint8_t*
+#endif
+
+//! Free stack fill pattern
+#ifndef SYS_STACK_PATTERN
+#define SYS_STACK_PATTERN           0xA5
+#endif
+
+//! Minimal free stack (bytes) before alarm
+#ifndef SYS_STACK_MARGIN
+#define SYS_STACK_MARGIN            32
+#endif
+
+//! Number of scheduler loops between checks
+#ifndef SYS_STACK_CHECK_PERIOD
+#define SYS_STACK_CHECK_PERIOD      16
+#endif
+
+//! Fill free stack with pattern (called from startup)
+void SYS_stackPaint(void);
+
+//! Stack size (bytes)
+uint16_t SYS_stackSize(void);
+
+//! Maximal stack usage since startup (bytes)
+uint16_t SYS_stackHighWater(void);
+
+//! Periodic stack check (called by scheduler)
+void SYS_stackCheck(void);
+
+#else
+
+// Stack monitor hooks are compiled out
+#define SYS_stackPaint()
+#define SYS_stackCheck()
+
+#endif // USE_STACK_MONITOR
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // STACK_H
+//! @}
+//! @}
+//******************************************************************************
+// End of file
+//******************************************************************************
@@ -17,6 +17,9 @@
 //!  15/02/2015 | Bogdan Kokotenko | Fixed issue with task scheduler.
 //!  15/02/2015 | Bogdan Kokotenko | Fixed issue with task self-delete.
 //!  22/07/2016 | Bogdan Kokotenko | Software timers moved to separated unit.
+//!  18/10/2026 | Bogdan Kokotenko | Added CPU load meter hooks.
+//!  18/10/2026 | Bogdan Kokotenko | Added periodic stack check.
+//!  18/10/2026 | Bogdan Kokotenko | CPU load meter is started by scheduler.
 //
 //******************************************************************************
 #include "project.h"
@@ -26,6 +29,8 @@
 #include "timers.h"
 #include "devtime.h"
 #include "task.h"
+#include "load.h"
+#include "stack.h"
 
 //! Tasks queue structure
 static struct TaskQueue{
@@ -85,11 +90,22 @@ void TASK_init(void)
 //------------------------------------------------------------------------------
 void TASK_runScheduler(void)
 {
+    // Start CPU load measurement (hooks are called with interrupts disabled)
+    EnterCriticalSection();
+    LOAD_init();
+    LeaveCriticalSection();
+
     while(true)                     // LOOP FOREVER
     {
+        // Check stack high-water mark (out of critical section)
+        SYS_stackCheck();
+
         // Avoid any interrupts while task queue modification 
         EnterCriticalSection();
 
+        // Account idle time till wake-up
+        LOAD_leaveIdle();
+
         #ifdef WDT_RST
         // Feed watchdog to prevent reset
         // and make sure that no task hangs the CPU
@@ -107,6 +123,8 @@ void TASK_runScheduler(void)
         }
         else 
         {   
+            LOAD_enterIdle();
+
             #ifdef USE_LOW_POWER_MODE
             // If no task to do, switch of CPU
             // Leaving critical section and enter to suspend has to be atomic
@@ -0,0 +1,51 @@
+#*******************************************************************************
+#   Filename:       HalSimTest.pro
+#
+#   Description:    Unit tests for simulated MinGW HAL peripherals
+#
+#   Author:         Bogdan Kokotenko
+#
+#   Revision date:  18/10/2026
+#
+#*******************************************************************************
+TEMPLATE = app
+CONFIG += console
+CONFIG -= app_bundle qt
+
+INCLUDEPATH +=  $$PWD/config \
+                $$PWD/../ \
+                $$PWD/../../common \
+                $$PWD/../../common/hal \
+                $$PWD/../../common/hal/mcu/mingw \
+                $$PWD/../../common/sys
+
+HEADERS +=  $$PWD/config/clocks_config.h \
+            $$PWD/config/hal_config.h \
+            $$PWD/config/timers_config.h \
+            $$PWD/config/spi_config.h \
+            $$PWD/config/i2c_config.h \
+            $$PWD/config/adc_config.h \
+            $$PWD/config/flash_config.h \
+            $$PWD/config/load_config.h \
+            $$PWD/config/stack_config.h
+
+SOURCES +=  main.cpp \
+            $$PWD/../../common/sys/load.c \
+            $$PWD/../../common/sys/stack.c \
+            $$PWD/../../common/sys/ioqueue.c \
+            $$PWD/../../common/hal/mcu/mingw/hal.c \
+            $$PWD/../../common/hal/mcu/mingw/clocks.c \
+            $$PWD/../../common/hal/mcu/mingw/spi.c \
+            $$PWD/../../common/hal/mcu/mingw/i2c.c \
+            $$PWD/../../common/hal/mcu/mingw/eeprom24.c \
+            $$PWD/../../common/hal/mcu/mingw/regmap.c \
+            $$PWD/../../common/hal/mcu/mingw/adc.c \
+            $$PWD/../../common/hal/mcu/mingw/flash.c
+
+# Google C++ Testing Framework
+DEFINES += UNIT_TEST
+include($$PWD/../../common/googletest/googletest.pri)
+
+#*******************************************************************************
+#   End of file
+#*******************************************************************************
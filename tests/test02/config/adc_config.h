@@ -0,0 +1,46 @@
+//******************************************************************************
+// Copyright (C) 2026 Bogdan Kokotenko
+//
+//! \addtogroup test02_config
+//! @{
+//******************************************************************************
+//  File description:
+//! \file       test02/config/adc_config.h
+//! \brief      MinGW simulated ADC configuration
+//!
+//!*****************************************************************************
+//! __Revisions:__
+//!  Date       | Author           | Comments
+//!  ---------- | ---------------- | ----------------
+//!  18/10/2026 | Bogdan Kokotenko | Initial draft
+//!  18/10/2026 | Bogdan Kokotenko | Target ADC_Handler() contract
+//
+//******************************************************************************
+#ifndef ADC_CONFIG_H
+#define ADC_CONFIG_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//! Frames per ADC_Handler() call (DMA block)
+#define ADC_SIM_BLOCK_SIZE      64
+
+//! Frame rate of raw sample files
+#define ADC_SIM_SAMPLE_RATE     16000L      // Hz
+
+//! Test sample block handler
+void ADC_testHandler(int16_t* results, bool overflow);
+
+//! ADC conversion (DMA block) complete handler
+#define ADC_Handler(results, overflow)  ADC_testHandler(results, overflow)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ADC_CONFIG_H
+//! @}
+//******************************************************************************
+// End of file
+//******************************************************************************
@@ -0,0 +1,34 @@
+//******************************************************************************
+// Copyright (C) 2026 Bogdan Kokotenko
+//
+//! \addtogroup test02_config
+//! @{
+//******************************************************************************
+//  File description:
+//! \file       test02/config/clocks_config.h  
+//! \brief      MinGW clocks configuration
+//!
+//!*****************************************************************************
+//! __Revisions:__										
+//!  Date       | Author           | Comments			
+//!  ---------- | ---------------- | ----------------
+//!  18/10/2026 | Bogdan Kokotenko | Initial draft
+//
+//******************************************************************************
+#ifndef CLOCKS_CONFIG_H
+#define CLOCKS_CONFIG_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // CLOCKS_CONFIG_H
+//! @}
+//******************************************************************************
+// End of file
+//******************************************************************************
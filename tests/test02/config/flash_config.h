@@ -0,0 +1,42 @@
+//******************************************************************************
+// Copyright (C) 2026 Bogdan Kokotenko
+//
+//! \addtogroup test02_config
+//! @{
+//******************************************************************************
+//  File description:
+//! \file       test02/config/flash_config.h
+//! \brief      MinGW simulated flash configuration
+//!
+//!*****************************************************************************
+//! __Revisions:__
+//!  Date       | Author           | Comments
+//!  ---------- | ---------------- | ----------------
+//!  18/10/2026 | Bogdan Kokotenko | Initial draft
+//
+//******************************************************************************
+#ifndef FLASH_CONFIG_H
+#define FLASH_CONFIG_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//! Simulated flash size (two banks)
+#define FLASH_SIM_SIZE          (8*1024L)
+
+//! Flash segment (erase unit) size
+#define FLASH_SEGMENT_SIZE      512
+
+//! Flash bank size
+#define FLASH_BANK_SIZE         (4*1024L)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // FLASH_CONFIG_H
+//! @}
+//******************************************************************************
+// End of file
+//******************************************************************************
@@ -0,0 +1,38 @@
+//******************************************************************************
+// Copyright (C) 2026 Bogdan Kokotenko
+//
+//! \addtogroup test02
+//! @{
+//! \defgroup   test02_config MinGW Configuration
+//! \brief      Simulated HAL configurations
+//! @{
+//******************************************************************************
+//   File description:
+//! \file  test02/config/hal_config.h     
+//! \brief MinGW HAL configuration
+//!
+//!*****************************************************************************
+//! __Revisions:__										
+//!  Date       | Author           | Comments			
+//!  ---------- | ---------------- | ----------------
+//!  18/10/2026 | Bogdan Kokotenko | Initial draft
+//
+//******************************************************************************
+#ifndef HAL_CONFIG_H
+#define HAL_CONFIG_H
+
+//! Enable usage of low-power mode (thread sleep)
+#define USE_LOW_POWER_MODE
+
+//! Enable CPU load meter
+#define USE_LOAD_METER
+
+//! Enable stack high-water mark monitor
+#define USE_STACK_MONITOR
+
+//! @}
+//! @}
+#endif // HAL_CONFIG_H
+//******************************************************************************
+// End of file
+//******************************************************************************
@@ -0,0 +1,39 @@
+//******************************************************************************
+// Copyright (C) 2026 Bogdan Kokotenko
+//
+//! \addtogroup test02_config
+//! @{
+//******************************************************************************
+//  File description:
+//! \file       test02/config/i2c_config.h
+//! \brief      MinGW simulated I2C configuration
+//!
+//!*****************************************************************************
+//! __Revisions:__
+//!  Date       | Author           | Comments
+//!  ---------- | ---------------- | ----------------
+//!  18/10/2026 | Bogdan Kokotenko | Initial draft
+//
+//******************************************************************************
+#ifndef I2C_CONFIG_H
+#define I2C_CONFIG_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//! I2C0 simulated bus clock
+#define I2C0_BAUDRATE           100000L     // Hz
+
+//! I2C1 simulated bus clock
+#define I2C1_BAUDRATE           400000L     // Hz
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // I2C_CONFIG_H
+//! @}
+//******************************************************************************
+// End of file
+//******************************************************************************
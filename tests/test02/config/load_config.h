@@ -0,0 +1,44 @@
+//******************************************************************************
+// Copyright (C) 2026 Bogdan Kokotenko
+//
+//! \addtogroup test02_config
+//! @{
+//******************************************************************************
+//  File description:
+//! \file       test02/config/load_config.h
+//! \brief      CPU load meter configuration
+//!
+//!*****************************************************************************
+//! __Revisions:__
+//!  Date       | Author           | Comments
+//!  ---------- | ---------------- | ----------------
+//!  18/10/2026 | Bogdan Kokotenko | Initial draft
+//
+//******************************************************************************
+#ifndef LOAD_CONFIG_H
+#define LOAD_CONFIG_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//! Test free-running timer (16-bit, 1 kHz)
+extern uint16_t LOAD_testTimer;
+
+//! Free-running timer
+#define LOAD_TIMER()            LOAD_testTimer
+#define LOAD_TIMER_FREQ         1000L
+#define LOAD_COUNTER_t          uint16_t
+
+//! Rolling window (timer ticks)
+#define LOAD_WINDOW             1000
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // LOAD_CONFIG_H
+//! @}
+//******************************************************************************
+// End of file
+//******************************************************************************
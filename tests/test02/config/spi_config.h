@@ -0,0 +1,42 @@
+//******************************************************************************
+// Copyright (C) 2026 Bogdan Kokotenko
+//
+//! \addtogroup test02_config
+//! @{
+//******************************************************************************
+//  File description:
+//! \file       test02/config/spi_config.h
+//! \brief      MinGW simulated SPI configuration
+//!
+//!*****************************************************************************
+//! __Revisions:__
+//!  Date       | Author           | Comments
+//!  ---------- | ---------------- | ----------------
+//!  18/10/2026 | Bogdan Kokotenko | Initial draft
+//
+//******************************************************************************
+#ifndef SPI_CONFIG_H
+#define SPI_CONFIG_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//! SPI0 transfers with completion handler
+#define SPI0_ASYNCHRONOUS
+
+//! SPI0 simulated bus clock
+#define SPI0_BAUDRATE           1000000L    // Hz
+
+//! SPI1 simulated bus clock
+#define SPI1_BAUDRATE           8000000L    // Hz
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SPI_CONFIG_H
+//! @}
+//******************************************************************************
+// End of file
+//******************************************************************************
@@ -0,0 +1,54 @@
+//******************************************************************************
+// Copyright (C) 2026 Bogdan Kokotenko
+//
+//! \addtogroup test02_config
+//! @{
+//******************************************************************************
+//  File description:
+//! \file       test02/config/stack_config.h
+//! \brief      Stack monitor configuration
+//!
+//!*****************************************************************************
+//! __Revisions:__
+//!  Date       | Author           | Comments
+//!  ---------- | ---------------- | ----------------
+//!  18/10/2026 | Bogdan Kokotenko | Initial draft
+//
+//******************************************************************************
+#ifndef STACK_CONFIG_H
+#define STACK_CONFIG_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//! Test stack memory and stack pointer
+extern uint8_t STACK_testMemory[256];
+extern uint8_t* STACK_testPointer;
+
+//! Test stack alarm handler
+void STACK_testHandler(uint16_t used);
+
+//! Stack bounds (stack grows down)
+#define SYS_STACK_BEGIN             (STACK_testMemory)
+#define SYS_STACK_END               (STACK_testMemory + sizeof(STACK_testMemory))
+#define SYS_STACK_POINTER()         (STACK_testPointer)
+
+//! Minimal free stack (bytes) before alarm
+#define SYS_STACK_MARGIN            32
+
+//! Number of scheduler loops between checks
+#define SYS_STACK_CHECK_PERIOD      4
+
+//! Stack alarm handler
+#define SYS_stackHandler(used)      STACK_testHandler(used)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // STACK_CONFIG_H
+//! @}
+//******************************************************************************
+// End of file
+//******************************************************************************
@@ -0,0 +1,1073 @@
+//******************************************************************************
+// Copyright (C) 2026 Bogdan Kokotenko
+//
+//! \defgroup test02 Test02
+//! \brief Unit tests for simulated MinGW HAL peripherals
+//! \details See \ref test02/main.cpp
+//******************************************************************************
+//   File description:
+//! \file               test02/main.cpp
+//! \brief              Contains unit tests implementation
+//!
+//!*****************************************************************************
+//! __Revisions:__
+//!  Date       | Author           | Comments
+//!  ---------- | ---------------- | ----------------
+//!  18/10/2026 | Bogdan Kokotenko | Initial draft
+//!  18/10/2026 | Bogdan Kokotenko | Added I/O request queue tests
+//
+//******************************************************************************
+#include "project.h"
+#include "types.h"
+#include "hal.h"
+#include "clocks.h"
+#include "spi.h"
+#include "i2c.h"
+#include "eeprom24.h"
+#include "regmap.h"
+#include "adc.h"
+#include "flash.h"
+#include "load.h"
+#include "stack.h"
+#include "task.h"
+#include "ioqueue.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+//! Sensor chip select port/pin
+#define SENSOR_CS_PORT      1
+#define SENSOR_CS_PIN       4
+
+//! Sensor I2C slave address
+#define SENSOR_ADDRESS      0x1D
+
+//! Number of completion handler calls
+static int BUS_handlerCalls;
+
+//------------------------------------------------------------------------------
+// Function:
+//              BUS_handler()
+// Description:
+//! \brief      Transfer completion handler
+//------------------------------------------------------------------------------
+static void BUS_handler(void)
+{
+    BUS_handlerCalls++;
+}
+
+//------------------------------------------------------------------------------
+// Class:
+//              BusSimTestFixture
+// Description:
+//! \brief      Fixtures for simulated bus test cases
+//------------------------------------------------------------------------------
+class BusSimTestFixture : public ::testing::Test
+{
+protected:
+    uint8_t    memory[2048];    //!< EEPROM memory (24C16)
+    EEPROM24_t eeprom;          //!< EEPROM device model
+    uint8_t    regs[16];        //!< sensor register file
+    uint8_t    mask[16];        //!< sensor writable bits
+    REGMAP_t   sensor;          //!< sensor device model
+
+    //! Test case setup
+    void SetUp()
+    {
+        SPI_SIM_detachAll();
+        I2C_SIM_detachAll();
+        SPI0_init();
+        I2C0_init();
+        BUS_handlerCalls = 0;
+
+        EEPROM24_init(&eeprom, memory, sizeof(memory), 16);
+        ASSERT_TRUE(EEPROM24_attach(0, EEPROM24_ADDRESS, &eeprom));
+
+        for(uint8_t index = 0; index < sizeof(regs); index++)
+            regs[index] = index;
+        memset(mask, 0xFF, sizeof(mask));
+        mask[0] = 0x00;                             // read-only WHO_AM_I
+        REGMAP_init(&sensor, regs, sizeof(regs), mask);
+        ASSERT_TRUE(SPI_SIM_attach(0, SENSOR_CS_PORT, SENSOR_CS_PIN,
+                                   &REGMAP_spiModel, &sensor));
+        ASSERT_TRUE(I2C_SIM_attach(0, SENSOR_ADDRESS, 0x7F,
+                                   &REGMAP_i2cModel, &sensor));
+    }
+};
+
+//------------------------------------------------------------------------------
+// Function:
+//              BusSimTest.EEPROM24_pageWriteAndRead()
+// Description:
+//! \brief      Check EEPROM page write roll-over and sequential read
+//------------------------------------------------------------------------------
+TEST_F(BusSimTestFixture, EEPROM24_pageWriteAndRead)
+{
+    // Write 4 bytes at 0x10E: two last bytes roll over to page start 0x100
+    const uint8_t write[] = {0x0E, 0xA1, 0xA2, 0xA3, 0xA4};
+    I2C0_transmit(EEPROM24_ADDRESS | 0x01, write, sizeof(write), BUS_handler);
+    ASSERT_FALSE(I2C0_error());
+    ASSERT_EQ(1, BUS_handlerCalls);
+    ASSERT_EQ(1u, eeprom.writeCycles);
+
+    ASSERT_EQ(0xA1, memory[0x10E]);
+    ASSERT_EQ(0xA2, memory[0x10F]);
+    ASSERT_EQ(0xA3, memory[0x100]);
+    ASSERT_EQ(0xA4, memory[0x101]);
+    ASSERT_EQ(0xFF, memory[0x110]);
+
+    // Random read from block 1 with repeated start
+    uint8_t address = 0x00;
+    uint8_t read[2];
+    I2C0_request(EEPROM24_ADDRESS | 0x01, &address, 1,
+                 read, sizeof(read), BUS_handler);
+    ASSERT_FALSE(I2C0_error());
+    ASSERT_EQ(0xA3, read[0]);
+    ASSERT_EQ(0xA4, read[1]);
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              BusSimTest.EEPROM24_ackPolling()
+// Description:
+//! \brief      Check EEPROM does not acknowledge during write cycle
+//------------------------------------------------------------------------------
+TEST_F(BusSimTestFixture, EEPROM24_ackPolling)
+{
+    eeprom.writeCycleNs = 20000000ULL;              // 20 msec
+
+    const uint8_t write[] = {0x00, 0x55};
+    I2C0_transmit(EEPROM24_ADDRESS, write, sizeof(write), BUS_handler);
+    ASSERT_FALSE(I2C0_error());
+
+    // Device is busy
+    I2C0_transmit(EEPROM24_ADDRESS, write, 1, BUS_handler);
+    ASSERT_TRUE(I2C0_error());
+
+    // Device is ready after write cycle
+    CLK_delayNs(eeprom.writeCycleNs);
+    I2C0_transmit(EEPROM24_ADDRESS, write, 1, BUS_handler);
+    ASSERT_FALSE(I2C0_error());
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              BusSimTest.I2C_nackOfAbsentDevice()
+// Description:
+//! \brief      Check NACK of absent slave is reported via handler and error
+//------------------------------------------------------------------------------
+TEST_F(BusSimTestFixture, I2C_nackOfAbsentDevice)
+{
+    uint8_t read[4] = {0};
+
+    I2C0_receive(0x42, read, sizeof(read), BUS_handler);
+    ASSERT_TRUE(I2C0_error());
+    ASSERT_EQ(1, BUS_handlerCalls);
+
+    I2C_SIM_Stats_t stats;
+    I2C_SIM_getStats(0, &stats);
+    ASSERT_EQ(1u, stats.nacks);
+    ASSERT_EQ(0u, stats.bytes);
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              BusSimTest.REGMAP_spiBurstAccess()
+// Description:
+//! \brief      Check register-map sensor burst read/write via SPI
+//------------------------------------------------------------------------------
+TEST_F(BusSimTestFixture, REGMAP_spiBurstAccess)
+{
+    uint8_t tx[4] = {REGMAP_SPI_READ | 0x02, 0x00, 0x00, 0x00};
+    uint8_t rx[4];
+
+    SPI_chipSelect(SENSOR_CS_PORT, SENSOR_CS_PIN);
+    SPI0_exchange(rx, tx, sizeof(tx), BUS_handler);
+    SPI_chipRelease(SENSOR_CS_PORT, SENSOR_CS_PIN);
+    ASSERT_EQ(1, BUS_handlerCalls);
+    ASSERT_EQ(0x02, rx[1]);
+    ASSERT_EQ(0x03, rx[2]);
+    ASSERT_EQ(0x04, rx[3]);
+
+    // Burst write including read-only register 0
+    const uint8_t write[] = {0x0F, 0x5A, 0xA5};
+    SPI_chipSelect(SENSOR_CS_PORT, SENSOR_CS_PIN);
+    SPI0_transmit(write, sizeof(write), BUS_handler);
+    SPI_chipRelease(SENSOR_CS_PORT, SENSOR_CS_PIN);
+    ASSERT_EQ(0x5A, regs[0x0F]);
+    ASSERT_EQ(0x00, regs[0x00]);
+
+    // Idle MISO level without selected device
+    ASSERT_EQ(0xFF, SPI0_exchByte(0x00));
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              BusSimTest.REGMAP_i2cRegisterRead()
+// Description:
+//! \brief      Check register-map sensor register read via I2C
+//------------------------------------------------------------------------------
+TEST_F(BusSimTestFixture, REGMAP_i2cRegisterRead)
+{
+    uint8_t reg = 0x05;
+    uint8_t read[3];
+
+    I2C0_request(SENSOR_ADDRESS, &reg, 1, read, sizeof(read), BUS_handler);
+    ASSERT_FALSE(I2C0_error());
+    ASSERT_EQ(0x05, read[0]);
+    ASSERT_EQ(0x06, read[1]);
+    ASSERT_EQ(0x07, read[2]);
+
+    // Non-existent register is not acknowledged
+    reg = 0x20;
+    I2C0_request(SENSOR_ADDRESS, &reg, 1, read, sizeof(read), BUS_handler);
+    ASSERT_TRUE(I2C0_error());
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              BusSimTest.STATS_busTiming()
+// Description:
+//! \brief      Check modelled bus time against configured clocks
+//------------------------------------------------------------------------------
+TEST_F(BusSimTestFixture, STATS_busTiming)
+{
+    uint8_t data[10] = {0};
+
+    // SPI0 @ 1 MHz: 8 usec per byte
+    SPI_SIM_resetStats(0);
+    SPI0_exchange(data, data, sizeof(data), NULL);
+    SPI_SIM_Stats_t spiStats;
+    SPI_SIM_getStats(0, &spiStats);
+    ASSERT_EQ(1u, spiStats.transactions);
+    ASSERT_EQ(10u, spiStats.bytes);
+    ASSERT_EQ(80000u, spiStats.busyNs);
+
+    // I2C0 @ 100 kHz: S + 9 bit address + 2 x 9 bit data + P = 29 bits
+    I2C_SIM_resetStats(0);
+    I2C0_transmit(EEPROM24_ADDRESS, data, 2, NULL);
+    I2C_SIM_Stats_t i2cStats;
+    I2C_SIM_getStats(0, &i2cStats);
+    ASSERT_EQ(1u, i2cStats.transactions);
+    ASSERT_EQ(2u, i2cStats.bytes);
+    ASSERT_EQ(290000u, i2cStats.busyNs);
+
+    // Faster clock scales bus time
+    I2C_SIM_setBaudrate(0, 400000L);
+    I2C_SIM_resetStats(0);
+    I2C0_transmit(EEPROM24_ADDRESS, data, 2, NULL);
+    I2C_SIM_getStats(0, &i2cStats);
+    ASSERT_EQ(72500u, i2cStats.busyNs);
+}
+
+//! Delivered samples checksum
+static int64_t ADC_testSum;
+
+//! Number of delivered samples
+static uint32_t ADC_testSamples;
+
+//! Number of late blocks
+static uint32_t ADC_testOverflows;
+
+//------------------------------------------------------------------------------
+// Function:
+//              ADC_testHandler()
+// Description:
+//! \brief      Sample block handler (configured as ADC_Handler)
+//------------------------------------------------------------------------------
+void ADC_testHandler(int16_t* results, bool overflow)
+{
+    uint8_t channels = ADC_SIM_getChannels();
+
+    for(uint16_t frame = 0; frame < ADC_SIM_BLOCK_SIZE; frame++)
+    {
+        // Ramp: channels of whole frame follow each other
+        for(uint8_t channel = 1; channel < channels; channel++)
+        {
+            ASSERT_EQ(results[frame*channels] + 7*channel,
+                      results[frame*channels + channel]);
+        }
+        for(uint8_t channel = 0; channel < channels; channel++)
+            ADC_testSum += results[frame*channels + channel];
+    }
+    ADC_testSamples += ADC_SIM_BLOCK_SIZE*channels;
+    if(overflow)
+        ADC_testOverflows++;
+}
+
+//------------------------------------------------------------------------------
+// Class:
+//              AdcSimTestFixture
+// Description:
+//! \brief      Fixtures for simulated ADC test cases
+//------------------------------------------------------------------------------
+class AdcSimTestFixture : public ::testing::Test
+{
+protected:
+    char fileName[32];          //!< temporary sample file
+
+    //! Test case setup
+    void SetUp()
+    {
+        strcpy(fileName, "/tmp/adcsimXXXXXX");
+        int fd = mkstemp(fileName);
+        ASSERT_GE(fd, 0);
+        close(fd);
+
+        ADC_testSum = 0;
+        ADC_testSamples = 0;
+        ADC_testOverflows = 0;
+    }
+
+    //! Test case tear down
+    void TearDown()
+    {
+        ADC_SIM_close();
+        unlink(fileName);
+    }
+
+    //! Write ramp samples (optionally with WAV header)
+    int64_t writeFile(uint32_t samples, uint32_t wavRate, uint16_t bits = 16,
+                      uint16_t channels = 1)
+    {
+        FILE* file = fopen(fileName, "wb");
+        int64_t sum = 0;
+
+        if(wavRate)
+        {
+            uint32_t dataSize = samples*sizeof(int16_t);
+            uint8_t header[44];
+            memcpy(header, "RIFF\0\0\0\0WAVEfmt \x10\0\0\0\x01\0\x01\0", 24);
+            for(int byte = 0; byte < 4; byte++)
+            {
+                header[4 + byte] = (uint8_t)((36 + dataSize) >> (8*byte));
+                header[24 + byte] = (uint8_t)(wavRate >> (8*byte));
+                header[28 + byte] = (uint8_t)((2*wavRate) >> (8*byte));
+                header[40 + byte] = (uint8_t)(dataSize >> (8*byte));
+            }
+            header[22] = (uint8_t)channels;
+            for(int byte = 0; byte < 4; byte++)
+                header[28 + byte] = (uint8_t)((2*channels*wavRate) >>
+                                              (8*byte));
+            header[32] = (uint8_t)(2*channels); header[33] = 0;  // align
+            header[34] = (uint8_t)bits; header[35] = 0;
+            memcpy(&header[36], "data", 4);
+            fwrite(header, sizeof(header), 1, file);
+        }
+
+        for(uint32_t index = 0; index < samples; index++)
+        {
+            int16_t sample = (int16_t)(index*7 - 30000);
+            fwrite(&sample, sizeof(sample), 1, file);
+            sum += sample;
+        }
+
+        fclose(file);
+        return sum;
+    }
+};
+
+//------------------------------------------------------------------------------
+// Function:
+//              AdcSimTest.ADC_rawFileMaxRate()
+// Description:
+//! \brief      Check raw file is streamed in DMA blocks as fast as possible
+//------------------------------------------------------------------------------
+TEST_F(AdcSimTestFixture, ADC_rawFileMaxRate)
+{
+    const uint32_t samples = 1500*ADC_SIM_BLOCK_SIZE;
+    int64_t sum = writeFile(samples, 0);
+
+    ASSERT_TRUE(ADC_SIM_open(fileName));
+    ASSERT_EQ(samples, ADC_SIM_getSamples());
+    ASSERT_EQ((uint32_t)ADC_SIM_SAMPLE_RATE, ADC_SIM_getSampleRate());
+
+    ADC_SIM_setRate(ADC_SIM_RATE_MAX);
+    ASSERT_EQ(samples, ADC_SIM_run(0, false));
+    ASSERT_EQ(samples, ADC_testSamples);
+    ASSERT_EQ(sum, ADC_testSum);
+
+    ADC_SIM_Stats_t stats;
+    ADC_SIM_getStats(&stats);
+    ASSERT_EQ(1500u, stats.blocks);
+    printf("ADC stream: %.1f Msamples/s\n",
+           stats.samples*1000.0/(stats.elapsedNs + 1));
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              AdcSimTest.ADC_wavFilePacedLoop()
+// Description:
+//! \brief      Check WAV file is paced at its sample rate and looped
+//------------------------------------------------------------------------------
+TEST_F(AdcSimTestFixture, ADC_wavFilePacedLoop)
+{
+    int64_t sum = writeFile(800, 8000);
+
+    ASSERT_TRUE(ADC_SIM_open(fileName));
+    ASSERT_EQ(800u, ADC_SIM_getSamples());
+    ASSERT_EQ(8000u, ADC_SIM_getSampleRate());
+    ASSERT_EQ(1, ADC_SIM_getChannels());
+
+    // 768 of 800 samples are whole blocks, 1536 samples @ 8 kHz = 192 msec
+    ASSERT_EQ(1536u, ADC_SIM_run(1536, true));
+    ASSERT_EQ(1536u, ADC_testSamples);
+    for(int32_t index = 768; index < 800; index++)
+        sum -= (int16_t)(index*7 - 30000);
+    ASSERT_EQ(2*sum, ADC_testSum);
+
+    ADC_SIM_Stats_t stats;
+    ADC_SIM_getStats(&stats);
+    ASSERT_NEAR(192000000.0, (double)stats.elapsedNs, 10000000.0);
+    ASSERT_EQ(0u, stats.overruns);
+    ASSERT_EQ(0u, ADC_testOverflows);
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              AdcSimTest.ADC_wavStereoPaced()
+// Description:
+//! \brief      Check stereo WAV file is paced at its frame rate in whole
+//!             frames
+//------------------------------------------------------------------------------
+TEST_F(AdcSimTestFixture, ADC_wavStereoPaced)
+{
+    const uint32_t frames = 12*ADC_SIM_BLOCK_SIZE;
+    int64_t sum = writeFile(2*frames, 8000, 16, 2);
+
+    ASSERT_TRUE(ADC_SIM_open(fileName));
+    ASSERT_EQ(2*frames, ADC_SIM_getSamples());
+    ASSERT_EQ(8000u, ADC_SIM_getSampleRate());
+    ASSERT_EQ(2, ADC_SIM_getChannels());
+
+    // 768 frames @ 8 kHz = 96 msec (not 192 msec of 1536 samples)
+    ASSERT_EQ(frames, ADC_SIM_run(0, false));
+    ASSERT_EQ(2*frames, ADC_testSamples);
+    ASSERT_EQ(sum, ADC_testSum);
+
+    ADC_SIM_Stats_t stats;
+    ADC_SIM_getStats(&stats);
+    ASSERT_EQ(2*frames, stats.samples);
+    ASSERT_EQ(12u, stats.blocks);
+    ASSERT_NEAR(96000000.0, (double)stats.elapsedNs, 10000000.0);
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              AdcSimTest.ADC_wavUnsupportedFormat()
+// Description:
+//! \brief      Check only 16-bit PCM WAV files are accepted
+//------------------------------------------------------------------------------
+TEST_F(AdcSimTestFixture, ADC_wavUnsupportedFormat)
+{
+    writeFile(100, 8000, 8);
+
+    ASSERT_FALSE(ADC_SIM_open(fileName));
+    ASSERT_EQ(0u, ADC_SIM_run(0, false));
+}
+
+//------------------------------------------------------------------------------
+// Class:
+//              FlashSimTestFixture
+// Description:
+//! \brief      Fixtures for simulated flash test cases
+//------------------------------------------------------------------------------
+class FlashSimTestFixture : public ::testing::Test
+{
+protected:
+    char     fileName[32];      //!< temporary flash image
+    uint8_t* flash;             //!< simulated flash start
+
+    //! Test case setup
+    void SetUp()
+    {
+        strcpy(fileName, "/tmp/flashsimXXXXXX");
+        int fd = mkstemp(fileName);
+        ASSERT_GE(fd, 0);
+        close(fd);
+
+        ASSERT_TRUE(FLASH_SIM_open(fileName));
+        flash = (uint8_t*)FLASH_SIM_base();
+    }
+
+    //! Test case tear down
+    void TearDown()
+    {
+        FLASH_SIM_close();
+        unlink(fileName);
+    }
+};
+
+//------------------------------------------------------------------------------
+// Function:
+//              FlashSimTest.FLASH_programClearsBitsOnly()
+// Description:
+//! \brief      Check erase-before-write semantics
+//------------------------------------------------------------------------------
+TEST_F(FlashSimTestFixture, FLASH_programClearsBitsOnly)
+{
+    uint8_t data[4] = {0x12, 0x34, 0x56, 0x78};
+
+    // New image is erased
+    for(uint32_t index = 0; index < FLASH_SIM_SIZE; index++)
+        ASSERT_EQ(0xFF, flash[index]);
+
+    FLASH_write(&flash[100], data, sizeof(data));
+    ASSERT_EQ(0, memcmp(&flash[100], data, sizeof(data)));
+
+    // Rewrite without erase only clears bits
+    uint8_t update[4] = {0xF0, 0xF0, 0xF0, 0xF0};
+    FLASH_write(&flash[100], update, sizeof(update));
+    ASSERT_EQ(0x10, flash[100]);
+    ASSERT_EQ(0x30, flash[101]);
+
+    FLASH_SIM_Stats_t stats;
+    FLASH_SIM_getStats(&stats);
+    ASSERT_EQ(2u, stats.writes);
+    ASSERT_EQ(1u, stats.violations);
+
+    // Erase restores whole segment
+    FLASH_segmentErase(&flash[100]);
+    ASSERT_EQ(0xFF, flash[0]);
+    ASSERT_EQ(0xFF, flash[100]);
+    FLASH_write(&flash[100], update, sizeof(update));
+    FLASH_SIM_getStats(&stats);
+    ASSERT_EQ(1u, stats.violations);
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              FlashSimTest.FLASH_eraseCountersPersist()
+// Description:
+//! \brief      Check segment/bank erase counters and image persistence
+//------------------------------------------------------------------------------
+TEST_F(FlashSimTestFixture, FLASH_eraseCountersPersist)
+{
+    uint8_t data = 0xA5;
+
+    FLASH_segmentErase(&flash[FLASH_SEGMENT_SIZE]);
+    FLASH_segmentErase(&flash[FLASH_SEGMENT_SIZE + 10]);
+    FLASH_bankErase(&flash[0]);
+    FLASH_write(&flash[FLASH_BANK_SIZE], &data, 1);
+
+    ASSERT_EQ(1u, FLASH_SIM_getEraseCount(&flash[0]));
+    ASSERT_EQ(3u, FLASH_SIM_getEraseCount(&flash[FLASH_SEGMENT_SIZE]));
+    ASSERT_EQ(0u, FLASH_SIM_getEraseCount(&flash[FLASH_BANK_SIZE]));
+
+    // Reopen image
+    FLASH_SIM_close();
+    ASSERT_TRUE(FLASH_SIM_open(fileName));
+    flash = (uint8_t*)FLASH_SIM_base();
+
+    ASSERT_EQ(0xA5, flash[FLASH_BANK_SIZE]);
+    ASSERT_EQ(3u, FLASH_SIM_getMaxEraseCount());
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              FlashSimTest.FLASH_latencyModel()
+// Description:
+//! \brief      Check modelled erase/program time
+//------------------------------------------------------------------------------
+TEST_F(FlashSimTestFixture, FLASH_latencyModel)
+{
+    uint8_t data[16];
+    memset(data, 0x00, sizeof(data));
+
+    FLASH_segmentErase(&flash[0]);
+    FLASH_bankErase(&flash[0]);
+    FLASH_write(&flash[0], data, sizeof(data));
+
+    FLASH_SIM_Stats_t stats;
+    FLASH_SIM_getStats(&stats);
+    ASSERT_EQ(1u, stats.segmentErases);
+    ASSERT_EQ(1u, stats.bankErases);
+    ASSERT_EQ(16u, stats.bytesWritten);
+    ASSERT_EQ(FLASH_SIM_SEGMENT_ERASE_NS + FLASH_SIM_BANK_ERASE_NS +
+              16*FLASH_SIM_BYTE_WRITE_NS, stats.busyNs);
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              FlashSimTest.FLASH_lockedImage()
+// Description:
+//! \brief      Check direct write to locked flash is caught
+//------------------------------------------------------------------------------
+TEST_F(FlashSimTestFixture, FLASH_lockedImage)
+{
+    ::testing::FLAGS_gtest_death_test_style = "threadsafe";
+    ASSERT_DEATH(flash[0] = 0x00, "");
+}
+
+//! Test free-running timer (configured as LOAD_TIMER)
+uint16_t LOAD_testTimer;
+
+//------------------------------------------------------------------------------
+// Function:
+//              LoadMeterTest.LOAD_windowLoadAndResidency()
+// Description:
+//! \brief      Check busy/idle/ISR accounting over rolling window
+//------------------------------------------------------------------------------
+TEST(LoadMeterTest, LOAD_windowLoadAndResidency)
+{
+    LOAD_testTimer = 0xFF00;                        // counter wraps in window
+    LOAD_init();
+
+    // 10 cycles of: 20 ticks tasklet, 10 ticks ISR (wake-up), 70 ticks idle
+    for(int cycle = 0; cycle < 10; cycle++)
+    {
+        LOAD_testTimer += 20;
+        LOAD_enterIdle();
+        LOAD_testTimer += 65;
+        LOAD_enterIsr();
+        LOAD_testTimer += 10;
+        LOAD_leaveIsr();
+        LOAD_testTimer += 5;
+        LOAD_leaveIdle();
+    }
+
+    ASSERT_EQ(300, LOAD_getCpuLoad());
+    ASSERT_EQ(100, LOAD_getIsrLoad());
+    ASSERT_EQ(700, LOAD_getLpmResidency());
+
+    LOAD_Stats_t stats;
+    LOAD_getStats(&stats);
+    ASSERT_EQ(200u, stats.busy);
+    ASSERT_EQ(700u, stats.idle);
+    ASSERT_EQ(100u, stats.isr);
+    ASSERT_EQ(700u, stats.sleep);
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              LoadMeterTest.LOAD_nestedIsr()
+// Description:
+//! \brief      Check nested ISR restores interrupted state
+//------------------------------------------------------------------------------
+TEST(LoadMeterTest, LOAD_nestedIsr)
+{
+    LOAD_testTimer = 0;
+    LOAD_init();
+
+    LOAD_enterIdle();
+    LOAD_testTimer += 100;
+    LOAD_enterIsr();                                // idle interrupted
+    LOAD_testTimer += 10;
+    LOAD_enterIsr();                                // nested ISR
+    LOAD_testTimer += 10;
+    LOAD_leaveIsr();
+    LOAD_testTimer += 10;
+    LOAD_leaveIsr();
+    LOAD_testTimer += 870;                          // back to idle
+    LOAD_leaveIdle();                               // window is closed
+
+    ASSERT_EQ(30, LOAD_getCpuLoad());
+    ASSERT_EQ(970, LOAD_getLpmResidency());
+
+    // Busy time is accounted after idle
+    LOAD_testTimer += 50;
+    LOAD_enterIdle();
+    LOAD_Stats_t stats;
+    LOAD_getStats(&stats);
+    ASSERT_EQ(50u, stats.busy);
+    ASSERT_EQ(30u, stats.isr);
+}
+
+//! Test stack memory and stack pointer (configured as stack bounds)
+uint8_t STACK_testMemory[256];
+uint8_t* STACK_testPointer;
+
+//! Stack alarm handler calls
+static int STACK_alarms;
+static uint16_t STACK_alarmUsed;
+
+//------------------------------------------------------------------------------
+// Function:
+//              STACK_testHandler()
+// Description:
+//! \brief      Test stack alarm handler
+//------------------------------------------------------------------------------
+void STACK_testHandler(uint16_t used)
+{
+    STACK_alarms++;
+    STACK_alarmUsed = used;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              StackMonitorTest.SYS_stackHighWaterAndAlarm()
+// Description:
+//! \brief      Check painting, high-water mark and margin alarm
+//------------------------------------------------------------------------------
+TEST(StackMonitorTest, SYS_stackHighWaterAndAlarm)
+{
+    // Startup frame occupies top 16 bytes
+    memset(STACK_testMemory, 0x00, sizeof(STACK_testMemory));
+    STACK_testPointer = STACK_testMemory + sizeof(STACK_testMemory) - 16;
+    SYS_stackPaint();
+
+    ASSERT_EQ(256, SYS_stackSize());
+    ASSERT_EQ(16, SYS_stackHighWater());
+    ASSERT_EQ(0x00, STACK_testMemory[240]);         // startup frame is kept
+
+    // Deep call leaves used bytes, pattern-like holes do not matter
+    STACK_testMemory[100] = 0x00;
+    STACK_testMemory[101] = SYS_STACK_PATTERN;
+    ASSERT_EQ(156, SYS_stackHighWater());
+
+    // No alarm while margin is kept
+    STACK_alarms = 0;
+    for(int loop = 0; loop < 2*SYS_STACK_CHECK_PERIOD; loop++)
+        SYS_stackCheck();
+    ASSERT_EQ(0, STACK_alarms);
+
+    // Alarm is raised once at the next check
+    STACK_testMemory[SYS_STACK_MARGIN - 1] = 0x00;
+    for(int loop = 0; loop < 2*SYS_STACK_CHECK_PERIOD; loop++)
+        SYS_stackCheck();
+    ASSERT_EQ(1, STACK_alarms);
+    ASSERT_EQ(256 - SYS_STACK_MARGIN + 1, STACK_alarmUsed);
+}
+
+//! Posted completion tasklets
+static std::vector<task_t> IOQ_tasklets;
+
+//------------------------------------------------------------------------------
+// Function:
+//              TASK_create()
+// Description:
+//! \brief      Test double of tasklet queue (records posted tasklets)
+//------------------------------------------------------------------------------
+extern "C" bool TASK_create(task_t handle)
+{
+    IOQ_tasklets.push_back(handle);
+    return true;
+}
+
+//! Asynchronous test bus: started transfers and chip select trace
+static struct{
+    std::vector<char>   trace;          //!< 'S', 'W', 'R', 'Q', 'P'
+    void              (*handler)(void); //!< pending completion handler
+    bool                error;          //!< error of the last transfer
+    bool                failNext;       //!< next transfer fails
+}IOQ_fake;
+
+//! Test bus driver operations
+static void IOQ_fakeStart(char type, void (*handler)(void))
+{
+    IOQ_fake.trace.push_back(type);
+    IOQ_fake.handler = handler;
+}
+static void IOQ_fakeWrite(uint8_t, const void*, uint16_t,
+                          void (*handler)(void))
+{
+    IOQ_fakeStart('W', handler);
+}
+static void IOQ_fakeRead(uint8_t, void*, uint16_t, void (*handler)(void))
+{
+    IOQ_fakeStart('R', handler);
+}
+static void IOQ_fakeRequest(uint8_t, const void*, uint16_t, void*, uint16_t,
+                            void (*handler)(void))
+{
+    IOQ_fakeStart('Q', handler);
+}
+static void IOQ_fakeSelect(uint8_t)
+{
+    IOQ_fake.trace.push_back('S');
+}
+static void IOQ_fakeRelease(uint8_t)
+{
+    IOQ_fake.trace.push_back('P');
+}
+static bool IOQ_fakeError(void)
+{
+    return IOQ_fake.error;
+}
+
+//! Test bus driver
+static const IOQ_Driver_t IOQ_fakeDriver = {
+    IOQ_fakeWrite, IOQ_fakeRead, IOQ_fakeRequest,
+    IOQ_fakeSelect, IOQ_fakeRelease, IOQ_fakeError
+};
+
+//------------------------------------------------------------------------------
+// Function:
+//              IOQ_fakeComplete()
+// Description:
+//! \brief      Transfer completion interrupt of test bus
+//------------------------------------------------------------------------------
+static void IOQ_fakeComplete(void)
+{
+    void (*handler)(void) = IOQ_fake.handler;
+
+    IOQ_fake.handler = NULL;
+    IOQ_fake.error = IOQ_fake.failNext;
+    IOQ_fake.failNext = false;
+    if(handler)
+        handler();
+}
+
+//! Completion tasklets
+static void IOQ_done1(void) {}
+static void IOQ_done2(void) {}
+static void IOQ_done3(void) {}
+
+//------------------------------------------------------------------------------
+// Function:
+//              SPI0_ioqWrite(), SPI0_ioqRead(), SPI0_ioqSelect/Release()
+// Description:
+//! \brief      SPI0 adapters of I/O queue driver interface
+//------------------------------------------------------------------------------
+static void SPI0_ioqWrite(uint8_t, const void* data, uint16_t size,
+                          void (*handler)(void))
+{
+    SPI0_transmit(data, size, handler);
+}
+static void SPI0_ioqRead(uint8_t, void* data, uint16_t size,
+                         void (*handler)(void))
+{
+    SPI0_receive(data, size, handler);
+}
+static void SPI0_ioqSelect(uint8_t pin)
+{
+    SPI_chipSelect(SENSOR_CS_PORT, pin);
+}
+static void SPI0_ioqRelease(uint8_t pin)
+{
+    SPI_chipRelease(SENSOR_CS_PORT, pin);
+}
+
+//------------------------------------------------------------------------------
+// Class:
+//              IoQueueTestFixture
+// Description:
+//! \brief      Fixtures for I/O request queue test cases
+//------------------------------------------------------------------------------
+class IoQueueTestFixture : public BusSimTestFixture
+{
+protected:
+    //! Test case setup
+    void SetUp()
+    {
+        BusSimTestFixture::SetUp();
+        IOQ_tasklets.clear();
+        IOQ_fake.trace.clear();
+        IOQ_fake.handler = NULL;
+        IOQ_fake.error = false;
+        IOQ_fake.failNext = false;
+    }
+};
+
+//------------------------------------------------------------------------------
+// Function:
+//              IoQueueTest.IOQ_backToBack()
+// Description:
+//! \brief      Queued requests are started by completion handler
+//------------------------------------------------------------------------------
+TEST_F(IoQueueTestFixture, IOQ_backToBack)
+{
+    const uint8_t command[2] = {0x01, 0x02};
+    uint8_t data[4];
+    const IOQ_Op_t write[] = {
+        {IOQ_WRITE, 0x10, sizeof(command), 0, command, NULL}
+    };
+    const IOQ_Op_t read[] = {
+        {IOQ_SELECT, 4, 0, 0, NULL, NULL},
+        {IOQ_WRITE, 0x10, sizeof(command), 0, command, NULL},
+        {IOQ_READ, 0x10, 0, sizeof(data), NULL, data},
+        {IOQ_RELEASE, 4, 0, 0, NULL, NULL}
+    };
+    IOQ_Request_t request1 = {write, 1, IOQ_done1, IOQ_IDLE, NULL};
+    IOQ_Request_t request2 = {read, 4, IOQ_done2, IOQ_IDLE, NULL};
+    IOQ_Request_t request3 = {write, 1, IOQ_done3, IOQ_IDLE, NULL};
+
+    ASSERT_TRUE(IOQ_init(0, &IOQ_fakeDriver));
+    ASSERT_FALSE(IOQ_isBusy(0));
+
+    // The first request is started, others wait
+    ASSERT_TRUE(IOQ_submit(0, &request1));
+    ASSERT_TRUE(IOQ_submit(0, &request2));
+    ASSERT_TRUE(IOQ_submit(0, &request3));
+    ASSERT_FALSE(IOQ_submit(0, &request2));         // already queued
+    ASSERT_TRUE(IOQ_isBusy(0));
+    ASSERT_EQ(std::string("W"),
+              std::string(IOQ_fake.trace.begin(), IOQ_fake.trace.end()));
+    ASSERT_EQ(IOQ_ACTIVE, request1.state);
+    ASSERT_EQ(IOQ_QUEUED, request2.state);
+
+    // Each completion interrupt starts the next transfer in place
+    IOQ_fakeComplete();
+    ASSERT_EQ(IOQ_DONE, request1.state);
+    ASSERT_EQ(IOQ_ACTIVE, request2.state);
+    ASSERT_EQ(std::string("WSW"),
+              std::string(IOQ_fake.trace.begin(), IOQ_fake.trace.end()));
+    IOQ_fakeComplete();
+    IOQ_fakeComplete();
+    ASSERT_EQ(std::string("WSWRPW"),
+              std::string(IOQ_fake.trace.begin(), IOQ_fake.trace.end()));
+    IOQ_fakeComplete();
+    ASSERT_FALSE(IOQ_isBusy(0));
+    ASSERT_EQ(IOQ_DONE, request3.state);
+
+    // Completion tasklets are posted in order
+    ASSERT_EQ(3u, IOQ_tasklets.size());
+    ASSERT_EQ((task_t)IOQ_done1, IOQ_tasklets[0]);
+    ASSERT_EQ((task_t)IOQ_done2, IOQ_tasklets[1]);
+    ASSERT_EQ((task_t)IOQ_done3, IOQ_tasklets[2]);
+
+    // Only the first transfer waited for the main loop
+    IOQ_Stats_t stats;
+    IOQ_getStats(0, &stats);
+    ASSERT_EQ(3u, stats.requests);
+    ASSERT_EQ(4u, stats.transfers);
+    ASSERT_EQ(3u, stats.chained);
+
+    // Done request can be submitted again
+    ASSERT_TRUE(IOQ_submit(0, &request1));
+    IOQ_fakeComplete();
+    ASSERT_EQ(IOQ_DONE, request1.state);
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              IoQueueTest.IOQ_errorAbortsRequest()
+// Description:
+//! \brief      Bus error skips the rest of request but releases chip select
+//------------------------------------------------------------------------------
+TEST_F(IoQueueTestFixture, IOQ_errorAbortsRequest)
+{
+    const uint8_t command = 0x80;
+    uint8_t data[2];
+    const IOQ_Op_t ops[] = {
+        {IOQ_SELECT, 4, 0, 0, NULL, NULL},
+        {IOQ_WRITE_READ, 0x10, 1, sizeof(data), &command, data},
+        {IOQ_WRITE, 0x10, 1, 0, &command, NULL},
+        {IOQ_RELEASE, 4, 0, 0, NULL, NULL}
+    };
+    IOQ_Request_t request1 = {ops, 4, IOQ_done1, IOQ_IDLE, NULL};
+    IOQ_Request_t request2 = {ops, 4, IOQ_done2, IOQ_IDLE, NULL};
+
+    ASSERT_TRUE(IOQ_init(0, &IOQ_fakeDriver));
+    ASSERT_TRUE(IOQ_submit(0, &request1));
+    ASSERT_TRUE(IOQ_submit(0, &request2));
+
+    // Write-then-read is not acknowledged
+    IOQ_fake.failNext = true;
+    IOQ_fakeComplete();
+    ASSERT_EQ(IOQ_ERROR, request1.state);
+    ASSERT_EQ(IOQ_ACTIVE, request2.state);
+
+    IOQ_fakeComplete();
+    IOQ_fakeComplete();
+    ASSERT_EQ(IOQ_DONE, request2.state);
+    ASSERT_EQ(std::string("SQPSQWP"),
+              std::string(IOQ_fake.trace.begin(), IOQ_fake.trace.end()));
+    ASSERT_EQ(2u, IOQ_tasklets.size());
+
+    IOQ_Stats_t stats;
+    IOQ_getStats(0, &stats);
+    ASSERT_EQ(1u, stats.requests);
+    ASSERT_EQ(1u, stats.errors);
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              IoQueueTest.IOQ_spiSensorScript()
+// Description:
+//! \brief      SPI requests with chip select on simulated (immediate) bus
+//------------------------------------------------------------------------------
+TEST_F(IoQueueTestFixture, IOQ_spiSensorScript)
+{
+    const IOQ_Driver_t driver = {
+        SPI0_ioqWrite, SPI0_ioqRead, NULL,
+        SPI0_ioqSelect, SPI0_ioqRelease, NULL
+    };
+    const uint8_t command = REGMAP_SPI_READ | 0x02;
+    const uint8_t write[] = {0x0F, 0x5A};
+    uint8_t data[3];
+    const IOQ_Op_t readOps[] = {
+        {IOQ_SELECT, SENSOR_CS_PIN, 0, 0, NULL, NULL},
+        {IOQ_WRITE_READ, 0, 1, sizeof(data), &command, data},
+        {IOQ_RELEASE, SENSOR_CS_PIN, 0, 0, NULL, NULL}
+    };
+    const IOQ_Op_t writeOps[] = {
+        {IOQ_SELECT, SENSOR_CS_PIN, 0, 0, NULL, NULL},
+        {IOQ_WRITE, 0, sizeof(write), 0, write, NULL},
+        {IOQ_RELEASE, SENSOR_CS_PIN, 0, 0, NULL, NULL}
+    };
+    IOQ_Request_t requests[64];
+
+    ASSERT_TRUE(IOQ_init(1, &driver));
+
+    // Transfers completed in place are chained without recursion
+    for(size_t index = 0; index < 64; index++)
+    {
+        IOQ_Request_t request = {(index & 1) ? writeOps : readOps, 3,
+                                 IOQ_done1, IOQ_IDLE, NULL};
+        requests[index] = request;
+        ASSERT_TRUE(IOQ_submit(1, &requests[index]));
+        ASSERT_EQ(IOQ_DONE, requests[index].state);
+    }
+    ASSERT_FALSE(IOQ_isBusy(1));
+    ASSERT_EQ(64u, IOQ_tasklets.size());
+    ASSERT_EQ(0x02, data[0]);
+    ASSERT_EQ(0x03, data[1]);
+    ASSERT_EQ(0x04, data[2]);
+    ASSERT_EQ(0x5A, regs[0x0F]);
+
+    IOQ_Stats_t stats;
+    IOQ_getStats(1, &stats);
+    ASSERT_EQ(64u, stats.requests);
+    ASSERT_EQ(32u*2 + 32u, stats.transfers);
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              IoQueueTest.IOQ_i2cDriver()
+// Description:
+//! \brief      I2C0 APIs as queue driver: NACK aborts only its request
+//------------------------------------------------------------------------------
+TEST_F(IoQueueTestFixture, IOQ_i2cDriver)
+{
+    const IOQ_Driver_t driver = {
+        I2C0_transmit, I2C0_receive, I2C0_request, NULL, NULL, I2C0_error
+    };
+    const uint8_t reg = 0x05;
+    uint8_t absent[2];
+    uint8_t data[3];
+    const IOQ_Op_t absentOps[] = {
+        {IOQ_READ, 0x42, 0, sizeof(absent), NULL, absent}
+    };
+    const IOQ_Op_t sensorOps[] = {
+        {IOQ_WRITE_READ, SENSOR_ADDRESS, 1, sizeof(data), &reg, data}
+    };
+    IOQ_Request_t request1 = {absentOps, 1, IOQ_done1, IOQ_IDLE, NULL};
+    IOQ_Request_t request2 = {sensorOps, 1, IOQ_done2, IOQ_IDLE, NULL};
+
+    ASSERT_TRUE(IOQ_init(0, &driver));
+    ASSERT_TRUE(IOQ_submit(0, &request1));
+    ASSERT_TRUE(IOQ_submit(0, &request2));
+    ASSERT_EQ(IOQ_ERROR, request1.state);
+    ASSERT_EQ(IOQ_DONE, request2.state);
+    ASSERT_EQ(0x05, data[0]);
+    ASSERT_EQ(0x06, data[1]);
+    ASSERT_EQ(0x07, data[2]);
+}
+
+//------------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+    // Initialize Google Test Framework
+    testing::InitGoogleTest(&argc, argv);
+    // Run all tests
+    return RUN_ALL_TESTS();
+}
+
+//******************************************************************************
+// End of file
+//******************************************************************************
@@ -0,0 +1,38 @@
+#*******************************************************************************
+#   Filename:       CrcTest.pro
+#
+#   Description:    Unit tests and benchmarks for CRC library
+#
+#   Author:         Bogdan Kokotenko
+#
+#   Revision date:  18/10/2026
+#
+#*******************************************************************************
+TEMPLATE = app
+CONFIG += console
+CONFIG -= app_bundle qt
+
+INCLUDEPATH +=  $$PWD/config \
+                $$PWD/../ \
+                $$PWD/../../common \
+                $$PWD/../../common/hal/mcu/mingw \
+                $$PWD/../../common/lib
+
+HEADERS +=  $$PWD/config/hal_config.h \
+            $$PWD/../../common/lib/crcmodel.h
+
+# Slicing-by-8 CRC kernels and PCLMULQDQ backend (host)
+DEFINES += CRC_SLICE_BY=8 USE_CRC_UNIT
+
+SOURCES +=  main.cpp \
+            $$PWD/../../common/lib/crc.c \
+            $$PWD/../../common/lib/crcmodel.c \
+            $$PWD/../../common/hal/mcu/mingw/crcunit.c
+
+# Google C++ Testing Framework
+DEFINES += UNIT_TEST
+include($$PWD/../../common/googletest/googletest.pri)
+
+#*******************************************************************************
+#   End of file
+#*******************************************************************************
@@ -0,0 +1,29 @@
+//******************************************************************************
+// Copyright (C) 2026 Bogdan Kokotenko
+//
+//! \addtogroup test03
+//! @{
+//! \defgroup   test03_config MinGW Configuration
+//! \brief      CRC tests configurations
+//! @{
+//******************************************************************************
+//   File description:
+//! \file  test03/config/hal_config.h
+//! \brief MinGW HAL configuration
+//!
+//!*****************************************************************************
+//! __Revisions:__
+//!  Date       | Author           | Comments
+//!  ---------- | ---------------- | ----------------
+//!  18/10/2026 | Bogdan Kokotenko | Initial draft
+//
+//******************************************************************************
+#ifndef HAL_CONFIG_H
+#define HAL_CONFIG_H
+
+//! @}
+//! @}
+#endif // HAL_CONFIG_H
+//******************************************************************************
+// End of file
+//******************************************************************************
@@ -0,0 +1,721 @@
+//******************************************************************************
+// Copyright (C) 2026 Bogdan Kokotenko
+//
+//! \defgroup test03 Test03
+//! \brief Unit tests and benchmarks for CRC library
+//! \details See \ref test03/main.cpp
+//******************************************************************************
+//   File description:
+//! \file               test03/main.cpp
+//! \brief              Contains unit tests implementation
+//!
+//! \details Benchmarks (CrcBenchmark) are disabled by default, they are run
+//!          by --gtest_also_run_disabled_tests and only print results.
+//!
+//!*****************************************************************************
+//! __Revisions:__
+//!  Date       | Author           | Comments
+//!  ---------- | ---------------- | ----------------
+//!  18/10/2026 | Bogdan Kokotenko | Initial draft
+//!  18/10/2026 | Bogdan Kokotenko | Benchmarks are opt-in
+//
+//******************************************************************************
+#include "project.h"
+#include "types.h"
+#include "crc.h"
+#include "crcmodel.h"
+
+#ifdef USE_CRC_UNIT
+#include "crcunit.h"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#if defined(__i386__) || defined(__x86_64__)
+#include <x86intrin.h>
+#endif
+
+#include <gtest/gtest.h>
+
+//! Standard check string
+static const char CRC_checkString[] = "123456789";
+
+//! Benchmark buffer size
+#define CRC_BENCH_SIZE      4096
+
+//! Benchmark repetitions
+#define CRC_BENCH_LOOPS     2000
+
+//------------------------------------------------------------------------------
+// Function:
+//              CRC_refReflect()
+// Description:
+//! \brief      Bit reflection (reference implementation)
+//------------------------------------------------------------------------------
+static uint32_t CRC_refReflect(uint32_t data, uint8_t nBits)
+{
+    uint32_t reflection = 0;
+
+    for(uint8_t bit = 0; bit < nBits; bit++)
+    {
+        if(data & 0x01)
+            reflection |= (1UL << ((nBits - 1) - bit));
+        data >>= 1;
+    }
+
+    return reflection;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              CRC_refCrc16()
+// Description:
+//! \brief      Bitwise MSB-first CRC16 (0x8005) with per-byte reflection,
+//!             as former crc16()/crc16ibm() implementation
+//------------------------------------------------------------------------------
+static uint16_t CRC_refCrc16(const void* data, uint32_t size, uint16_t initial)
+{
+    uint16_t remainder = initial;
+
+    for(uint32_t index = 0; index < size; index++)
+    {
+        remainder ^= (uint16_t)
+            (CRC_refReflect(((const uint8_t*)data)[index], 8) << 8);
+        for(uint8_t bit = 0; bit < 8; bit++)
+            remainder = (remainder & 0x8000) ?
+                (uint16_t)((remainder << 1) ^ 0x8005) :
+                (uint16_t)(remainder << 1);
+    }
+
+    return (uint16_t)CRC_refReflect(remainder, 16);
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              CRC_refCcitt()
+// Description:
+//! \brief      Bitwise MSB-first CRC16CCITT (reference implementation)
+//------------------------------------------------------------------------------
+static uint16_t CRC_refCcitt(const void* data, uint32_t size)
+{
+    uint16_t remainder = 0xFFFF;
+
+    for(uint32_t index = 0; index < size; index++)
+    {
+        remainder ^= (uint16_t)(((const uint8_t*)data)[index] << 8);
+        for(uint8_t bit = 0; bit < 8; bit++)
+            remainder = (remainder & 0x8000) ?
+                (uint16_t)((remainder << 1) ^ 0x1021) :
+                (uint16_t)(remainder << 1);
+    }
+
+    return remainder;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              CRC_refCrc32Raw()
+// Description:
+//! \brief      Bitwise reflected CRC32 remainder update (reference)
+//------------------------------------------------------------------------------
+static uint32_t CRC_refCrc32Raw(uint32_t remainder, const void* data,
+                                uint32_t size, uint32_t poly)
+{
+    for(uint32_t index = 0; index < size; index++)
+    {
+        remainder ^= ((const uint8_t*)data)[index];
+        for(uint8_t bit = 0; bit < 8; bit++)
+            remainder = (remainder & 1) ?
+                (remainder >> 1) ^ poly : (remainder >> 1);
+    }
+
+    return remainder;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              CRC_refCrc32()
+// Description:
+//! \brief      Bitwise reflected CRC32 (reference implementation)
+//------------------------------------------------------------------------------
+static uint32_t CRC_refCrc32(const void* data, uint32_t size, uint32_t poly)
+{
+    return ~CRC_refCrc32Raw(0xFFFFFFFF, data, size, poly);
+}
+
+//! Byte table of CRC32 (single lookup per byte reference)
+static uint32_t CRC_refCrc32Table[256];
+
+//------------------------------------------------------------------------------
+// Function:
+//              CRC_refCrc32Byte()
+// Description:
+//! \brief      Byte table CRC32 (reference for slicing benchmark)
+//------------------------------------------------------------------------------
+static uint32_t CRC_refCrc32Byte(const void* data, uint32_t size)
+{
+    const uint8_t* dataPtr = (const uint8_t*)data;
+    uint32_t remainder = 0xFFFFFFFF;
+
+    if(CRC_refCrc32Table[1] == 0)
+    {
+        for(uint32_t index = 0; index < 256; index++)
+        {
+            uint32_t entry = index;
+            for(uint8_t bit = 0; bit < 8; bit++)
+                entry = (entry & 1) ? (entry >> 1) ^ 0xEDB88320 : (entry >> 1);
+            CRC_refCrc32Table[index] = entry;
+        }
+    }
+
+    while(size--)
+        remainder = CRC_refCrc32Table[(uint8_t)remainder ^ *dataPtr++]
+                    ^ (remainder >> 8);
+
+    return ~remainder;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              CRC_refModel()
+// Description:
+//! \brief      Bitwise Rocksoft model CRC (reference implementation)
+//------------------------------------------------------------------------------
+static uint32_t CRC_refModel(uint8_t width, uint32_t poly, uint32_t init,
+                             bool refin, bool refout, uint32_t xorout,
+                             const void* data, uint32_t size)
+{
+    uint32_t top = 1UL << (width - 1);
+    uint32_t mask = 0xFFFFFFFFUL >> (32 - width);
+    uint32_t remainder = init;
+
+    for(uint32_t index = 0; index < size; index++)
+    {
+        uint8_t byte = ((const uint8_t*)data)[index];
+        if(refin)
+            byte = (uint8_t)CRC_refReflect(byte, 8);
+        for(uint8_t bit = 0x80; bit; bit >>= 1)
+        {
+            bool feedback = ((remainder & top) != 0) ^ ((byte & bit) != 0);
+            remainder = (remainder << 1) & mask;
+            if(feedback)
+                remainder ^= poly;
+        }
+    }
+
+    if(refout)
+        remainder = CRC_refReflect(remainder, width);
+    return remainder ^ xorout;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              CRC_benchTimer()
+// Description:
+//! \brief      Read benchmark time base (CPU cycles on x86, nsec otherwise)
+//------------------------------------------------------------------------------
+static uint64_t CRC_benchTimer(void)
+{
+#if defined(__i386__) || defined(__x86_64__)
+    return __rdtsc();
+#else
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec*1000000000ULL + now.tv_nsec;
+#endif
+}
+
+//! Benchmark buffer
+static uint8_t CRC_benchData[CRC_BENCH_SIZE];
+
+//! Benchmark result sink (keeps calls from being optimized out)
+static volatile uint32_t CRC_benchSink;
+
+//------------------------------------------------------------------------------
+// Function:
+//              CRC_benchmark()
+// Description:
+//! \brief      Measure time per byte of CRC function
+//------------------------------------------------------------------------------
+template<typename Function>
+static double CRC_benchmark(const char* name, Function function)
+{
+    uint64_t start = CRC_benchTimer();
+    for(int loop = 0; loop < CRC_BENCH_LOOPS; loop++)
+        CRC_benchSink += function(CRC_benchData, CRC_BENCH_SIZE);
+    double perByte = (double)(CRC_benchTimer() - start)/
+                     ((double)CRC_BENCH_LOOPS*CRC_BENCH_SIZE);
+
+#if defined(__i386__) || defined(__x86_64__)
+    printf("[ BENCH    ] %-16s %6.2f cycles/byte\n", name, perByte);
+#else
+    printf("[ BENCH    ] %-16s %6.2f ns/byte\n", name, perByte);
+#endif
+    return perByte;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              CrcTest.CRC16_checkValues()
+// Description:
+//! \brief      Check CRC of standard check string
+//------------------------------------------------------------------------------
+TEST(CrcTest, CRC16_checkValues)
+{
+    ASSERT_EQ(0xBB3D, crc16(CRC_checkString, 9));       // CRC16_CHECK_VALUE
+    ASSERT_EQ(0x4B37, crc16ibm(CRC_checkString, 9));    // CRC16IBM_CHECK_VALUE
+    ASSERT_EQ(0x29B1, crc16ccitt(CRC_checkString, 9));  // CRC16CCITT_CHECK_VALUE
+    ASSERT_EQ(0xA1, crc8(CRC_checkString, 9));          // CRC8_CHECK_VALUE
+    ASSERT_EQ(0xCBF43926u, crc32(CRC_checkString, 9));  // CRC32_CHECK_VALUE
+    ASSERT_EQ(0xE3069283u, crc32c(CRC_checkString, 9)); // CRC32C_CHECK_VALUE
+}
+
+//! Large (over 64 KB) buffer for streaming tests
+static uint8_t CRC_largeData[100000];
+
+//------------------------------------------------------------------------------
+// Function:
+//              CRC_streamTest()
+// Description:
+//! \brief      Check chunked calculation matches whole-buffer one
+//------------------------------------------------------------------------------
+template<typename T>
+static void CRC_streamTest(T (*init)(void),
+                           T (*update)(T, const void*, uint32_t),
+                           T (*final)(T),
+                           T (*whole)(const void*, uint32_t))
+{
+    const uint32_t chunks[] = {1, 7, 64, 1000, 4096};
+
+    for(uint32_t chunk : chunks)
+    {
+        T crc = init();
+        uint32_t offset;
+        for(offset = 0; offset < sizeof(CRC_largeData); offset += chunk)
+        {
+            uint32_t size = sizeof(CRC_largeData) - offset;
+            crc = update(crc, CRC_largeData + offset,
+                         size < chunk ? size : chunk);
+        }
+        ASSERT_EQ(whole(CRC_largeData, sizeof(CRC_largeData)), final(crc));
+    }
+
+    // Empty update keeps context
+    ASSERT_EQ(whole(CRC_checkString, 9),
+              final(update(update(init(), CRC_checkString, 9), NULL, 0)));
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              CrcTest.CRC_streamingMatchesWhole()
+// Description:
+//! \brief      Check streaming API of every CRC over buffer above 64 KB
+//------------------------------------------------------------------------------
+TEST(CrcTest, CRC_streamingMatchesWhole)
+{
+    srand(2);
+    for(uint32_t index = 0; index < sizeof(CRC_largeData); index++)
+        CRC_largeData[index] = (uint8_t)rand();
+
+    CRC_streamTest<uint16_t>(crc16_init, crc16_update, crc16_final, crc16);
+    CRC_streamTest<uint16_t>(crc16ibm_init, crc16ibm_update,
+                             crc16ibm_final, crc16ibm);
+    CRC_streamTest<uint16_t>(crc16ccitt_init, crc16ccitt_update,
+                             crc16ccitt_final, crc16ccitt);
+    CRC_streamTest<uint32_t>(crc32_init, crc32_update, crc32_final, crc32);
+    CRC_streamTest<uint32_t>(crc32c_init, crc32c_update, crc32c_final, crc32c);
+    CRC_streamTest<uint8_t>(crc8_init, crc8_update, crc8_final, crc8);
+
+    // Sizes above 64 KB are not truncated
+    ASSERT_NE(crc32(CRC_largeData, 65536 + 16), crc32(CRC_largeData, 16));
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              CrcTest.CRC16_matchReference()
+// Description:
+//! \brief      Check reflected tables against bitwise reference
+//------------------------------------------------------------------------------
+TEST(CrcTest, CRC16_matchReference)
+{
+    uint8_t data[300];
+
+    srand(1);
+    for(uint16_t index = 0; index < sizeof(data); index++)
+        data[index] = (uint8_t)rand();
+
+    for(uint16_t size = 0; size <= sizeof(data); size += 13)
+    {
+        ASSERT_EQ(CRC_refCrc16(data, size, 0x0000), crc16(data, size));
+        ASSERT_EQ(CRC_refCrc16(data, size, 0xFFFF), crc16ibm(data, size));
+    }
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              CrcTest.CRC_slicingMatchesReference()
+// Description:
+//! \brief      Check sliced kernels against bitwise reference on any length
+//!             and alignment
+//------------------------------------------------------------------------------
+TEST(CrcTest, CRC_slicingMatchesReference)
+{
+    uint8_t data[256 + 8];
+
+    srand(3);
+    for(uint16_t index = 0; index < sizeof(data); index++)
+        data[index] = (uint8_t)rand();
+
+    for(uint16_t offset = 0; offset < 8; offset++)
+    {
+        for(uint16_t size = 0; size <= 256; size++)
+        {
+            ASSERT_EQ(CRC_refCcitt(data + offset, size),
+                      crc16ccitt(data + offset, size));
+            ASSERT_EQ(CRC_refCrc32(data + offset, size, 0xEDB88320),
+                      crc32(data + offset, size));
+            ASSERT_EQ(CRC_refCrc32(data + offset, size, 0x82F63B78),
+                      crc32c(data + offset, size));
+        }
+    }
+}
+
+#ifdef USE_CRC_UNIT
+//------------------------------------------------------------------------------
+// Function:
+//              CrcTest.CRCUNIT_matchesReference()
+// Description:
+//! \brief      Cross-check CRC unit backend against bitwise reference
+//------------------------------------------------------------------------------
+TEST(CrcTest, CRCUNIT_matchesReference)
+{
+    static uint8_t data[4096 + 8];
+
+    srand(4);
+    for(uint32_t index = 0; index < sizeof(data); index++)
+        data[index] = (uint8_t)rand();
+
+    for(uint32_t size = 0; size <= 4096; size += (size < 256) ? 1 : 61)
+    {
+        // Part processed by unit continues with reference to the same result
+        uint32_t crc = 0x12345678;
+        uint32_t done = CRCUNIT_crc32(&crc, data + 3, size);
+        ASSERT_EQ(0u, done % CRCUNIT_ALIGN);
+        ASSERT_LE(done, size);
+        ASSERT_EQ(CRC_refCrc32Raw(0x12345678, data + 3, size, 0xEDB88320),
+                  CRC_refCrc32Raw(crc, data + 3 + done, size - done,
+                                  0xEDB88320));
+#if defined(__i386__) || defined(__x86_64__)
+        if(size >= CRCUNIT_MIN_SIZE && __builtin_cpu_supports("pclmul"))
+        {
+            ASSERT_LT(size - done, 16u);
+        }
+#endif
+
+        crc = 0x9ABCDEF0;
+        done = CRCUNIT_crc32c(&crc, data + 5, size);
+        ASSERT_EQ(CRC_refCrc32Raw(0x9ABCDEF0, data + 5, size, 0x82F63B78),
+                  CRC_refCrc32Raw(crc, data + 5 + done, size - done,
+                                  0x82F63B78));
+    }
+}
+#endif // USE_CRC_UNIT
+
+//------------------------------------------------------------------------------
+// Function:
+//              CrcBenchmark.DISABLED_CRC16_cyclesPerByte()
+// Description:
+//! \brief      Compare reflected table with per-byte reflection
+//------------------------------------------------------------------------------
+TEST(CrcBenchmark, DISABLED_CRC16_cyclesPerByte)
+{
+    for(uint16_t index = 0; index < CRC_BENCH_SIZE; index++)
+        CRC_benchData[index] = (uint8_t)(index*7 + 3);
+
+    CRC_benchmark("bitwise+reflect",
+        [](const void* data, uint32_t size)
+            { return CRC_refCrc16(data, size, 0x0000); });
+    CRC_benchmark("crc16", crc16);
+    CRC_benchmark("crc16ibm", crc16ibm);
+    CRC_benchmark("crc16ccitt", crc16ccitt);
+    CRC_benchmark("crc32", crc32);
+    CRC_benchmark("crc32c", crc32c);
+}
+
+//! Test models parameters (CRC catalogue)
+struct CRC_TestModel_t{
+    const char*         name;
+    const CRC_Model_t*  split;
+    const CRC_Model_t*  nibble;
+    uint32_t            poly;
+};
+
+// Test models tables, both kinds
+static const uint16_t CRC_riello16SplitTable[32] = { CRC_SPLIT_TABLE_REF(0x8408) };
+static const uint16_t CRC_riello16NibbleTable[16] = { CRC_NIBBLE_TABLE_REF(0x8408) };
+static const uint16_t CRC_umts12SplitTable[32] = { CRC_SPLIT_TABLE_MSB(12, 0x80F) };
+static const uint16_t CRC_umts12NibbleTable[16] = { CRC_NIBBLE_TABLE_MSB(12, 0x80F) };
+static const uint32_t CRC_openpgp24SplitTable[32] =
+    { CRC_SPLIT_TABLE_MSB(24, 0x864CFB) };
+static const uint32_t CRC_openpgp24NibbleTable[16] =
+    { CRC_NIBBLE_TABLE_MSB(24, 0x864CFB) };
+static const uint8_t CRC_smbus8SplitTable[32] = { CRC_SPLIT_TABLE_MSB(8, 0x07) };
+static const uint8_t CRC_smbus8NibbleTable[16] = { CRC_NIBBLE_TABLE_MSB(8, 0x07) };
+static const uint8_t CRC_maxim8SplitTable[32] = { CRC_SPLIT_TABLE_REF(0x8C) };
+static const uint8_t CRC_maxim8NibbleTable[16] = { CRC_NIBBLE_TABLE_REF(0x8C) };
+static const uint32_t CRC_hdlc32SplitTable[32] = { CRC_SPLIT_TABLE_REF(0xEDB88320) };
+static const uint32_t CRC_hdlc32NibbleTable[16] = { CRC_NIBBLE_TABLE_REF(0xEDB88320) };
+static const uint32_t CRC_mpeg32SplitTable[32] =
+    { CRC_SPLIT_TABLE_MSB(32, 0x04C11DB7) };
+static const uint32_t CRC_mpeg32NibbleTable[16] =
+    { CRC_NIBBLE_TABLE_MSB(32, 0x04C11DB7) };
+
+// Test models: CRC-16/RIELLO (reflected init), CRC-12/UMTS (refin != refout),
+// CRC-24/OPENPGP, CRC-8/SMBUS, CRC-8/MAXIM-DOW, CRC-32/ISO-HDLC, CRC-32/MPEG-2
+#define CRC_TEST_MODEL(name, w, ri, ro, init, xo, check)                       \
+    static const CRC_Model_t name##Split = { w, ri, ro, CRC_TABLE_SPLIT,       \
+        init, xo, check, name##SplitTable };                                   \
+    static const CRC_Model_t name##Nibble = { w, ri, ro, CRC_TABLE_NIBBLE,     \
+        init, xo, check, name##NibbleTable };
+CRC_TEST_MODEL(CRC_riello16, 16, true, true, 0xB2AA, 0, 0x63D0)
+CRC_TEST_MODEL(CRC_umts12, 12, false, true, 0, 0, 0xDAF)
+CRC_TEST_MODEL(CRC_openpgp24, 24, false, false, 0xB704CE, 0, 0x21CF02)
+CRC_TEST_MODEL(CRC_smbus8, 8, false, false, 0, 0, 0xF4)
+CRC_TEST_MODEL(CRC_maxim8, 8, true, true, 0, 0, 0xA1)
+CRC_TEST_MODEL(CRC_hdlc32, 32, true, true, 0xFFFFFFFF, 0xFFFFFFFF,
+               0xCBF43926)
+CRC_TEST_MODEL(CRC_mpeg32, 32, false, false, 0xFFFFFFFF, 0, 0x0376E6E7)
+
+//! Test models list
+static const CRC_TestModel_t CRC_testModels[] = {
+    { "CRC-16/RIELLO",    &CRC_riello16Split,  &CRC_riello16Nibble,  0x1021 },
+    { "CRC-12/UMTS",      &CRC_umts12Split,    &CRC_umts12Nibble,    0x80F },
+    { "CRC-24/OPENPGP",   &CRC_openpgp24Split, &CRC_openpgp24Nibble, 0x864CFB },
+    { "CRC-8/SMBUS",      &CRC_smbus8Split,    &CRC_smbus8Nibble,    0x07 },
+    { "CRC-8/MAXIM-DOW",  &CRC_maxim8Split,    &CRC_maxim8Nibble,    0x31 },
+    { "CRC-32/ISO-HDLC",  &CRC_hdlc32Split,    &CRC_hdlc32Nibble,    0x04C11DB7 },
+    { "CRC-32/MPEG-2",    &CRC_mpeg32Split,    &CRC_mpeg32Nibble,    0x04C11DB7 },
+};
+
+//------------------------------------------------------------------------------
+// Function:
+//              CrcTest.CRCMODEL_checkValues()
+// Description:
+//! \brief      Check predefined and test models (both table kinds)
+//------------------------------------------------------------------------------
+TEST(CrcTest, CRCMODEL_checkValues)
+{
+    const CRC_Model_t* models[] = { &crc16modbusModel, &crc16arcModel,
+        &crc16xmodemModel, &crc16kermitModel, &crc16ibm3740Model,
+        &crc8smbusModel, &crc8maximModel, &crc32hdlcModel, &crc32mpeg2Model };
+
+    for(const CRC_Model_t* model : models)
+        ASSERT_EQ(model->check, crcModel(model, CRC_checkString, 9));
+
+    for(const CRC_TestModel_t& test : CRC_testModels)
+    {
+        EXPECT_EQ(test.split->check, crcModel(test.split, CRC_checkString, 9))
+            << test.name;
+        EXPECT_EQ(test.nibble->check, crcModel(test.nibble, CRC_checkString, 9))
+            << test.name;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              CrcTest.CRCMODEL_matchesReference()
+// Description:
+//! \brief      Check models against bitwise reference and crc.c, streaming
+//------------------------------------------------------------------------------
+TEST(CrcTest, CRCMODEL_matchesReference)
+{
+    uint8_t data[300];
+
+    srand(3);
+    for(uint16_t index = 0; index < sizeof(data); index++)
+        data[index] = (uint8_t)rand();
+
+    for(const CRC_TestModel_t& test : CRC_testModels)
+    {
+        const CRC_Model_t* model = test.split;
+        uint32_t reference = CRC_refModel(model->width, test.poly, model->init,
+            model->refin, model->refout, model->xorout, data, sizeof(data));
+
+        EXPECT_EQ(reference, crcModel(test.split, data, sizeof(data)))
+            << test.name;
+        EXPECT_EQ(reference, crcModel(test.nibble, data, sizeof(data)))
+            << test.name;
+
+        // Streaming by odd chunks
+        uint32_t crc = crcModel_init(test.nibble);
+        for(uint16_t offset = 0; offset < sizeof(data); offset += 37)
+            crc = crcModel_update(test.nibble, crc, data + offset,
+                (sizeof(data) - offset < 37) ? sizeof(data) - offset : 37);
+        EXPECT_EQ(reference, crcModel_final(test.nibble, crc)) << test.name;
+    }
+
+    for(uint16_t size = 0; size <= sizeof(data); size += 13)
+    {
+        ASSERT_EQ(crc16ibm(data, size), crcModel(&crc16modbusModel, data, size));
+        ASSERT_EQ(crc16(data, size), crcModel(&crc16arcModel, data, size));
+        ASSERT_EQ(crc16ccitt(data, size),
+                  crcModel(&crc16ibm3740Model, data, size));
+        ASSERT_EQ(crc8(data, size), crcModel(&crc8maximModel, data, size));
+        ASSERT_EQ(crc32(data, size), crcModel(&crc32hdlcModel, data, size));
+    }
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              CrcBenchmark.DISABLED_CRCMODEL_speedVsFootprint()
+// Description:
+//! \brief      Compare split and nibble tables with 256-entry table
+//------------------------------------------------------------------------------
+TEST(CrcBenchmark, DISABLED_CRCMODEL_speedVsFootprint)
+{
+    for(uint16_t index = 0; index < CRC_BENCH_SIZE; index++)
+        CRC_benchData[index] = (uint8_t)(index*7 + 3);
+
+    printf("[ BENCH    ] CRC16 tables: 512 B (crc16), "
+           "64 B (split), 32 B (nibble)\n");
+    CRC_benchmark("crc16", crc16);
+    CRC_benchmark("model split",
+        [](const void* data, uint32_t size)
+            { return crcModel(&CRC_riello16Split, data, size); });
+    CRC_benchmark("model nibble",
+        [](const void* data, uint32_t size)
+            { return crcModel(&CRC_riello16Nibble, data, size); });
+    CRC_benchmark("model split32",
+        [](const void* data, uint32_t size)
+            { return crcModel(&CRC_mpeg32Split, data, size); });
+    CRC_benchmark("model nibble32",
+        [](const void* data, uint32_t size)
+            { return crcModel(&CRC_mpeg32Nibble, data, size); });
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              CrcTest.CRC8_matchesReference()
+// Description:
+//! \brief      Check CRC8 (1-Wire) against bitwise reference and ROM code
+//------------------------------------------------------------------------------
+TEST(CrcTest, CRC8_matchesReference)
+{
+    // 1-Wire ROM code: family 0x02, serial 0x000000001B81C, CRC 0xA2
+    static const uint8_t romCode[8] =
+        { 0x02, 0x1C, 0xB8, 0x01, 0x00, 0x00, 0x00, 0xA2 };
+    uint8_t data[300];
+
+    ASSERT_EQ(0xA2, crc8(romCode, 7));
+    ASSERT_EQ(0x00, crc8(romCode, 8));
+
+    srand(5);
+    for(uint16_t index = 0; index < sizeof(data); index++)
+        data[index] = (uint8_t)rand();
+
+    for(uint16_t size = 0; size <= sizeof(data); size += 7)
+        ASSERT_EQ(CRC_refModel(8, 0x31, 0, true, true, 0, data, size),
+                  crc8(data, size));
+
+    // Scratchpad-sized streaming chunks
+    uint8_t crc = crc8_init();
+    for(uint16_t offset = 0; offset < sizeof(data); offset += 9)
+        crc = crc8_update(crc, data + offset,
+            (sizeof(data) - offset < 9) ? sizeof(data) - offset : 9);
+    ASSERT_EQ(crc8(data, sizeof(data)), crc8_final(crc));
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              CrcBenchmark.DISABLED_CRC8_cyclesPerByte()
+// Description:
+//! \brief      Compare CRC8 (1-Wire) variant with bitwise implementation
+//------------------------------------------------------------------------------
+TEST(CrcBenchmark, DISABLED_CRC8_cyclesPerByte)
+{
+    for(uint16_t index = 0; index < CRC_BENCH_SIZE; index++)
+        CRC_benchData[index] = (uint8_t)(index*7 + 3);
+
+    printf("[ BENCH    ] CRC8_TABLE_SIZE = %d\n", CRC8_TABLE_SIZE);
+    CRC_benchmark("bitwise",
+        [](const void* data, uint32_t size)
+        {
+            const uint8_t* dataPtr = (const uint8_t*)data;
+            uint8_t crc = 0;
+            while(size--)
+            {
+                crc ^= *dataPtr++;
+                for(uint8_t bit = 0; bit < 8; bit++)
+                    crc = (crc & 1) ? (crc >> 1) ^ 0x8C : (crc >> 1);
+            }
+            return crc;
+        });
+    CRC_benchmark("crc8", crc8);
+}
+
+//! Large benchmark buffer (64 KB)
+static uint8_t CRC_benchLarge[65536];
+
+//------------------------------------------------------------------------------
+// Function:
+//              CrcBenchmark.DISABLED_CRC_throughput()
+// Description:
+//! \brief      Compare CRC kernels/backends with byte table over buffer sizes
+//------------------------------------------------------------------------------
+TEST(CrcBenchmark, DISABLED_CRC_throughput)
+{
+    for(uint32_t index = 0; index < sizeof(CRC_benchLarge); index++)
+        CRC_benchLarge[index] = (uint8_t)(index*13 + 5);
+
+#ifdef USE_CRC_UNIT
+    printf("[ BENCH    ] CRC_SLICE_BY = %d, CRC32/CRC32C by CRC unit\n",
+           CRC_SLICE_BY);
+#else
+    printf("[ BENCH    ] CRC_SLICE_BY = %d\n", CRC_SLICE_BY);
+#endif
+    for(uint32_t size = 16; size <= sizeof(CRC_benchLarge); size *= 4)
+    {
+        uint32_t loops = 4*1024*1024/size;
+        double perByte[4];
+        uint64_t start;
+
+        start = CRC_benchTimer();
+        for(uint32_t loop = 0; loop < loops; loop++)
+            CRC_benchSink += CRC_refCrc32Byte(CRC_benchLarge, size);
+        perByte[0] = (double)(CRC_benchTimer() - start)/((double)loops*size);
+
+        start = CRC_benchTimer();
+        for(uint32_t loop = 0; loop < loops; loop++)
+            CRC_benchSink += crc32(CRC_benchLarge, size);
+        perByte[1] = (double)(CRC_benchTimer() - start)/((double)loops*size);
+
+        start = CRC_benchTimer();
+        for(uint32_t loop = 0; loop < loops; loop++)
+            CRC_benchSink += crc32c(CRC_benchLarge, size);
+        perByte[2] = (double)(CRC_benchTimer() - start)/((double)loops*size);
+
+        start = CRC_benchTimer();
+        for(uint32_t loop = 0; loop < loops; loop++)
+            CRC_benchSink += crc16ccitt(CRC_benchLarge, size);
+        perByte[3] = (double)(CRC_benchTimer() - start)/((double)loops*size);
+
+        printf("[ BENCH    ] %6u B: byte table %5.2f, crc32 %5.2f, "
+               "crc32c %5.2f, crc16ccitt %5.2f per byte\n",
+               size, perByte[0], perByte[1], perByte[2], perByte[3]);
+    }
+}
+
+//------------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+    // Initialize Google Test Framework
+    testing::InitGoogleTest(&argc, argv);
+    // Run all tests
+    return RUN_ALL_TESTS();
+}
+
+//******************************************************************************
+// End of file
+//******************************************************************************
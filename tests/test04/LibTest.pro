@@ -0,0 +1,43 @@
+#*******************************************************************************
+#   Filename:       LibTest.pro
+#
+#   Description:    Unit tests and benchmarks for algorithm library
+#
+#   Author:         Bogdan Kokotenko
+#
+#   Revision date:  18/10/2026
+#
+#*******************************************************************************
+TEMPLATE = app
+CONFIG += console
+CONFIG -= app_bundle qt
+
+INCLUDEPATH +=  $$PWD/../ \
+                $$PWD/../../common \
+                $$PWD/../../common/lib
+
+HEADERS +=  $$PWD/../../common/lib/ring.h \
+            $$PWD/../../common/lib/filter.h \
+            $$PWD/../../common/lib/stats.h \
+            $$PWD/../../common/lib/dsp.h \
+            $$PWD/../../common/lib/fft.h \
+            $$PWD/../../common/lib/decimate.h \
+            $$PWD/../../common/lib/qmath.h \
+            $$PWD/../../common/lib/byteorder.h \
+            $$PWD/../../common/lib/macro.h
+
+SOURCES +=  main.cpp \
+            $$PWD/../../common/lib/ring.c \
+            $$PWD/../../common/lib/filter.c \
+            $$PWD/../../common/lib/stats.c \
+            $$PWD/../../common/lib/dsp.c \
+            $$PWD/../../common/lib/fft.c \
+            $$PWD/../../common/lib/decimate.c
+
+# Google C++ Testing Framework
+DEFINES += UNIT_TEST
+include($$PWD/../../common/googletest/googletest.pri)
+
+#*******************************************************************************
+#   End of file
+#*******************************************************************************
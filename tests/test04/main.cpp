@@ -0,0 +1,1878 @@
+//******************************************************************************
+// Copyright (C) 2026 Bogdan Kokotenko
+//
+//! \defgroup test04 Test04
+//! \brief Unit tests and benchmarks for algorithm library
+//! \details See \ref test04/main.cpp
+//******************************************************************************
+//   File description:
+//! \file               test04/main.cpp
+//! \brief              Contains unit tests implementation
+//!
+//! \details Benchmarks (*Benchmark suites) are disabled by default, they are
+//!          run by --gtest_also_run_disabled_tests and only print results.
+//!
+//!*****************************************************************************
+//! __Revisions:__
+//!  Date       | Author           | Comments
+//!  ---------- | ---------------- | ----------------
+//!  18/10/2026 | Bogdan Kokotenko | Initial draft
+//!  18/10/2026 | Bogdan Kokotenko | Benchmarks are opt-in
+//
+//******************************************************************************
+#include "project.h"
+#include "types.h"
+#include "dsp.h"
+#include "ring.h"
+#include "filter.h"
+#include "stats.h"
+#include "fft.h"
+#include "decimate.h"
+#include "qmath.h"
+#include "byteorder.h"
+#include "macro.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include <thread>
+#include <algorithm>
+
+#include <gtest/gtest.h>
+
+//------------------------------------------------------------------------------
+// Function:
+//              LIB_benchTimer()
+// Description:
+//! \brief      Read benchmark time base (nsec)
+//------------------------------------------------------------------------------
+static uint64_t LIB_benchTimer(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec*1000000000ULL + now.tv_nsec;
+}
+
+//! Benchmark result sink (keeps calls from being optimized out)
+static volatile uint32_t LIB_benchSink;
+
+//------------------------------------------------------------------------------
+// Function:
+//              RingTest.RING_initChecksLength()
+// Description:
+//! \brief      Only power-of-two lengths up to half of index range
+//------------------------------------------------------------------------------
+TEST(RingTest, RING_initChecksLength)
+{
+    static uint8_t storage[64];
+    RING_Buffer_t ring;
+
+    ASSERT_TRUE(RING_init(ring, storage));
+    ASSERT_EQ(0, ring_count(&ring));
+    ASSERT_EQ(64, ring_space(&ring));
+
+    ASSERT_FALSE(ring_init(&ring, storage, 0, 1));
+    ASSERT_FALSE(ring_init(&ring, storage, 48, 1));
+    ASSERT_TRUE(ring_init(&ring, storage, 1, 1));
+    ASSERT_TRUE(ring_init(&ring, NULL, 0x8000, 1));
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              RingTest.RING_pushPopWrap()
+// Description:
+//! \brief      Single items through storage end and index overflow
+//------------------------------------------------------------------------------
+TEST(RingTest, RING_pushPopWrap)
+{
+    static uint8_t storage[8];
+    RING_Buffer_t ring;
+    uint8_t value = 0;
+    uint8_t expected = 0;
+
+    RING_init(ring, storage);
+    // Start near the index overflow
+    ring.head = ring.tail = (RING_INDEX_t)(0 - 20);
+
+    for(int loop = 0; loop < 50; loop++)
+    {
+        for(int item = 0; item < 5; item++, value++)
+            ASSERT_TRUE(ring_push(&ring, &value));
+        ASSERT_EQ(5, ring_count(&ring));
+        for(int item = 0; item < 5; item++, expected++)
+        {
+            uint8_t read;
+            ASSERT_TRUE(ring_pop(&ring, &read));
+            ASSERT_EQ(expected, read);
+        }
+        ASSERT_FALSE(ring_pop(&ring, &value));
+    }
+
+    // Full ring rejects items
+    for(int item = 0; item < 8; item++)
+        ASSERT_TRUE(ring_push(&ring, &value));
+    ASSERT_FALSE(ring_push(&ring, &value));
+    ASSERT_EQ(0, ring_space(&ring));
+    ring_flush(&ring);
+    ASSERT_EQ(0, ring_count(&ring));
+}
+
+//! Structure items (e.g. log records)
+struct RING_TestRecord_t{
+    uint32_t    timestamp;
+    uint16_t    code;
+    uint8_t     level;
+};
+
+//------------------------------------------------------------------------------
+// Function:
+//              RingTest.RING_bulkStructures()
+// Description:
+//! \brief      Bulk write/read of structures, split by storage end
+//------------------------------------------------------------------------------
+TEST(RingTest, RING_bulkStructures)
+{
+    static RING_TestRecord_t storage[16];
+    RING_TestRecord_t records[40];
+    RING_TestRecord_t read[40];
+    RING_Buffer_t ring;
+    uint32_t written = 0;
+    uint32_t checked = 0;
+
+    RING_init(ring, storage);
+    for(uint16_t index = 0; index < 40; index++)
+    {
+        records[index].timestamp = index*1000;
+        records[index].code = index % 20;
+        records[index].level = (uint8_t)(index & 0x03);
+    }
+
+    // Chunks of varying size wrap storage at any offset
+    srand(7);
+    while(checked < 400)
+    {
+        RING_INDEX_t count = (RING_INDEX_t)(rand() % 12);
+        count = ring_write(&ring, &records[written % 20], count);
+        written += count;
+
+        count = ring_read(&ring, read, (RING_INDEX_t)(rand() % 12));
+        for(RING_INDEX_t index = 0; index < count; index++, checked++)
+            ASSERT_EQ(checked % 20 + 0u, read[index].code);
+        ASSERT_LE(ring_count(&ring), 16);
+    }
+
+    // Write is limited by free space
+    ring_flush(&ring);
+    ASSERT_EQ(16, ring_write(&ring, records, 40));
+    ASSERT_EQ(16, ring_read(&ring, read, 40));
+    ASSERT_EQ(0, memcmp(records, read, 16*sizeof(RING_TestRecord_t)));
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              RingTest.RING_peekCommit()
+// Description:
+//! \brief      Zero-copy spans end at storage end
+//------------------------------------------------------------------------------
+TEST(RingTest, RING_peekCommit)
+{
+    static uint8_t storage[16];
+    RING_Buffer_t ring;
+    void* writeSpan;
+    const void* readSpan;
+
+    RING_init(ring, storage);
+    ring.head = ring.tail = 10;
+
+    // Producer fills contiguous span (e.g. DMA block)
+    ASSERT_EQ(6, ring_peekWrite(&ring, &writeSpan));
+    ASSERT_EQ(&storage[10], writeSpan);
+    memset(writeSpan, 0x11, 6);
+    ring_commitWrite(&ring, 6);
+
+    ASSERT_EQ(10, ring_peekWrite(&ring, &writeSpan));
+    ASSERT_EQ(&storage[0], writeSpan);
+    memset(writeSpan, 0x22, 4);
+    ring_commitWrite(&ring, 4);
+    ASSERT_EQ(10, ring_count(&ring));
+
+    // Consumer parses in place
+    ASSERT_EQ(6, ring_peekRead(&ring, &readSpan));
+    ASSERT_EQ(&storage[10], readSpan);
+    ASSERT_EQ(0x11, ((const uint8_t*)readSpan)[5]);
+    ring_commitRead(&ring, 6);
+
+    ASSERT_EQ(4, ring_peekRead(&ring, &readSpan));
+    ASSERT_EQ(0x22, ((const uint8_t*)readSpan)[0]);
+    ring_commitRead(&ring, 4);
+    ASSERT_EQ(0, ring_peekRead(&ring, &readSpan));
+}
+
+//! Items passed through SPSC ring by threads
+#define RING_SPSC_ITEMS     (4*1024*1024)
+
+//------------------------------------------------------------------------------
+// Function:
+//              RING_spscTransfer()
+// Description:
+//! \brief      Pass sequence through ring by producer and consumer threads
+//! \return     number of sequence errors
+//------------------------------------------------------------------------------
+static uint32_t RING_spscTransfer(RING_Buffer_t* ring, RING_INDEX_t chunk)
+{
+    uint32_t errors = 0;
+
+    std::thread producer([ring, chunk]()
+    {
+        uint32_t block[64];
+        uint32_t next = 0;
+        while(next < RING_SPSC_ITEMS)
+        {
+            RING_INDEX_t count = chunk;
+            for(RING_INDEX_t index = 0; index < count; index++)
+                block[index] = next + index;
+            if(chunk == 1)
+                count = ring_push(ring, block) ? 1 : 0;
+            else
+                count = ring_write(ring, block, count);
+            if(count == 0)
+                std::this_thread::yield();
+            next += count;
+        }
+    });
+
+    uint32_t block[64];
+    uint32_t expected = 0;
+    while(expected < RING_SPSC_ITEMS)
+    {
+        RING_INDEX_t count;
+        if(chunk == 1)
+            count = ring_pop(ring, block) ? 1 : 0;
+        else
+            count = ring_read(ring, block, chunk);
+        if(count == 0)
+            std::this_thread::yield();
+        for(RING_INDEX_t index = 0; index < count; index++, expected++)
+            if(block[index] != expected)
+                errors++;
+    }
+
+    producer.join();
+    return errors;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              RingTest.RING_spscThreads()
+// Description:
+//! \brief      Lock-free transfer between producer and consumer threads
+//------------------------------------------------------------------------------
+TEST(RingTest, RING_spscThreads)
+{
+    static uint32_t storage[256];
+    RING_Buffer_t ring;
+
+    RING_init(ring, storage);
+    ASSERT_EQ(0u, RING_spscTransfer(&ring, 1));
+    ASSERT_EQ(0u, RING_spscTransfer(&ring, 37));
+    ASSERT_EQ(0, ring_count(&ring));
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              RingBenchmark.DISABLED_RING_throughput()
+// Description:
+//! \brief      Compare CircularBuffer, single-item and bulk ring access
+//------------------------------------------------------------------------------
+TEST(RingBenchmark, DISABLED_RING_throughput)
+{
+    static uint8_t storage[256];
+    static CircularBufferS8(256) circular;
+    static uint8_t block[64];
+    const uint32_t bytes = 64*1024*1024;
+    RING_Buffer_t ring;
+    uint32_t errors = 0;
+    uint32_t total = 0;
+    uint64_t start;
+    double ns[3];
+
+    // CircularBuffer: append with compare-and-reset, read back by index
+    start = LIB_benchTimer();
+    for(uint32_t count = 0; count < bytes; count++)
+    {
+        CircularBuffer_append(circular, (int8_t)count);
+        LIB_benchSink += circular.buff[circular.index];
+    }
+    ns[0] = (double)(LIB_benchTimer() - start)/bytes;
+
+    // Single byte push/pop
+    RING_init(ring, storage);
+    start = LIB_benchTimer();
+    for(uint32_t count = 0; count < bytes; count++)
+    {
+        uint8_t value = (uint8_t)count;
+        ring_push(&ring, &value);
+        if(!ring_pop(&ring, &value) || value != (uint8_t)count)
+            errors++;
+        LIB_benchSink += value;
+    }
+    ns[1] = (double)(LIB_benchTimer() - start)/bytes;
+    EXPECT_EQ(0u, errors);
+
+    // Bulk write/read by 64 bytes
+    start = LIB_benchTimer();
+    for(uint32_t count = 0; count < bytes; count += sizeof(block))
+    {
+        ring_write(&ring, block, sizeof(block));
+        total += ring_read(&ring, block, sizeof(block));
+    }
+    ns[2] = (double)(LIB_benchTimer() - start)/bytes;
+    LIB_benchSink += total;
+    EXPECT_EQ(bytes, total);
+
+    printf("[ BENCH    ] CircularBuffer %5.2f, push/pop %5.2f, "
+           "bulk(64) %5.2f ns/byte\n", ns[0], ns[1], ns[2]);
+
+    // SPSC threads
+    static uint32_t words[1024];
+    RING_init(ring, words);
+    start = LIB_benchTimer();
+    EXPECT_EQ(0u, RING_spscTransfer(&ring, 1));
+    ns[0] = (double)(LIB_benchTimer() - start)/RING_SPSC_ITEMS;
+    start = LIB_benchTimer();
+    EXPECT_EQ(0u, RING_spscTransfer(&ring, 64));
+    ns[1] = (double)(LIB_benchTimer() - start)/RING_SPSC_ITEMS;
+    printf("[ BENCH    ] SPSC threads: push/pop %5.2f, bulk(64) %5.2f "
+           "ns/item (%.0f MB/s)\n", ns[0], ns[1], 4000.0/ns[1]);
+    EXPECT_EQ(0, ring_count(&ring));
+}
+
+//! Filter test signal length
+#define FILTER_TEST_SIZE    240
+
+//------------------------------------------------------------------------------
+// Function:
+//              FILTER_testSignal()
+// Description:
+//! \brief      Two tones and noise, amplitude below 0.9 of full scale
+//------------------------------------------------------------------------------
+static double FILTER_testSignal(uint32_t index)
+{
+    return 0.4*sin(2*M_PI*index*20/1000.0) +
+           0.3*sin(2*M_PI*index*300/1000.0) +
+           0.15*((double)(rand() % 2001) - 1000)/1000;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              FILTER_biquadLowpass()
+// Description:
+//! \brief      RBJ lowpass biquad coefficients {b0, b1, b2, -a1, -a2}
+//------------------------------------------------------------------------------
+static void FILTER_biquadLowpass(double fc, double fs, double q,
+                                 double coeffs[5])
+{
+    double w0 = 2*M_PI*fc/fs;
+    double alpha = sin(w0)/(2*q);
+    double a0 = 1 + alpha;
+
+    coeffs[0] = (1 - cos(w0))/2/a0;
+    coeffs[1] = (1 - cos(w0))/a0;
+    coeffs[2] = coeffs[0];
+    coeffs[3] = 2*cos(w0)/a0;
+    coeffs[4] = -(1 - alpha)/a0;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              FilterTest.FIR_impulseResponse()
+// Description:
+//! \brief      Impulse response is coefficients in time order
+//------------------------------------------------------------------------------
+TEST(FilterTest, FIR_impulseResponse)
+{
+    static const q15_t taps[8] =
+        { 1000, -2000, 3000, 16000, 16000, 3000, -2000, 1000 };
+    q15_t coeffs[8];
+    q15_t state[FIR_STATE_SIZE(8, 16)];
+    q15_t signal[16] = { INT16_MAX };
+    FIR_Q15_t fir;
+
+    // Time-reversed order
+    for(int tap = 0; tap < 8; tap++)
+        coeffs[tap] = taps[7 - tap];
+
+    ASSERT_FALSE(fir_q15_init(&fir, 7, coeffs, state, 16));
+    ASSERT_TRUE(fir_q15_init(&fir, 8, coeffs, state, 16));
+    fir_q15(&fir, signal, signal, 16);
+
+    for(int index = 0; index < 16; index++)
+        ASSERT_EQ(index < 8 ? ((int32_t)taps[index]*INT16_MAX) >> 15 : 0,
+                  signal[index]);
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              FilterTest.FIR_blocksAndPrecision()
+// Description:
+//! \brief      Any block split gives the same output, close to double FIR
+//------------------------------------------------------------------------------
+TEST(FilterTest, FIR_blocksAndPrecision)
+{
+    const uint16_t numTaps = 32;
+    q15_t coeffs15[numTaps];
+    q31_t coeffs31[numTaps];
+    double taps[numTaps];
+    q15_t input15[FILTER_TEST_SIZE], whole15[FILTER_TEST_SIZE], split15[64];
+    q31_t input31[FILTER_TEST_SIZE], whole31[FILTER_TEST_SIZE], split31[64];
+    q15_t state15[FIR_STATE_SIZE(numTaps, FILTER_TEST_SIZE)];
+    q31_t state31[FIR_STATE_SIZE(numTaps, FILTER_TEST_SIZE)];
+    double signal[FILTER_TEST_SIZE];
+    FIR_Q15_t fir15;
+    FIR_Q31_t fir31;
+
+    // Hamming windowed-sinc lowpass (fc = 0.1 fs), unity DC gain
+    double sum = 0;
+    for(int tap = 0; tap < numTaps; tap++)
+    {
+        double t = tap - (numTaps - 1)/2.0;
+        taps[tap] = sin(2*M_PI*0.1*t)/(M_PI*t)*
+                    (0.54 - 0.46*cos(2*M_PI*tap/(numTaps - 1)));
+        sum += taps[tap];
+    }
+    for(int tap = 0; tap < numTaps; tap++)
+    {
+        taps[tap] /= sum;
+        coeffs15[numTaps - 1 - tap] = (q15_t)lround(taps[tap]*32768);
+        coeffs31[numTaps - 1 - tap] = (q31_t)lround(taps[tap]*2147483648.0);
+    }
+
+    srand(11);
+    for(int index = 0; index < FILTER_TEST_SIZE; index++)
+    {
+        signal[index] = FILTER_testSignal(index);
+        input15[index] = (q15_t)lround(signal[index]*32768);
+        input31[index] = (q31_t)lround(signal[index]*2147483648.0);
+    }
+
+    ASSERT_TRUE(fir_q15_init(&fir15, numTaps, coeffs15, state15,
+                             FILTER_TEST_SIZE));
+    ASSERT_TRUE(fir_q31_init(&fir31, numTaps, coeffs31, state31,
+                             FILTER_TEST_SIZE));
+    fir_q15(&fir15, input15, whole15, FILTER_TEST_SIZE);
+    fir_q31(&fir31, input31, whole31, FILTER_TEST_SIZE);
+
+    for(int index = 0; index < FILTER_TEST_SIZE; index++)
+    {
+        double expected = 0;
+        for(int tap = 0; tap < numTaps && tap <= index; tap++)
+            expected += taps[tap]*signal[index - tap];
+        ASSERT_NEAR(expected, whole15[index]/32768.0, 16/32768.0);
+        ASSERT_NEAR(expected, whole31[index]/2147483648.0, 1e-8);
+    }
+
+    // Blocks of odd sizes (as DMA half-buffers would come)
+    ASSERT_TRUE(fir_q15_init(&fir15, numTaps, coeffs15, state15, 64));
+    ASSERT_TRUE(fir_q31_init(&fir31, numTaps, coeffs31, state31, 64));
+    for(uint32_t offset = 0, size = 1; offset < FILTER_TEST_SIZE;
+        offset += size, size = (size*5 + 3) % 64 + 1)
+    {
+        if(size > FILTER_TEST_SIZE - offset)
+            size = FILTER_TEST_SIZE - offset;
+        fir_q15(&fir15, input15 + offset, split15, size);
+        fir_q31(&fir31, input31 + offset, split31, size);
+        ASSERT_EQ(0, memcmp(split15, whole15 + offset, size*sizeof(q15_t)));
+        ASSERT_EQ(0, memcmp(split31, whole31 + offset, size*sizeof(q31_t)));
+    }
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              FilterTest.BIQUAD_cascade()
+// Description:
+//! \brief      Cascade of lowpass stages against double reference of the
+//!             same quantized coefficients, any block split
+//------------------------------------------------------------------------------
+TEST(FilterTest, BIQUAD_cascade)
+{
+    const uint8_t numStages = 2;
+    const int8_t postShift = 1;
+    q15_t coeffs15[BIQUAD_Q15_COEFFS(numStages)];
+    q31_t coeffs31[BIQUAD_Q31_COEFFS(numStages)];
+    double quant15[numStages][5], quant31[numStages][5];
+    q15_t state15[BIQUAD_STATE_SIZE(numStages)];
+    q31_t state31[BIQUAD_STATE_SIZE(numStages)];
+    q15_t input15[FILTER_TEST_SIZE], whole15[FILTER_TEST_SIZE];
+    q31_t input31[FILTER_TEST_SIZE], whole31[FILTER_TEST_SIZE];
+    double ref15[FILTER_TEST_SIZE], ref31[FILTER_TEST_SIZE];
+    BIQUAD_Q15_t biquad15;
+    BIQUAD_Q31_t biquad31;
+
+    // 4th order Butterworth lowpass, fc = 50 Hz, fs = 1 kHz
+    const double q[numStages] = { 0.5412, 1.3066 };
+    for(int stage = 0; stage < numStages; stage++)
+    {
+        double coeffs[5];
+        FILTER_biquadLowpass(50, 1000, q[stage], coeffs);
+        for(int k = 0; k < 5; k++)
+        {
+            // Coefficients are scaled down by 2^postShift
+            q15_t c15 = (q15_t)lround(coeffs[k]*32768/2);
+            q31_t c31 = (q31_t)lround(coeffs[k]*2147483648.0/2);
+            coeffs15[stage*6 + (k ? k + 1 : 0)] = c15;
+            coeffs31[stage*5 + k] = c31;
+            quant15[stage][k] = c15*2.0/32768;
+            quant31[stage][k] = c31*2.0/2147483648.0;
+        }
+        coeffs15[stage*6 + 1] = 0;
+    }
+
+    srand(13);
+    for(int index = 0; index < FILTER_TEST_SIZE; index++)
+    {
+        double value = FILTER_testSignal(index)/2;
+        input15[index] = (q15_t)lround(value*32768);
+        input31[index] = (q31_t)lround(value*2147483648.0);
+        ref15[index] = input15[index]/32768.0;
+        ref31[index] = input31[index]/2147483648.0;
+    }
+    for(int stage = 0; stage < numStages; stage++)
+    {
+        double x1 = 0, x2 = 0, y1 = 0, y2 = 0, z1 = 0, z2 = 0, w1 = 0, w2 = 0;
+        const double* c = quant15[stage];
+        const double* d = quant31[stage];
+        for(int index = 0; index < FILTER_TEST_SIZE; index++)
+        {
+            double x = ref15[index];
+            double y = c[0]*x + c[1]*x1 + c[2]*x2 + c[3]*y1 + c[4]*y2;
+            x2 = x1; x1 = x; y2 = y1; y1 = y;
+            ref15[index] = y;
+
+            double z = ref31[index];
+            double w = d[0]*z + d[1]*z1 + d[2]*z2 + d[3]*w1 + d[4]*w2;
+            z2 = z1; z1 = z; w2 = w1; w1 = w;
+            ref31[index] = w;
+        }
+    }
+
+    biquad_q15_init(&biquad15, numStages, coeffs15, state15, postShift);
+    biquad_q31_init(&biquad31, numStages, coeffs31, state31, postShift);
+    biquad_q15(&biquad15, input15, whole15, FILTER_TEST_SIZE);
+    biquad_q31(&biquad31, input31, whole31, FILTER_TEST_SIZE);
+    for(int index = 0; index < FILTER_TEST_SIZE; index++)
+    {
+        ASSERT_NEAR(ref15[index], whole15[index]/32768.0, 64/32768.0);
+        ASSERT_NEAR(ref31[index], whole31[index]/2147483648.0, 1e-7);
+    }
+
+    // In-place processing by blocks
+    biquad_q15_init(&biquad15, numStages, coeffs15, state15, postShift);
+    biquad_q31_init(&biquad31, numStages, coeffs31, state31, postShift);
+    for(uint32_t offset = 0; offset < FILTER_TEST_SIZE; offset += 48)
+    {
+        biquad_q15(&biquad15, input15 + offset, input15 + offset, 48);
+        biquad_q31(&biquad31, input31 + offset, input31 + offset, 48);
+    }
+    ASSERT_EQ(0, memcmp(input15, whole15, sizeof(whole15)));
+    ASSERT_EQ(0, memcmp(input31, whole31, sizeof(whole31)));
+}
+
+//! Filter benchmark block (DMA buffer)
+#define FILTER_BENCH_BLOCK  64
+
+//------------------------------------------------------------------------------
+// Function:
+//              FILTER_benchmark()
+// Description:
+//! \brief      Measure samples per second of filter by blocks
+//------------------------------------------------------------------------------
+template<typename Function>
+static double FILTER_benchmark(const char* name, Function function)
+{
+    const uint32_t blocks = 20000;
+    uint64_t start = LIB_benchTimer();
+    for(uint32_t block = 0; block < blocks; block++)
+        function();
+    double rate = (double)blocks*FILTER_BENCH_BLOCK*1e9/
+                  (double)(LIB_benchTimer() - start);
+
+    printf("[ BENCH    ] %-20s %8.2f Msamples/s\n", name, rate/1e6);
+    return rate;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              FilterBenchmark.DISABLED_FILTER_samplesPerSecond()
+// Description:
+//! \brief      Throughput of FIR and biquad filters
+//------------------------------------------------------------------------------
+TEST(FilterBenchmark, DISABLED_FILTER_samplesPerSecond)
+{
+    static q15_t coeffs15[32], state15[FIR_STATE_SIZE(32, FILTER_BENCH_BLOCK)];
+    static q31_t coeffs31[32], state31[FIR_STATE_SIZE(32, FILTER_BENCH_BLOCK)];
+    static q15_t block15[FILTER_BENCH_BLOCK];
+    static q31_t block31[FILTER_BENCH_BLOCK];
+    static q15_t bqCoeffs15[BIQUAD_Q15_COEFFS(2)] =
+        { 1000, 0, 2000, 1000, 20000, -9000, 1000, 0, 2000, 1000, 20000, -9000 };
+    static q31_t bqCoeffs31[BIQUAD_Q31_COEFFS(2)];
+    static q15_t bqState15[BIQUAD_STATE_SIZE(2)];
+    static q31_t bqState31[BIQUAD_STATE_SIZE(2)];
+    static FIR_Q15_t fir15;
+    static FIR_Q31_t fir31;
+    static BIQUAD_Q15_t biquad15;
+    static BIQUAD_Q31_t biquad31;
+
+    for(int tap = 0; tap < 32; tap++)
+    {
+        coeffs15[tap] = (q15_t)(500 + tap*10);
+        coeffs31[tap] = q31_fromQ15(coeffs15[tap]);
+    }
+    for(int k = 0; k < BIQUAD_Q31_COEFFS(2); k++)
+        bqCoeffs31[k] = q31_fromQ15(bqCoeffs15[k + k/5 + (k % 5 ? 1 : 0)]);
+    for(int index = 0; index < FILTER_BENCH_BLOCK; index++)
+    {
+        block15[index] = (q15_t)(index*300 - 9000);
+        block31[index] = q31_fromQ15(block15[index]);
+    }
+
+    fir_q15_init(&fir15, 32, coeffs15, state15, FILTER_BENCH_BLOCK);
+    fir_q31_init(&fir31, 32, coeffs31, state31, FILTER_BENCH_BLOCK);
+    biquad_q15_init(&biquad15, 2, bqCoeffs15, bqState15, 1);
+    biquad_q31_init(&biquad31, 2, bqCoeffs31, bqState31, 1);
+
+    FILTER_benchmark("fir_q15 (32 taps)", []()
+        { fir_q15(&fir15, block15, block15, FILTER_BENCH_BLOCK); });
+    FILTER_benchmark("fir_q31 (32 taps)", []()
+        { fir_q31(&fir31, block31, block31, FILTER_BENCH_BLOCK); });
+    FILTER_benchmark("biquad_q15 (2 st.)", []()
+        { biquad_q15(&biquad15, block15, block15, FILTER_BENCH_BLOCK); });
+    FILTER_benchmark("biquad_q31 (2 st.)", []()
+        { biquad_q31(&biquad31, block31, block31, FILTER_BENCH_BLOCK); });
+    LIB_benchSink += block15[0] + block31[0];
+}
+
+//! Stats reference result
+struct STATS_Reference{
+    int16_t     min;
+    int16_t     max;
+    int16_t     mean;
+    int16_t     median;
+    uint32_t    variance;
+};
+
+//------------------------------------------------------------------------------
+// Function:
+//              STATS_reference()
+// Description:
+//! \brief      Brute force statistics of the last count samples
+//------------------------------------------------------------------------------
+static STATS_Reference STATS_reference(const int16_t* samples, uint32_t count)
+{
+    STATS_Reference ref;
+    int16_t sorted[512];
+    int64_t sum = 0, sumSq = 0;
+
+    memcpy(sorted, samples, count*sizeof(int16_t));
+    std::sort(sorted, sorted + count);
+    for(uint32_t index = 0; index < count; index++)
+    {
+        sum += samples[index];
+        sumSq += (int32_t)samples[index]*samples[index];
+    }
+
+    ref.min = sorted[0];
+    ref.max = sorted[count - 1];
+    ref.mean = (int16_t)floor((double)sum/count);
+    ref.median = (count & 0x01) ? sorted[count/2] :
+        (int16_t)floor((sorted[count/2 - 1] + sorted[count/2])/2.0);
+    ref.variance = (uint32_t)((count*sumSq - sum*sum)/((int64_t)count*count));
+    return ref;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              STATS_testSample()
+// Description:
+//! \brief      Random samples with duplicates, plateaus and spikes
+//------------------------------------------------------------------------------
+static int16_t STATS_testSample(uint32_t index)
+{
+    switch(rand() % 8)
+    {
+    case 0:  return (rand() & 0x01) ? INT16_MAX : INT16_MIN;   // spike
+    case 1:  return (int16_t)(rand() % 5);                      // duplicates
+    case 2:  return (int16_t)(index/16*100);                    // plateau
+    default: return (int16_t)(rand() % 20001 - 10000);
+    }
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              StatsTest.STATS_initChecksSize()
+// Description:
+//! \brief      Invalid window sizes are rejected, empty window gives zeros
+//------------------------------------------------------------------------------
+TEST(StatsTest, STATS_initChecksSize)
+{
+    static uint16_t buffer[STATS_BUFFER_SIZE(4)];
+    STATS_Window_t window;
+
+    EXPECT_FALSE(stats_init(&window, buffer, 0));
+    EXPECT_FALSE(stats_init(&window, buffer, STATS_MAX_SIZE + 1));
+    ASSERT_TRUE(stats_init(&window, buffer, 4));
+
+    EXPECT_EQ(0, stats_min(&window));
+    EXPECT_EQ(0, stats_max(&window));
+    EXPECT_EQ(0, stats_mean(&window));
+    EXPECT_EQ(0u, stats_variance(&window));
+    EXPECT_EQ(0, stats_median(&window));
+
+    stats_append(&window, -7);
+    EXPECT_EQ(-7, stats_min(&window));
+    EXPECT_EQ(-7, stats_max(&window));
+    EXPECT_EQ(-7, stats_median(&window));
+    stats_append(&window, 2);
+    EXPECT_EQ(-3, stats_mean(&window));     // -2.5 rounded down
+    EXPECT_EQ(-3, stats_median(&window));
+    EXPECT_EQ(20u, stats_variance(&window));
+    EXPECT_EQ(4, stats_stddev(&window));
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              StatsTest.STATS_matchesBruteForce()
+// Description:
+//! \brief      Every statistic equals brute force one after every sample
+//------------------------------------------------------------------------------
+TEST(StatsTest, STATS_matchesBruteForce)
+{
+    static const uint16_t sizes[] = { 1, 2, 5, 16, 33, 256 };
+    static uint16_t buffer[STATS_BUFFER_SIZE(256)];
+    static int16_t samples[2000];
+    STATS_Window_t window;
+
+    srand(39);
+    for(uint32_t index = 0; index < 2000; index++)
+        samples[index] = STATS_testSample(index);
+
+    for(uint16_t size : sizes)
+    {
+        ASSERT_TRUE(stats_init(&window, buffer, size));
+
+        for(uint32_t index = 0; index < 2000; index++)
+        {
+            uint32_t count = (index + 1 < size) ? index + 1 : size;
+            STATS_Reference ref;
+
+            stats_append(&window, samples[index]);
+            ref = STATS_reference(samples + index + 1 - count, count);
+
+            ASSERT_EQ(ref.min, stats_min(&window)) << size << ":" << index;
+            ASSERT_EQ(ref.max, stats_max(&window)) << size << ":" << index;
+            ASSERT_EQ(ref.mean, stats_mean(&window)) << size << ":" << index;
+            ASSERT_EQ(ref.median, stats_median(&window))
+                << size << ":" << index;
+            ASSERT_EQ(ref.variance, stats_variance(&window))
+                << size << ":" << index;
+            ASSERT_EQ((uint16_t)sqrt((double)ref.variance),
+                      stats_stddev(&window)) << size << ":" << index;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              StatsTest.STATS_blocksAndCircular()
+// Description:
+//! \brief      Block and CircularBuffer feeding give the same window
+//------------------------------------------------------------------------------
+TEST(StatsTest, STATS_blocksAndCircular)
+{
+    static uint16_t bufferBlock[STATS_BUFFER_SIZE(24)];
+    static uint16_t bufferCircular[STATS_BUFFER_SIZE(24)];
+    static int16_t samples[300];
+    CircularBufferS16(8) circular;
+    STATS_Window_t block, single;
+
+    memset(&circular, 0, sizeof(circular));
+    ASSERT_TRUE(stats_init(&block, bufferBlock, 24));
+    ASSERT_TRUE(stats_init(&single, bufferCircular, 24));
+
+    srand(390);
+    for(uint32_t index = 0; index < 300; index++)
+        samples[index] = STATS_testSample(index);
+
+    for(uint32_t index = 0; index < 300; index += 30)
+        stats_appendBlock(&block, samples + index, 30);
+
+    for(uint32_t index = 0; index < 300; index++)
+    {
+        CircularBuffer_append(circular, samples[index]);
+        STATS_appendCircular(single, circular);
+    }
+
+    EXPECT_EQ(stats_min(&block), stats_min(&single));
+    EXPECT_EQ(stats_max(&block), stats_max(&single));
+    EXPECT_EQ(stats_mean(&block), stats_mean(&single));
+    EXPECT_EQ(stats_median(&block), stats_median(&single));
+    EXPECT_EQ(stats_variance(&block), stats_variance(&single));
+
+    stats_clear(&block);
+    stats_append(&block, 5);
+    EXPECT_EQ(5, stats_min(&block));
+    EXPECT_EQ(5, stats_median(&block));
+    EXPECT_EQ(0u, stats_variance(&block));
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              StatsBenchmark.DISABLED_STATS_perSample()
+// Description:
+//! \brief      Per-sample cost of window update vs brute force rescan
+//------------------------------------------------------------------------------
+TEST(StatsBenchmark, DISABLED_STATS_perSample)
+{
+    static const uint16_t sizes[] = { 64, 256 };
+    static uint16_t buffer[STATS_BUFFER_SIZE(256)];
+    static int16_t samples[4096];
+    STATS_Window_t window;
+    const uint32_t rounds = 20;
+
+    srand(3939);
+    for(uint32_t index = 0; index < 4096; index++)
+        samples[index] = STATS_testSample(index);
+
+    for(uint16_t size : sizes)
+    {
+        double ns[2];
+        uint64_t start;
+
+        stats_init(&window, buffer, size);
+        start = LIB_benchTimer();
+        for(uint32_t round = 0; round < rounds; round++)
+            for(uint32_t index = 0; index < 4096; index++)
+            {
+                stats_append(&window, samples[index]);
+                LIB_benchSink += stats_min(&window) + stats_max(&window) +
+                    stats_median(&window) + stats_variance(&window);
+            }
+        ns[0] = (double)(LIB_benchTimer() - start)/(rounds*4096);
+
+        start = LIB_benchTimer();
+        for(uint32_t index = size; index < 4096; index++)
+        {
+            STATS_Reference ref = STATS_reference(samples + index - size, size);
+            LIB_benchSink += ref.min + ref.max + ref.median + ref.variance;
+        }
+        ns[1] = (double)(LIB_benchTimer() - start)/(4096 - size);
+
+        printf("[ BENCH    ] window %3u: %7.1f ns/sample, brute force "
+               "%8.1f ns/sample\n", size, ns[0], ns[1]);
+    }
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              RootTest.ROOT_exhaustive16()
+// Description:
+//! \brief      isqrt16/isqrt32 equal fastRoot16/fastRoot32 over 16-bit range
+//------------------------------------------------------------------------------
+TEST(RootTest, ROOT_exhaustive16)
+{
+    for(uint32_t x = 0; x <= UINT16_MAX; x++)
+    {
+        ASSERT_EQ(fastRoot16((uint16_t)x), isqrt16((uint16_t)x)) << x;
+        ASSERT_EQ(fastRoot32(x), isqrt32(x)) << x;
+        ASSERT_EQ(fastRoot32(x), isqrt64(x)) << x;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              RootTest.ROOT_squareBoundaries()
+// Description:
+//! \brief      Results around every 32-bit square and random 64-bit squares
+//------------------------------------------------------------------------------
+TEST(RootTest, ROOT_squareBoundaries)
+{
+    for(uint32_t root = 1; root <= UINT16_MAX; root++)
+    {
+        uint32_t square = root*root;
+        ASSERT_EQ(root, isqrt32(square)) << square;
+        ASSERT_EQ(root - 1, isqrt32(square - 1)) << square;
+        ASSERT_EQ(fastRoot32(square + root), isqrt32(square + root)) << square;
+    }
+    EXPECT_EQ(UINT16_MAX, isqrt32(UINT32_MAX));
+
+    srand(40);
+    for(uint32_t index = 0; index < 200000; index++)
+    {
+        uint32_t root = ((uint32_t)rand() << 16) ^ (uint32_t)rand();
+        uint64_t square = (uint64_t)root*root;
+
+        if(root == 0)
+            continue;
+        ASSERT_EQ(root, isqrt64(square)) << square;
+        ASSERT_EQ(root - 1, isqrt64(square - 1)) << square;
+        ASSERT_EQ(root, isqrt64(square + 2*(uint64_t)root)) << square;
+    }
+    EXPECT_EQ(UINT32_MAX, isqrt64(UINT64_MAX));
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              RootTest.ROOT_blockRms()
+// Description:
+//! \brief      Block RMS equals rounded down floating point RMS
+//------------------------------------------------------------------------------
+TEST(RootTest, ROOT_blockRms)
+{
+    static int16_t samples[4096];
+    double sumSq = 0;
+
+    EXPECT_EQ(0, blockRms16(samples, 0));
+    for(uint32_t index = 0; index < 4096; index++)
+        samples[index] = INT16_MIN;
+    EXPECT_EQ(32768, blockRms16(samples, 4096));
+
+    srand(400);
+    for(uint32_t index = 0; index < 4096; index++)
+    {
+        samples[index] = (int16_t)(20000*sin(2*M_PI*index/64.0) +
+                                   rand() % 2001 - 1000);
+        sumSq += (double)samples[index]*samples[index];
+        if((index & 0xFF) == 0xFF)
+        {
+            ASSERT_EQ((uint16_t)sqrt(floor(sumSq/(index + 1))),
+                      blockRms16(samples, (uint16_t)(index + 1))) << index;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              RootBenchmark.DISABLED_ROOT_cyclesPerCall()
+// Description:
+//! \brief      Root time of iterative and table-seeded versions
+//------------------------------------------------------------------------------
+TEST(RootBenchmark, DISABLED_ROOT_cyclesPerCall)
+{
+    static uint32_t values[4096];
+    const uint32_t rounds = 200;
+    double ns[4];
+    uint64_t start;
+
+    // Squared sample magnitudes, from noise to full scale
+    srand(4000);
+    for(uint32_t index = 0; index < 4096; index++)
+    {
+        uint32_t sample = (uint32_t)(rand() & 0x7FFF) >> (rand() % 15);
+        values[index] = sample*sample;
+    }
+
+    start = LIB_benchTimer();
+    for(uint32_t round = 0; round < rounds; round++)
+        for(uint32_t index = 0; index < 4096; index++)
+            LIB_benchSink += fastRoot32(values[index] + round);
+    ns[0] = (double)(LIB_benchTimer() - start)/(rounds*4096);
+
+    start = LIB_benchTimer();
+    for(uint32_t round = 0; round < rounds; round++)
+        for(uint32_t index = 0; index < 4096; index++)
+            LIB_benchSink += isqrt32(values[index] + round);
+    ns[1] = (double)(LIB_benchTimer() - start)/(rounds*4096);
+
+    start = LIB_benchTimer();
+    for(uint32_t round = 0; round < rounds; round++)
+        for(uint32_t index = 0; index < 4096; index++)
+            LIB_benchSink += fastRoot16((uint16_t)(values[index] >> 14) + round);
+    ns[2] = (double)(LIB_benchTimer() - start)/(rounds*4096);
+
+    start = LIB_benchTimer();
+    for(uint32_t round = 0; round < rounds; round++)
+        for(uint32_t index = 0; index < 4096; index++)
+            LIB_benchSink += isqrt16((uint16_t)(values[index] >> 14) + round);
+    ns[3] = (double)(LIB_benchTimer() - start)/(rounds*4096);
+
+    printf("[ BENCH    ] fastRoot32 %5.2f, isqrt32 %5.2f, fastRoot16 %5.2f, "
+           "isqrt16 %5.2f ns/call\n", ns[0], ns[1], ns[2], ns[3]);
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              FFT_reference()
+// Description:
+//! \brief      Double precision DFT scaled by 1/size
+//------------------------------------------------------------------------------
+static void FFT_reference(const q15_t* data, double* result, uint16_t size,
+                          bool inverse)
+{
+    double sign = inverse ? 1.0 : -1.0;
+
+    for(uint32_t k = 0; k < size; k++)
+    {
+        double re = 0, im = 0;
+        for(uint32_t n = 0; n < size; n++)
+        {
+            double angle = sign*2*M_PI*(double)((k*n) % size)/size;
+            re += data[2*n]*cos(angle) - data[2*n + 1]*sin(angle);
+            im += data[2*n]*sin(angle) + data[2*n + 1]*cos(angle);
+        }
+        result[2*k] = re/size;
+        result[2*k + 1] = im/size;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              FftTest.FFT_initChecksSize()
+// Description:
+//! \brief      Only power of two sizes up to FFT_MAX_SIZE are accepted
+//------------------------------------------------------------------------------
+TEST(FftTest, FFT_initChecksSize)
+{
+    FFT_Q15_t fft;
+
+    EXPECT_FALSE(fft_q15_init(&fft, 8));
+    EXPECT_FALSE(fft_q15_init(&fft, 48));
+    EXPECT_FALSE(fft_q15_init(&fft, 2*FFT_MAX_SIZE));
+    EXPECT_TRUE(fft_q15_init(&fft, 16));
+    EXPECT_TRUE(fft_q15_init(&fft, FFT_MAX_SIZE));
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              FftTest.FFT_accuracy()
+// Description:
+//! \brief      Forward and inverse FFT vs double DFT, radix-4 and 2 sizes
+//------------------------------------------------------------------------------
+TEST(FftTest, FFT_accuracy)
+{
+    static const uint16_t sizes[] = { 16, 32, 64, 128, 256, 512, 1024 };
+    static q15_t input[2*1024], data[2*1024];
+    static double reference[2*1024];
+    FFT_Q15_t fft;
+
+    srand(41);
+    for(uint16_t size : sizes)
+    {
+        for(int direction = 0; direction < 2; direction++)
+        {
+            double error = 0, maxError = 0, signal = 0;
+
+            // Two tones and noise, complex magnitude below 1.0
+            for(uint32_t n = 0; n < size; n++)
+            {
+                double angle = 2*M_PI*n*3/size;
+                input[2*n] = (q15_t)(12000*cos(angle) +
+                    8000*sin(2*M_PI*n*(size/4 + 1)/size) + rand() % 4001 - 2000);
+                input[2*n + 1] = (q15_t)(12000*sin(angle) + rand() % 4001 - 2000);
+            }
+            memcpy(data, input, 4*size);
+
+            ASSERT_TRUE(fft_q15_init(&fft, size));
+            fft_q15(&fft, data, direction != 0);
+            FFT_reference(input, reference, size, direction != 0);
+
+            for(uint32_t index = 0; index < 2*size; index++)
+            {
+                double diff = data[index] - reference[index];
+                error += diff*diff;
+                signal += reference[index]*reference[index];
+                maxError = fmax(maxError, fabs(diff));
+            }
+
+            // Truncation: about 1 LSB per stage
+            EXPECT_LT(maxError, 2 + log2(size)) << size;
+            if(size == 1024 && direction == 0)
+                printf("[ BENCH    ] FFT 1024: SNR %.1f dB, max error "
+                       "%.1f LSB\n", 10*log10(signal/error), maxError);
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              FftTest.FFT_toneMagnitude()
+// Description:
+//! \brief      Real tone gives two bins of half amplitude
+//------------------------------------------------------------------------------
+TEST(FftTest, FFT_toneMagnitude)
+{
+    static q15_t data[2*256];
+    static uint16_t magnitude[256];
+    FFT_Q15_t fft;
+
+    for(uint32_t n = 0; n < 256; n++)
+    {
+        data[2*n] = (q15_t)(30000*cos(2*M_PI*n*10/256));
+        data[2*n + 1] = 0;
+    }
+
+    ASSERT_TRUE(fft_q15_init(&fft, 256));
+    fft_q15(&fft, data, false);
+    fft_magnitude_q15(data, magnitude, 256);
+
+    // X[k]/N = amplitude/2 = 15000
+    EXPECT_NEAR(15000, magnitude[10], 8);
+    EXPECT_NEAR(15000, magnitude[246], 8);
+    for(uint32_t k = 0; k < 256; k++)
+    {
+        if(k != 10 && k != 246)
+        {
+            EXPECT_LT(magnitude[k], 8) << k;
+        }
+    }
+
+    EXPECT_EQ(15000, isqrt32(9000*9000 + 12000*12000));
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              GoertzelTest.GOERTZEL_coefficients()
+// Description:
+//! \brief      Compile time coefficients equal rounded 2*cos(w) in Q14
+//------------------------------------------------------------------------------
+TEST(GoertzelTest, GOERTZEL_coefficients)
+{
+    static const int16_t coeffs[] = {
+        GOERTZEL_COEFF(697, 8000), GOERTZEL_COEFF(1209, 8000),
+        GOERTZEL_COEFF(3999, 8000), GOERTZEL_COEFF(1, 8000) };
+    static const double freqs[] = { 697, 1209, 3999, 1 };
+
+    for(int index = 0; index < 4; index++)
+    {
+        double expected = fmin(32767, round(32768*cos(2*M_PI*freqs[index]/8000)));
+        EXPECT_EQ((int16_t)expected, coeffs[index]) << freqs[index];
+    }
+    EXPECT_EQ(-32768, GOERTZEL_COEFF(4000, 8000));
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              GoertzelTest.GOERTZEL_dtmf()
+// Description:
+//! \brief      Multi-bin detection of DTMF pair, magnitude vs double DFT
+//------------------------------------------------------------------------------
+TEST(GoertzelTest, GOERTZEL_dtmf)
+{
+    static const double freqs[8] = { 697, 770, 852, 941, 1209, 1336, 1477, 1633 };
+    static const int16_t coeffs[8] = {
+        GOERTZEL_COEFF(697, 8000),  GOERTZEL_COEFF(770, 8000),
+        GOERTZEL_COEFF(852, 8000),  GOERTZEL_COEFF(941, 8000),
+        GOERTZEL_COEFF(1209, 8000), GOERTZEL_COEFF(1336, 8000),
+        GOERTZEL_COEFF(1477, 8000), GOERTZEL_COEFF(1633, 8000) };
+    static int32_t state[GOERTZEL_STATE_SIZE(8)];
+    static q15_t samples[205];
+    GOERTZEL_t goertzel;
+
+    // Key "6": 770 Hz + 1477 Hz
+    srand(4141);
+    for(uint32_t n = 0; n < 205; n++)
+        samples[n] = (q15_t)(12000*sin(2*M_PI*770*n/8000) +
+                             12000*sin(2*M_PI*1477*n/8000 + 1) +
+                             rand() % 2001 - 1000);
+
+    goertzel_init(&goertzel, coeffs, state, 8);
+    EXPECT_EQ(0, goertzel_amplitude(&goertzel, 0));
+
+    // Split blocks give the same accumulators
+    goertzel_block(&goertzel, samples, 100);
+    goertzel_block(&goertzel, samples + 100, 105);
+
+    for(int bin = 0; bin < 8; bin++)
+    {
+        // DFT at frequency of quantized coefficient
+        double w = acos(coeffs[bin]/32768.0);
+        double re = 0, im = 0;
+        for(uint32_t n = 0; n < 205; n++)
+        {
+            re += samples[n]*cos(w*n);
+            im -= samples[n]*sin(w*n);
+        }
+        EXPECT_NEAR(sqrt(re*re + im*im), goertzel_magnitude(&goertzel, bin),
+                    0.001*sqrt(re*re + im*im) + 64) << freqs[bin];
+
+        if(bin == 1 || bin == 6)
+        {
+            EXPECT_GT(goertzel_amplitude(&goertzel, bin), 9000) << freqs[bin];
+        }
+        else
+        {
+            EXPECT_LT(goertzel_amplitude(&goertzel, bin), 3000) << freqs[bin];
+        }
+    }
+
+    goertzel_reset(&goertzel);
+    EXPECT_EQ(0u, goertzel_magnitude(&goertzel, 1));
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              FftBenchmark.DISABLED_FFT_timePerBlock()
+// Description:
+//! \brief      FFT and Goertzel time vs direct DFT
+//------------------------------------------------------------------------------
+TEST(FftBenchmark, DISABLED_FFT_timePerBlock)
+{
+    static const int16_t coeffs[4] = {
+        GOERTZEL_COEFF(50, 1000), GOERTZEL_COEFF(100, 1000),
+        GOERTZEL_COEFF(150, 1000), GOERTZEL_COEFF(200, 1000) };
+    static int32_t state[GOERTZEL_STATE_SIZE(4)];
+    static q15_t input[2*1024], data[2*1024];
+    static double reference[2*256];
+    GOERTZEL_t goertzel;
+    FFT_Q15_t fft;
+    const uint32_t rounds = 200;
+    double us[4];
+    uint64_t start;
+
+    for(uint32_t n = 0; n < 1024; n++)
+    {
+        input[2*n] = (q15_t)(16000*sin(2*M_PI*n*100/1000.0));
+        input[2*n + 1] = 0;
+    }
+
+    fft_q15_init(&fft, 256);
+    start = LIB_benchTimer();
+    for(uint32_t round = 0; round < rounds; round++)
+    {
+        memcpy(data, input, 4*256);
+        fft_q15(&fft, data, false);
+        LIB_benchSink += data[2*25];
+    }
+    us[0] = (double)(LIB_benchTimer() - start)/rounds/1000;
+
+    fft_q15_init(&fft, 1024);
+    start = LIB_benchTimer();
+    for(uint32_t round = 0; round < rounds; round++)
+    {
+        memcpy(data, input, 4*1024);
+        fft_q15(&fft, data, false);
+        LIB_benchSink += data[2*100];
+    }
+    us[1] = (double)(LIB_benchTimer() - start)/rounds/1000;
+
+    goertzel_init(&goertzel, coeffs, state, 4);
+    start = LIB_benchTimer();
+    for(uint32_t round = 0; round < rounds; round++)
+    {
+        goertzel_reset(&goertzel);
+        goertzel_block(&goertzel, input, 256);
+        LIB_benchSink += goertzel_magnitude(&goertzel, 1);
+    }
+    us[2] = (double)(LIB_benchTimer() - start)/rounds/1000;
+
+    start = LIB_benchTimer();
+    FFT_reference(input, reference, 256, false);
+    us[3] = (double)(LIB_benchTimer() - start)/1000;
+
+    printf("[ BENCH    ] fft_q15 256: %.2f us, 1024: %.2f us; goertzel "
+           "4 bins x 256: %.2f us; double DFT 256: %.0f us\n",
+           us[0], us[1], us[2], us[3]);
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              DECIMATE_cicReference()
+// Description:
+//! \brief      CIC as cascade of moving sums of ratio samples (64-bit)
+//------------------------------------------------------------------------------
+static int64_t DECIMATE_cicReference(const int16_t* samples, uint32_t index,
+                                     uint8_t order, uint16_t ratio)
+{
+    static int64_t stage[2][4096];
+    uint32_t n;
+
+    for(n = 0; n <= index; n++)
+        stage[0][n] = samples[n];
+    for(uint8_t level = 0; level < order; level++)
+    {
+        int64_t* in = stage[level & 0x01];
+        int64_t* out = stage[(level + 1) & 0x01];
+        for(n = 0; n <= index; n++)
+        {
+            out[n] = 0;
+            for(uint32_t k = 0; k < ratio && k <= n; k++)
+                out[n] += in[n - k];
+        }
+    }
+    return stage[order & 0x01][index];
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              DecimateTest.CIC_initChecksGrowth()
+// Description:
+//! \brief      Order and ratio have to fit 32-bit registers
+//------------------------------------------------------------------------------
+TEST(DecimateTest, CIC_initChecksGrowth)
+{
+    CIC_t cic;
+
+    EXPECT_FALSE(cic_init(&cic, 0, 8, 0));
+    EXPECT_FALSE(cic_init(&cic, CIC_MAX_ORDER + 1, 2, 0));
+    EXPECT_FALSE(cic_init(&cic, 4, 32, 20));    // 4*5 bits
+    EXPECT_FALSE(cic_init(&cic, 3, 64, 18));    // 3*6 bits
+    EXPECT_TRUE(cic_init(&cic, 4, 16, 16));
+    EXPECT_TRUE(cic_init(&cic, 2, 256, 16));
+    EXPECT_TRUE(cic_init(&cic, 1, 1, 0));
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              DecimateTest.CIC_matchesReference()
+// Description:
+//! \brief      Every order/ratio equals moving sum cascade, any block split
+//------------------------------------------------------------------------------
+TEST(DecimateTest, CIC_matchesReference)
+{
+    static const uint16_t ratios[] = { 2, 3, 8, 16 };
+    static int16_t samples[600], output[600];
+    CIC_t cic;
+
+    srand(42);
+    for(uint32_t n = 0; n < 600; n++)
+        samples[n] = (n % 97 < 3) ? INT16_MIN :
+                     (int16_t)(rand() % 65536 - 32768);
+
+    for(uint8_t order = 1; order <= CIC_MAX_ORDER; order++)
+    {
+        for(uint16_t ratio : ratios)
+        {
+            uint8_t bits = (ratio <= 2) ? 1 : (ratio <= 4) ? 2 :
+                           (ratio <= 8) ? 3 : 4;
+            uint16_t outputs = 0, position = 0;
+
+            ASSERT_TRUE(cic_init(&cic, order, ratio, order*bits));
+
+            // Blocks of varying size, not aligned to ratio
+            while(position < 600)
+            {
+                uint16_t count = (uint16_t)(1 + rand() % 70);
+                if(count > 600 - position)
+                    count = 600 - position;
+                outputs += cic_decimate(&cic, samples + position, count,
+                                        output + outputs);
+                position += count;
+            }
+
+            ASSERT_EQ((600 + ratio - 1)/ratio, outputs);
+            for(uint16_t index = 0; index < outputs; index++)
+            {
+                int64_t expected = DECIMATE_cicReference(samples,
+                    index*ratio, order, ratio) >> (order*bits);
+                ASSERT_EQ(expected, output[index])
+                    << (int)order << "/" << ratio << ":" << index;
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              DecimateTest.CIC_extraResolution()
+// Description:
+//! \brief      Oversampled dithered DC gives fractional LSBs
+//------------------------------------------------------------------------------
+TEST(DecimateTest, CIC_extraResolution)
+{
+    static int16_t samples[64*16], output[64];
+    CIC_t cic;
+    double mean = 0, error = 0, inputError = 0;
+
+    // 12-bit ADC codes of 1000.3 LSB with +-2 LSB noise
+    srand(420);
+    for(uint32_t n = 0; n < 64*16; n++)
+        samples[n] = (int16_t)floor(1000.3 + (rand() % 4001 - 2000)/1000.0 + 0.5);
+
+    // Gain 16^3 = 2^12, keep 4 extra bits
+    ASSERT_TRUE(cic_init(&cic, 3, 16, 8));
+    ASSERT_EQ(64, cic_decimate(&cic, samples, 64*16, output));
+
+    // Skip CIC settling (order outputs)
+    for(uint32_t index = 4; index < 64; index++)
+    {
+        mean += output[index]/16.0/60;
+        error += pow(output[index]/16.0 - 1000.3, 2)/60;
+        inputError += pow(samples[16*index] - 1000.3, 2)/60;
+    }
+    EXPECT_NEAR(1000.3, mean, 0.1);
+    EXPECT_LT(sqrt(error), sqrt(inputError)/2);
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              DecimateTest.FIR_DECIMATE_matchesFir()
+// Description:
+//! \brief      Decimator equals every ratio-th output of full rate FIR
+//------------------------------------------------------------------------------
+TEST(DecimateTest, FIR_DECIMATE_matchesFir)
+{
+    static q15_t coeffs[24], samples[480], full[480], decimated[120];
+    static q15_t firState[FIR_STATE_SIZE(24, 480)];
+    static q15_t decState[FIR_STATE_SIZE(24, 48)];
+    FIR_DECIMATE_Q15_t decimator;
+    FIR_Q15_t fir;
+
+    srand(4242);
+    for(int tap = 0; tap < 24; tap++)
+        coeffs[tap] = (q15_t)(rand() % 6001 - 3000);
+    for(int n = 0; n < 480; n++)
+        samples[n] = (q15_t)(rand() % 65536 - 32768);
+
+    EXPECT_FALSE(fir_decimate_q15_init(&decimator, 24, 4, coeffs, decState, 50));
+    ASSERT_TRUE(fir_decimate_q15_init(&decimator, 24, 4, coeffs, decState, 48));
+    ASSERT_TRUE(fir_q15_init(&fir, 24, coeffs, firState, 480));
+
+    fir_q15(&fir, samples, full, 480);
+    for(int block = 0; block < 10; block++)
+        fir_decimate_q15(&decimator, samples + 48*block, decimated + 12*block, 48);
+
+    for(int index = 0; index < 120; index++)
+        ASSERT_EQ(full[4*index], decimated[index]) << index;
+}
+
+//! ADC sample handler (per-sample callback model)
+static void (*volatile DECIMATE_sampleHandler)(int16_t sample);
+
+//! Per-sample decimator state
+static CIC_t DECIMATE_cic;
+static int16_t DECIMATE_output[64];
+
+//------------------------------------------------------------------------------
+// Function:
+//              DECIMATE_onSample()
+// Description:
+//! \brief      Per-sample ADC callback feeding CIC
+//------------------------------------------------------------------------------
+static void DECIMATE_onSample(int16_t sample)
+{
+    cic_decimate(&DECIMATE_cic, &sample, 1, DECIMATE_output);
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              DecimateBenchmark.DISABLED_DECIMATE_perInputSample()
+// Description:
+//! \brief      Per-sample callbacks vs block decimation, by ratio
+//------------------------------------------------------------------------------
+TEST(DecimateBenchmark, DISABLED_DECIMATE_perInputSample)
+{
+    static const uint16_t ratios[] = { 4, 16, 64 };
+    static q15_t coeffs[32], block[256], output[256];
+    static q15_t decState[FIR_STATE_SIZE(32, 256)];
+    static q15_t firState[FIR_STATE_SIZE(32, 256)];
+    const uint32_t rounds = 400;
+
+    for(int tap = 0; tap < 32; tap++)
+        coeffs[tap] = (q15_t)(1000 - 30*tap);
+    for(int n = 0; n < 256; n++)
+        block[n] = (q15_t)(n*200 - 25600);
+
+    for(uint16_t ratio : ratios)
+    {
+        FIR_DECIMATE_Q15_t decimator;
+        FIR_Q15_t fir;
+        CIC_t cic;
+        double ns[4];
+        uint64_t start;
+
+        // Per-sample callback, CIC order 2
+        cic_init(&DECIMATE_cic, 2, ratio, 0);
+        DECIMATE_sampleHandler = DECIMATE_onSample;
+        start = LIB_benchTimer();
+        for(uint32_t round = 0; round < rounds; round++)
+            for(int n = 0; n < 256; n++)
+                DECIMATE_sampleHandler(block[n]);
+        ns[0] = (double)(LIB_benchTimer() - start)/(rounds*256);
+
+        cic_init(&cic, 2, ratio, 0);
+        start = LIB_benchTimer();
+        for(uint32_t round = 0; round < rounds; round++)
+            LIB_benchSink += cic_decimate(&cic, block, 256, output);
+        ns[1] = (double)(LIB_benchTimer() - start)/(rounds*256);
+
+        // 32-tap FIR at full rate vs decimator
+        fir_q15_init(&fir, 32, coeffs, firState, 256);
+        start = LIB_benchTimer();
+        for(uint32_t round = 0; round < rounds; round++)
+            fir_q15(&fir, block, output, 256);
+        ns[2] = (double)(LIB_benchTimer() - start)/(rounds*256);
+
+        fir_decimate_q15_init(&decimator, 32, (uint8_t)ratio, coeffs,
+                              decState, 256);
+        start = LIB_benchTimer();
+        for(uint32_t round = 0; round < rounds; round++)
+            fir_decimate_q15(&decimator, block, output, 256);
+        ns[3] = (double)(LIB_benchTimer() - start)/(rounds*256);
+        LIB_benchSink += output[0];
+
+        printf("[ BENCH    ] ratio %2u: CIC per-sample %5.2f, block %5.2f; "
+               "FIR full rate %5.2f, decimator %5.2f ns/input\n",
+               ratio, ns[0], ns[1], ns[2], ns[3]);
+    }
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              QmathTest.QMATH_saturation()
+// Description:
+//! \brief      Saturating arithmetic and conversions at range limits
+//------------------------------------------------------------------------------
+TEST(QmathTest, QMATH_saturation)
+{
+    EXPECT_EQ(32767, q15_add(30000, 10000));
+    EXPECT_EQ(-32768, q15_add(-30000, -10000));
+    EXPECT_EQ(-32768, q15_sub(-30000, 10000));
+    EXPECT_EQ(32767, q15_mul(-32768, -32768));
+    EXPECT_EQ(Q15_CONST(0.25), q15_mul(Q15_CONST(0.5), Q15_CONST(0.5)));
+    EXPECT_EQ(0, q15_mul(-1, 16384));       // -0.5 LSB rounded up
+    EXPECT_EQ(32767, q15_abs(-32768));
+    EXPECT_EQ(INT32_MAX, q31_add(INT32_MAX, 1));
+    EXPECT_EQ(INT32_MIN, q31_sub(INT32_MIN, 1));
+    EXPECT_EQ(INT32_MAX, q31_mul(INT32_MIN, INT32_MIN));
+    EXPECT_EQ(Q31_CONST(-0.125), q31_mul(Q31_CONST(0.5), Q31_CONST(-0.25)));
+
+    EXPECT_EQ(32767, Q15_CONST(1.0));
+    EXPECT_EQ(-32768, Q15_CONST(-1.0));
+    EXPECT_EQ(INT32_MAX, Q31_CONST(1.0));
+    EXPECT_EQ(INT32_C(-1073741824), q31_fromQ15(-16384));
+    EXPECT_EQ(32767, q15_fromQ31(INT32_MAX));
+    EXPECT_EQ(-32768, q15_fromQ31(INT32_MIN));
+    EXPECT_EQ(Q15_CONST(0.75), q15_fromQ(3, 2));
+    EXPECT_EQ(32767, q15_fromQ(5, 2));
+    EXPECT_EQ(Q15_CONST(0.5), q15_fromQ(1 << 23, 24));
+    EXPECT_EQ(8192, QMATH_ANGLE(45));
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              QmathTest.QMATH_sinCos()
+// Description:
+//! \brief      Sine and cosine of every binary angle vs libm
+//------------------------------------------------------------------------------
+TEST(QmathTest, QMATH_sinCos)
+{
+    double maxError = 0;
+
+    for(uint32_t angle = 0; angle < 65536; angle++)
+    {
+        double radians = 2*M_PI*angle/65536;
+        maxError = fmax(maxError, fabs(q15_sin((uint16_t)angle) -
+                                       32768*sin(radians)));
+        maxError = fmax(maxError, fabs(q15_cos((uint16_t)angle) -
+                                       32768*cos(radians)));
+    }
+    printf("[ BENCH    ] q15_sin/q15_cos max error %.2f LSB\n", maxError);
+    EXPECT_LT(maxError, 1.5);
+    EXPECT_EQ(32767, q15_sin(QMATH_ANGLE(90)));
+    EXPECT_EQ(-32767, q15_cos(QMATH_ANGLE(180)));
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              QmathTest.QMATH_cordic()
+// Description:
+//! \brief      CORDIC atan2 and magnitude over vector grid vs libm
+//------------------------------------------------------------------------------
+TEST(QmathTest, QMATH_cordic)
+{
+    double angleError = 0, magnitudeError = 0;
+
+    for(int32_t x = -32768; x < 32768; x += 97)
+    {
+        for(int32_t y = -32768; y < 32768; y += 89)
+        {
+            double expected = atan2(y, x)*32768/M_PI;
+            double angle = q15_atan2((q15_t)y, (q15_t)x);
+            double diff = fabs(angle - expected);
+
+            // -pi and pi are the same binary angle
+            angleError = fmax(angleError, fmin(diff, 65536 - diff));
+            magnitudeError = fmax(magnitudeError, fabs(q15_magnitude(
+                (q15_t)x, (q15_t)y) - sqrt((double)x*x + (double)y*y)));
+        }
+    }
+    printf("[ BENCH    ] CORDIC max error: angle %.2f units (%.4f deg), "
+           "magnitude %.2f LSB\n", angleError, angleError*360/65536,
+           magnitudeError);
+    EXPECT_LT(angleError, 4);
+    EXPECT_LT(magnitudeError, 2);
+
+    EXPECT_EQ(QMATH_ANGLE(90), q15_atan2(1000, 0));
+    EXPECT_EQ((int16_t)QMATH_ANGLE(-90), q15_atan2(-1000, 0));
+    EXPECT_NEAR(46341, q15_magnitude(-32768, -32768), 1);
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              QmathTest.QMATH_reciprocal()
+// Description:
+//! \brief      Reciprocal is exact for every 16-bit divisor, Q15 division
+//------------------------------------------------------------------------------
+TEST(QmathTest, QMATH_reciprocal)
+{
+    double divError = 0;
+
+    EXPECT_EQ(UINT32_MAX, qmath_reciprocal(0));
+    EXPECT_EQ(UINT32_MAX, qmath_reciprocal(1));
+    for(uint32_t d = 2; d <= UINT16_MAX; d++)
+        ASSERT_EQ((uint32_t)(0x100000000ull/d), qmath_reciprocal((uint16_t)d)) << d;
+
+    srand(43);
+    for(uint32_t index = 0; index < 1000000; index++)
+    {
+        q15_t num = (q15_t)(rand() % 65536 - 32768);
+        q15_t den = (q15_t)(rand() % 65536 - 32768);
+        double expected = fmax(-32768, fmin(32767, 32768.0*num/(den ? den : 1)));
+        if(den == 0)
+            continue;
+        divError = fmax(divError, fabs(q15_div(num, den) - expected));
+    }
+    printf("[ BENCH    ] q15_div max error %.2f LSB\n", divError);
+    EXPECT_LT(divError, 1.0);
+    EXPECT_EQ(16384, q15_div(1000, 2000));
+    EXPECT_EQ(-32768, q15_div(-5, 3));
+    EXPECT_EQ(32767, q15_div(5, 0));
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              QmathBenchmark.DISABLED_QMATH_timePerCall()
+// Description:
+//! \brief      Fixed-point kernels vs libm float (soft-float on MCU)
+//------------------------------------------------------------------------------
+TEST(QmathBenchmark, DISABLED_QMATH_timePerCall)
+{
+    static uint16_t angles[4096];
+    static q15_t xs[4096], ys[4096];
+    static float fx[4096], fy[4096];
+    const uint32_t rounds = 100;
+    double ns[6];
+    uint64_t start;
+    float sinkF = 0;
+
+    srand(4343);
+    for(int n = 0; n < 4096; n++)
+    {
+        angles[n] = (uint16_t)rand();
+        xs[n] = (q15_t)(rand() % 65536 - 32768);
+        ys[n] = (q15_t)(rand() % 65536 - 32768);
+        fx[n] = xs[n]/32768.0f;
+        fy[n] = ys[n]/32768.0f;
+    }
+
+    start = LIB_benchTimer();
+    for(uint32_t round = 0; round < rounds; round++)
+        for(int n = 0; n < 4096; n++)
+            LIB_benchSink += q15_sin((uint16_t)(angles[n] + round));
+    ns[0] = (double)(LIB_benchTimer() - start)/(rounds*4096);
+
+    start = LIB_benchTimer();
+    for(uint32_t round = 0; round < rounds; round++)
+        for(int n = 0; n < 4096; n++)
+            sinkF += sinf((angles[n] + round)*(float)(2*M_PI/65536));
+    ns[1] = (double)(LIB_benchTimer() - start)/(rounds*4096);
+
+    start = LIB_benchTimer();
+    for(uint32_t round = 0; round < rounds; round++)
+        for(int n = 0; n < 4096; n++)
+            LIB_benchSink += q15_atan2(ys[n], (q15_t)(xs[n] ^ round));
+    ns[2] = (double)(LIB_benchTimer() - start)/(rounds*4096);
+
+    start = LIB_benchTimer();
+    for(uint32_t round = 0; round < rounds; round++)
+        for(int n = 0; n < 4096; n++)
+            sinkF += atan2f(fy[n], fx[n] + round);
+    ns[3] = (double)(LIB_benchTimer() - start)/(rounds*4096);
+
+    start = LIB_benchTimer();
+    for(uint32_t round = 0; round < rounds; round++)
+        for(int n = 0; n < 4096; n++)
+            LIB_benchSink += qmath_reciprocal((uint16_t)(xs[n] + round));
+    ns[4] = (double)(LIB_benchTimer() - start)/(rounds*4096);
+
+    start = LIB_benchTimer();
+    for(uint32_t round = 0; round < rounds; round++)
+        for(int n = 0; n < 4096; n++)
+            LIB_benchSink += q15_div((q15_t)(ys[n] >> 1), (q15_t)(xs[n] | 0x4000));
+    ns[5] = (double)(LIB_benchTimer() - start)/(rounds*4096);
+
+    LIB_benchSink += (uint32_t)sinkF;
+    printf("[ BENCH    ] q15_sin %.2f (sinf %.2f), q15_atan2 %.2f (atan2f "
+           "%.2f), reciprocal %.2f, q15_div %.2f ns/call\n",
+           ns[0], ns[1], ns[2], ns[3], ns[4], ns[5]);
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              ByteorderTest.BYTEORDER_swap()
+// Description:
+//! \brief      Byte swaps vs byte assembly: all 16-bit values, every byte
+//!             value at every position of 32-bit word, random words
+//------------------------------------------------------------------------------
+TEST(ByteorderTest, BYTEORDER_swap)
+{
+    for(uint32_t x = 0; x <= UINT16_MAX; x++)
+    {
+        uint16_t expected = (uint16_t)(((x & 0xFF) << 8) | (x >> 8));
+        ASSERT_EQ(expected, bswap16((uint16_t)x)) << x;
+        ASSERT_EQ(expected, changeEndiannessWORD((uint16_t)x)) << x;
+    }
+
+    for(uint32_t shift = 0; shift < 32; shift += 8)
+    {
+        for(uint32_t value = 0; value < 256; value++)
+        {
+            uint32_t x = (value << shift) | (~0xFFul << shift & 0x5AA5C33Cul);
+            uint32_t expected = (x >> 24) | ((x >> 8) & 0xFF00) |
+                                ((x << 8) & 0xFF0000) | (x << 24);
+            ASSERT_EQ(expected, bswap32(x)) << x;
+            ASSERT_EQ(expected, (uint32_t)changeEndiannessDWORD(x)) << x;
+        }
+    }
+
+    srand(44);
+    for(uint32_t index = 0; index < 1000000; index++)
+    {
+        uint32_t x = ((uint32_t)rand() << 16) ^ (uint32_t)rand();
+        ASSERT_EQ(x, bswap32(bswap32(x)));
+        ASSERT_EQ((uint32_t)bswap16((uint16_t)x) << 16 | bswap16((uint16_t)(x >> 16)),
+                  bswap32(x));
+    }
+
+    // Argument with side effect is evaluated once, operators bind correctly
+    uint16_t words[2] = {0x1234, 0x5678}, *word = words;
+    EXPECT_EQ(0x3412, bswap16(*word++));
+    EXPECT_EQ(words + 1, word);
+    EXPECT_EQ(0x7856 + 1, changeEndiannessWORD(0x5678) + 1);
+    EXPECT_EQ(0x78563412ul, changeEndiannessDWORD(0x12345678));
+    EXPECT_EQ(0x12345678ul, bswap32(0x78563412));
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              ByteorderTest.BYTEORDER_loadStore()
+// Description:
+//! \brief      Loads/stores at every alignment: all 16-bit values, 32-bit
+//!             byte lanes, bytes around the field are not touched
+//------------------------------------------------------------------------------
+TEST(ByteorderTest, BYTEORDER_loadStore)
+{
+    uint8_t buffer[16];
+
+    for(uint32_t offset = 0; offset < 8; offset++)
+    {
+        uint8_t* field = buffer + offset;
+
+        for(uint32_t x = 0; x <= UINT16_MAX; x++)
+        {
+            field[0] = (uint8_t)x;
+            field[1] = (uint8_t)(x >> 8);
+            ASSERT_EQ(x, load_le16(field));
+            ASSERT_EQ(bswap16((uint16_t)x), load_be16(field));
+
+            memset(buffer, 0xEE, sizeof(buffer));
+            store_be16(field, (uint16_t)x);
+            ASSERT_EQ(x >> 8, field[0]);
+            ASSERT_EQ(x & 0xFF, field[1]);
+            ASSERT_EQ(x, load_be16(field));
+            store_le16(field, (uint16_t)x);
+            ASSERT_EQ(x, load_le16(field));
+            ASSERT_EQ(0xEE, field[2]);
+            if(offset)
+            {
+                ASSERT_EQ(0xEE, field[-1]);
+            }
+        }
+
+        for(uint32_t shift = 0; shift < 32; shift += 8)
+        {
+            for(uint32_t value = 0; value < 256; value++)
+            {
+                uint32_t x = (value << shift) | 0x01000000ul >> shift;
+
+                memset(buffer, 0xEE, sizeof(buffer));
+                store_le32(field, x);
+                ASSERT_EQ((uint8_t)x, field[0]);
+                ASSERT_EQ((uint8_t)(x >> 24), field[3]);
+                ASSERT_EQ(x, load_le32(field));
+                ASSERT_EQ(bswap32(x), load_be32(field));
+
+                store_be32(field, x);
+                ASSERT_EQ((uint8_t)(x >> 24), field[0]);
+                ASSERT_EQ((uint8_t)x, field[3]);
+                ASSERT_EQ(x, load_be32(field));
+                ASSERT_EQ(0xEE, field[4]);
+                if(offset)
+                {
+                    ASSERT_EQ(0xEE, field[-1]);
+                }
+            }
+        }
+    }
+
+    // Modbus RTU request: read 10 registers from 0x006B
+    const uint8_t frame[] = {0x11, 0x03, 0x00, 0x6B, 0x00, 0x0A, 0xC5, 0xCD};
+    EXPECT_EQ(0x006B, load_be16(&frame[2]));
+    EXPECT_EQ(0x000A, load_be16(&frame[4]));
+    EXPECT_EQ(0xCDC5, load_le16(&frame[6]));
+    EXPECT_EQ(0x1103006Bul, load_be32(&frame[0]));
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              ByteorderBenchmark.DISABLED_BYTEORDER_fieldsPerSecond()
+// Description:
+//! \brief      Unaligned big-endian fields: load_be32() vs byte assembly
+//------------------------------------------------------------------------------
+TEST(ByteorderBenchmark, DISABLED_BYTEORDER_fieldsPerSecond)
+{
+    static uint8_t wire[4096 + 3];
+    const uint32_t rounds = 1000;
+    double helper, bytes;
+    uint64_t start;
+
+    for(uint32_t n = 0; n < sizeof(wire); n++)
+        wire[n] = (uint8_t)(n*131);
+
+    start = LIB_benchTimer();
+    for(uint32_t round = 0; round < rounds; round++)
+    {
+        const uint8_t* p = wire + (round & 3);
+        for(uint32_t n = 0; n < 4096; n += 4)
+            LIB_benchSink += load_be32(p + n);
+    }
+    helper = (double)(LIB_benchTimer() - start)/(rounds*1024);
+
+    start = LIB_benchTimer();
+    for(uint32_t round = 0; round < rounds; round++)
+    {
+        const uint8_t* p = wire + (round & 3);
+        for(uint32_t n = 0; n < 4096; n += 4)
+        {
+            const uint8_t* b = p + n;
+            LIB_benchSink += ((uint32_t)b[0] << 24) | ((uint32_t)b[1] << 16) |
+                             ((uint32_t)b[2] << 8) | b[3];
+        }
+    }
+    bytes = (double)(LIB_benchTimer() - start)/(rounds*1024);
+
+    printf("[ BENCH    ] load_be32 %.2f ns/field, byte loads %.2f ns/field\n",
+           helper, bytes);
+}
+
+//------------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+    // Initialize Google Test Framework
+    testing::InitGoogleTest(&argc, argv);
+    // Run all tests
+    return RUN_ALL_TESTS();
+}
+
+//******************************************************************************
+// End of file
+//******************************************************************************
@@ -0,0 +1,51 @@
+#*******************************************************************************
+#   Filename:       Msp430SimTest.pro
+#
+#   Description:    Unit tests for MSP430F5x HAL on simulated registers
+#
+#   Author:         Bogdan Kokotenko
+#
+#   Revision date:  18/10/2026
+#
+#*******************************************************************************
+TEMPLATE = app
+CONFIG += console
+CONFIG -= app_bundle qt
+
+INCLUDEPATH +=  $$PWD/config \
+                $$PWD \
+                $$PWD/../ \
+                $$PWD/../../common \
+                $$PWD/../../common/hal \
+                $$PWD/../../common/hal/mcu/msp430f5x \
+                $$PWD/../../common/sys
+
+HEADERS +=  $$PWD/config/msp430.h \
+            $$PWD/config/clocks_config.h \
+            $$PWD/config/hal_config.h \
+            $$PWD/config/gpio_config.h \
+            $$PWD/config/stimer_config.h \
+            $$PWD/config/uart_config.h \
+            $$PWD/config/spi_config.h \
+            $$PWD/config/i2c_config.h \
+            $$PWD/config/timers_config.h \
+            $$PWD/msp430sim.h
+
+SOURCES +=  main.cpp \
+            $$PWD/msp430sim.c \
+            $$PWD/../../common/hal/mcu/msp430f5x/dma.c \
+            $$PWD/../../common/hal/mcu/msp430f5x/uart.c \
+            $$PWD/../../common/hal/mcu/msp430f5x/spi.c \
+            $$PWD/../../common/hal/mcu/msp430f5x/i2c.c
+
+# Device of register set, IAR vector pragmas are ignored
+DEFINES += __MSP430F5438A__
+QMAKE_CFLAGS += -Wno-unknown-pragmas
+
+# Google C++ Testing Framework
+DEFINES += UNIT_TEST
+include($$PWD/../../common/googletest/googletest.pri)
+
+#*******************************************************************************
+#   End of file
+#*******************************************************************************
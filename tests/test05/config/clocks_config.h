@@ -0,0 +1,42 @@
+//******************************************************************************
+// Copyright (C) 2026 Bogdan Kokotenko
+//
+//! \addtogroup test05
+//! @{
+//! \addtogroup test05_config
+//! @{
+//******************************************************************************
+//   File description:
+//! \file  test05/config/clocks_config.h
+//! \brief MSP430F5x clocks configuration
+//!
+//!*****************************************************************************
+//! __Revisions:__										
+//!  Date       | Author           | Comments			
+//!  ---------- | ---------------- | ----------------
+//!  18/10/2026 | Bogdan Kokotenko | Initial draft
+//
+//******************************************************************************
+#ifndef CLOCKS_CONFIG_H
+#define CLOCKS_CONFIG_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//! MCLK frequency (Hz)
+#define MCLK_FREQ           16000000L
+
+//! SMCLK frequency (Hz)
+#define SMCLK_FREQ          16000000
+
+#ifdef __cplusplus
+}
+#endif
+
+//! @}
+//! @}
+#endif // CLOCKS_CONFIG_H
+//******************************************************************************
+// End of file
+//******************************************************************************
@@ -0,0 +1,38 @@
+//******************************************************************************
+// Copyright (C) 2026 Bogdan Kokotenko
+//
+//! \addtogroup test05
+//! @{
+//! \addtogroup test05_config
+//! @{
+//******************************************************************************
+//   File description:
+//! \file  test05/config/gpio_config.h
+//! \brief MSP430F5x GPIO configuration
+//!
+//!*****************************************************************************
+//! __Revisions:__										
+//!  Date       | Author           | Comments			
+//!  ---------- | ---------------- | ----------------
+//!  18/10/2026 | Bogdan Kokotenko | Initial draft
+//
+//******************************************************************************
+#ifndef GPIO_CONFIG_H
+#define GPIO_CONFIG_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Default pins state is not used by simulation
+
+#ifdef __cplusplus
+}
+#endif
+
+//! @}
+//! @}
+#endif // GPIO_CONFIG_H
+//******************************************************************************
+// End of file
+//******************************************************************************
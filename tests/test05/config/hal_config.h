@@ -0,0 +1,39 @@
+//******************************************************************************
+// Copyright (C) 2026 Bogdan Kokotenko
+//
+//! \addtogroup test05
+//! @{
+//! \addtogroup test05_config
+//! @{
+//******************************************************************************
+//   File description:
+//! \file  test05/config/hal_config.h
+//! \brief MSP430F5x HAL configuration
+//!
+//!*****************************************************************************
+//! __Revisions:__										
+//!  Date       | Author           | Comments			
+//!  ---------- | ---------------- | ----------------
+//!  18/10/2026 | Bogdan Kokotenko | Initial draft
+//
+//******************************************************************************
+#ifndef HAL_CONFIG_H
+#define HAL_CONFIG_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//! Low-power mode is not used by simulation
+//#define USE_LOW_POWER_MODE_DCO
+
+#ifdef __cplusplus
+}
+#endif
+
+//! @}
+//! @}
+#endif // HAL_CONFIG_H
+//******************************************************************************
+// End of file
+//******************************************************************************
@@ -0,0 +1,55 @@
+//******************************************************************************
+// Copyright (C) 2026 Bogdan Kokotenko
+//
+//! \addtogroup test05
+//! @{
+//! \addtogroup test05_config
+//! @{
+//******************************************************************************
+//   File description:
+//! \file  test05/config/i2c_config.h
+//! \brief MSP430F5x I2C configuration
+//!
+//!*****************************************************************************
+//! __Revisions:__
+//!  Date       | Author           | Comments
+//!  ---------- | ---------------- | ----------------
+//!  18/10/2026 | Bogdan Kokotenko | Initial draft
+//
+//******************************************************************************
+#ifndef I2C_CONFIG_H
+#define I2C_CONFIG_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//! I2C0 (USCI_B1, USCI_B0 is used by SPI0) master
+#define I2C0_MASTER
+
+//! I2C0 registers access (simulation sees every CPU access)
+#define I2C0_REG(Reg)                                                          \
+                    (*(MSP430_SIM_i2cAccess(&UCB1##Reg), &UCB1##Reg))
+
+//! I2C0 interrupt vector
+#define I2C0_ISR_VECTOR         USCI_B1_VECTOR
+
+//! I2C0 clock source, baudrate and own address
+#define I2C0_CLK                SMCLK_FREQ
+#define I2C0_BAUDRATE           400000L
+#define I2C0_OWN_ADDRESS        0x01
+
+//! I2C0 pins (port 10 is not used by other drivers)
+#define I2C0_SDA_PIN            10, 1
+#define I2C0_SCL_PIN            10, 2
+
+#ifdef __cplusplus
+}
+#endif
+
+//! @}
+//! @}
+#endif // I2C_CONFIG_H
+//******************************************************************************
+// End of file
+//******************************************************************************
@@ -0,0 +1,227 @@
+//******************************************************************************
+// Copyright (C) 2026 Bogdan Kokotenko
+//
+//! \addtogroup test05
+//! @{
+//! \defgroup   test05_config MSP430F5x Simulation Configuration
+//! \brief      Simulated MSP430F5x registers and configurations
+//! @{
+//******************************************************************************
+//   File description:
+//! \file  test05/config/msp430.h
+//! \brief Simulated MSP430F5x registers (replaces device header on host)
+//!
+//! \details Registers are variables of msp430sim.c. Reads of DMAIV have the
+//!          device side effect (highest flag is cleared), other side effects
+//!          (RXBUF read by DMA, triggers, interrupts) are done by simulation
+//!          of USCI and DMA (msp430sim.h). USCI_B0 is accessed by SPI
+//!          driver through MSP430_SIM_spiAccess() (config/spi_config.h),
+//!          USCI_B1 is accessed by I2C driver through MSP430_SIM_i2cAccess()
+//!          (config/i2c_config.h). Delays run I2C bus events.
+//!
+//!*****************************************************************************
+//! __Revisions:__
+//!  Date       | Author           | Comments
+//!  ---------- | ---------------- | ----------------
+//!  18/10/2026 | Bogdan Kokotenko | Initial draft
+//!  18/10/2026 | Bogdan Kokotenko | Added Timer_B0 CCR0
+//!  18/10/2026 | Bogdan Kokotenko | Added USCI_B0 SPI registers
+//!  18/10/2026 | Bogdan Kokotenko | Added USCI_B1 I2C registers
+//
+//******************************************************************************
+#ifndef MSP430_H
+#define MSP430_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//------------------------------------------------------------------------------
+// Intrinsics
+#define __interrupt
+#define __even_in_range(Value, Range)   (Value)
+#define __delay_cycles(Cycles)          MSP430_SIM_delay(Cycles)
+#define __disable_interrupt()           (MSP430_SIM_gie = 0)
+#define __enable_interrupt()            (MSP430_SIM_gie = 1)
+#define __bis_SR_register(Bits)         ((void)(Bits))
+#define __bic_SR_register_on_exit(Bits) ((void)(Bits))
+
+//! DMA address registers hold host pointers
+#define DMA_writeAddress(Reg, Address)  ((Reg) = (uintptr_t)(Address))
+
+//! Global interrupt enable (SR.GIE)
+extern volatile uint8_t MSP430_SIM_gie;
+
+//! CPU delay (I2C bus event is done)
+void MSP430_SIM_delay(uint32_t cycles);
+
+//------------------------------------------------------------------------------
+// Interrupt vectors
+#define DMA_VECTOR          (50)
+#define USCI_A0_VECTOR      (57)
+#define USCI_B0_VECTOR      (56)
+#define USCI_A1_VECTOR      (46)
+#define USCI_B1_VECTOR      (45)
+#define TIMER0_B0_VECTOR    (59)
+
+#define WDTCTL              MSP430_SIM_wdtctl
+extern volatile uint16_t    MSP430_SIM_wdtctl;
+
+#define LPM0_bits           (0x0010)
+#define LPM3_bits           (0x00D0)
+
+//------------------------------------------------------------------------------
+// DMA
+extern volatile uint16_t DMACTL0, DMACTL1, DMACTL2, DMACTL3, DMACTL4;
+extern volatile uint16_t DMA0CTL, DMA1CTL, DMA2CTL;
+extern volatile uint16_t DMA0SZ, DMA1SZ, DMA2SZ;
+extern volatile uintptr_t DMA0SA, DMA1SA, DMA2SA;
+extern volatile uintptr_t DMA0DA, DMA1DA, DMA2DA;
+
+//! DMA interrupt vector (read clears the highest pending flag)
+uint16_t MSP430_SIM_readDmaiv(void);
+#define DMAIV               MSP430_SIM_readDmaiv()
+
+// DMACTL4
+#define ENNMI               (0x0001)
+#define ROUNDROBIN          (0x0002)
+#define DMARMWDIS           (0x0004)
+
+// DMAxCTL
+#define DMAREQ              (0x0001)
+#define DMAABORT            (0x0002)
+#define DMAIE               (0x0004)
+#define DMAIFG              (0x0008)
+#define DMAEN               (0x0010)
+#define DMALEVEL            (0x0020)
+#define DMASRCBYTE          (0x0040)
+#define DMADSTBYTE          (0x0080)
+#define DMASRCINCR_3        (0x0300)
+#define DMADSTINCR_3        (0x0C00)
+#define DMADT_0             (0x0000)
+#define DMADT_1             (0x1000)
+#define DMADT_4             (0x4000)
+#define DMADT_7             (0x7000)
+#define DMASWDW             (0x0000)
+#define DMASBDB             (DMASRCBYTE + DMADSTBYTE)
+
+// Trigger selection (MSP430F5438A)
+#define DMA0TSEL_31         (0x001F)
+#define DMA1TSEL_31         (0x1F00)
+#define DMA2TSEL_31         (0x001F)
+#define DMA0TSEL__DMA_REQ   (0)
+#define DMA0TSEL__USCIA0RX  (16)
+#define DMA0TSEL__USCIA0TX  (17)
+#define DMA0TSEL__USCIB0RX  (18)
+#define DMA0TSEL__USCIB0TX  (19)
+#define DMA0TSEL__USCIA1RX  (20)
+#define DMA0TSEL__USCIA1TX  (21)
+#define DMA0TSEL__USCIB1RX  (22)
+#define DMA0TSEL__USCIB1TX  (23)
+#define DMA0TSEL__ADC12IFG  (24)
+
+//------------------------------------------------------------------------------
+// Timer_B0 (same bits as Timer_A)
+extern volatile uint16_t TB0CTL, TB0CCTL0, TB0CCR0, TB0R;
+
+// TxCTL
+#define TACLR               (0x0004)
+#define MC_0                (0x0000)
+#define MC_1                (0x0010)
+#define MC_3                (0x0030)
+#define ID_0                (0x0000)
+#define ID_1                (0x0040)
+#define ID_2                (0x0080)
+#define ID_3                (0x00C0)
+#define TASSEL__SMCLK       (0x0200)
+
+// TxCCTLx
+#define CCIFG               (0x0001)
+#define CCIE                (0x0010)
+
+//------------------------------------------------------------------------------
+// USCI
+extern volatile uint8_t  UCA0CTL0, UCA0CTL1, UCA0BR0, UCA0BR1, UCA0MCTL;
+extern volatile uint8_t  UCA0STAT, UCA0IE, UCA0IFG;
+extern volatile uint16_t UCA0RXBUF, UCA0TXBUF, UCA0IV;
+extern volatile uint8_t  UCB0IFG, UCA1IFG, UCB1IFG;
+extern volatile uint8_t  UCB0CTL0, UCB0CTL1, UCB0BR0, UCB0BR1;
+extern volatile uint8_t  UCB0STAT, UCB0IE;
+extern volatile uint16_t UCB0RXBUF, UCB0TXBUF, UCA1RXBUF, UCA1TXBUF;
+extern volatile uint16_t UCB1RXBUF, UCB1TXBUF;
+
+extern volatile uint8_t  UCB1CTL0, UCB1CTL1, UCB1BR0, UCB1BR1;
+extern volatile uint8_t  UCB1STAT, UCB1IE;
+extern volatile uint16_t UCB1I2COA, UCB1I2CSA, UCB1IV;
+
+//! CPU access of USCI_B0 register (SPI shift engine runs before it)
+void MSP430_SIM_spiAccess(const volatile void* reg);
+
+//! CPU access of USCI_B1 register (I2C bus events are not done)
+void MSP430_SIM_i2cAccess(const volatile void* reg);
+
+// UCxCTL0 (SPI)
+#define UCSYNC              (0x01)
+#define UCMODE_2            (0x04)
+#define UCMODE_3            (0x06)
+#define UCMST               (0x08)
+#define UCMSB               (0x20)
+#define UCCKPL              (0x40)
+
+// UCAxCTL1
+#define UCSWRST             (0x01)
+#define UCTXSTT             (0x02)
+#define UCTXSTP             (0x04)
+#define UCTXNACK            (0x08)
+#define UCTR                (0x10)
+#define UCRXEIE             (0x20)
+#define UCSSEL__ACLK        (0x40)
+#define UCSSEL__SMCLK       (0x80)
+
+// UCAxMCTL
+#define UCBRS_0             (0x00)
+#define UCBRS_1             (0x02)
+#define UCBRS_2             (0x04)
+#define UCBRS_3             (0x06)
+#define UCBRS_4             (0x08)
+#define UCBRS_5             (0x0A)
+#define UCBRS_6             (0x0C)
+#define UCBRS_7             (0x0E)
+
+// UCAxSTAT
+#define UCBUSY              (0x01)
+#define UCOE                (0x20)
+#define UCFE                (0x40)
+#define UCBBUSY             (0x10)
+
+// UCBxI2COA
+#define UCGCEN              (0x8000)
+
+// UCAxIE/UCAxIFG
+#define UCRXIE              (0x01)
+#define UCTXIE              (0x02)
+#define UCRXIFG             (0x01)
+#define UCTXIFG             (0x02)
+
+// UCBxIE/UCBxIFG (I2C)
+#define UCSTTIE             (0x04)
+#define UCSTPIE             (0x08)
+#define UCALIE              (0x10)
+#define UCNACKIE            (0x20)
+#define UCSTTIFG            (0x04)
+#define UCSTPIFG            (0x08)
+#define UCALIFG             (0x10)
+#define UCNACKIFG           (0x20)
+
+#ifdef __cplusplus
+}
+#endif
+
+//! @}
+//! @}
+#endif // MSP430_H
+//******************************************************************************
+// End of file
+//******************************************************************************
@@ -0,0 +1,64 @@
+//******************************************************************************
+// Copyright (C) 2026 Bogdan Kokotenko
+//
+//! \addtogroup test05
+//! @{
+//! \addtogroup test05_config
+//! @{
+//******************************************************************************
+//   File description:
+//! \file  test05/config/spi_config.h
+//! \brief MSP430F5x SPI configuration
+//!
+//!*****************************************************************************
+//! __Revisions:__
+//!  Date       | Author           | Comments
+//!  ---------- | ---------------- | ----------------
+//!  18/10/2026 | Bogdan Kokotenko | Initial draft
+//
+//******************************************************************************
+#ifndef SPI_CONFIG_H
+#define SPI_CONFIG_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//! SPI0 (USCI_B0) master with completion handlers
+#define SPI0_MASTER
+#define SPI0_ASYNCHRONOUS
+
+//! SPI0 registers access (simulation sees every CPU access)
+#define SPI0_REG(Reg)                                                          \
+                    (*(MSP430_SIM_spiAccess(&UCB0##Reg), &UCB0##Reg))
+
+//! SPI0 clock source and baudrate
+#define SPI0_CLK                SMCLK_FREQ
+#define SPI0_BAUDRATE           8000000L
+
+//! SPI0 pins
+#define SPI0_SIMO_PIN           3, 1
+#define SPI0_SOMI_PIN           3, 2
+#define SPI0_SCLK_PIN           3, 3
+
+//------------------------------------------------------------------------------
+// SPI0 DMA channels: RX by DMA1, TX by DMA2 (shared with UART0 test cases)
+
+//! Receive bytes (NULL - discarded)
+#define SPI0_dmaRead(Data, Size, Handler)                                      \
+                            DMA1_USCI_read(Data, DMA_USCIB0RX, Size, Handler)
+
+//! Transmit bytes (NULL - dummy bytes)
+#define SPI0_dmaWrite(Data, Size, Handler)                                     \
+                            DMA2_USCI_write(DMA_USCIB0TX, Data, Size, Handler)
+
+#ifdef __cplusplus
+}
+#endif
+
+//! @}
+//! @}
+#endif // SPI_CONFIG_H
+//******************************************************************************
+// End of file
+//******************************************************************************
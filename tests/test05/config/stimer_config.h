@@ -0,0 +1,42 @@
+//******************************************************************************
+// Copyright (C) 2026 Bogdan Kokotenko
+//
+//! \addtogroup test05
+//! @{
+//! \addtogroup test05_config
+//! @{
+//******************************************************************************
+//   File description:
+//! \file  test05/config/stimer_config.h
+//! \brief Software timer configuration
+//!
+//!*****************************************************************************
+//! __Revisions:__										
+//!  Date       | Author           | Comments			
+//!  ---------- | ---------------- | ----------------
+//!  18/10/2026 | Bogdan Kokotenko | Initial draft
+//
+//******************************************************************************
+#ifndef STIMER_CONFIG_H
+#define STIMER_CONFIG_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//! Set the maximal number of timeouts in the software timer schedule
+#define STIMER_SCHEDULE_SIZE    5
+
+//! Define the time interval for software timer schedule check
+#define STIMER_LATENCY          1           // msec
+
+#ifdef __cplusplus
+}
+#endif
+
+//! @}
+//! @}
+#endif // STIMER_CONFIG_H
+//******************************************************************************
+// End of file
+//******************************************************************************
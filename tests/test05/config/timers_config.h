@@ -0,0 +1,38 @@
+//******************************************************************************
+// Copyright (C) 2026 Bogdan Kokotenko
+//
+//! \addtogroup test05
+//! @{
+//! \addtogroup test05_config
+//! @{
+//******************************************************************************
+//   File description:
+//! \file  test05/config/timers_config.h
+//! \brief MSP430F5x timers configuration
+//!
+//!*****************************************************************************
+//! __Revisions:__										
+//!  Date       | Author           | Comments			
+//!  ---------- | ---------------- | ----------------
+//!  18/10/2026 | Bogdan Kokotenko | Initial draft
+//
+//******************************************************************************
+#ifndef TIMERS_CONFIG_H
+#define TIMERS_CONFIG_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Timers are not used by simulation
+
+#ifdef __cplusplus
+}
+#endif
+
+//! @}
+//! @}
+#endif // TIMERS_CONFIG_H
+//******************************************************************************
+// End of file
+//******************************************************************************
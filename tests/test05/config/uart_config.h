@@ -0,0 +1,108 @@
+//******************************************************************************
+// Copyright (C) 2026 Bogdan Kokotenko
+//
+//! \addtogroup test05
+//! @{
+//! \addtogroup test05_config
+//! @{
+//******************************************************************************
+//   File description:
+//! \file  test05/config/uart_config.h
+//! \brief MSP430F5x UART configuration
+//!
+//!*****************************************************************************
+//! __Revisions:__										
+//!  Date       | Author           | Comments			
+//!  ---------- | ---------------- | ----------------
+//!  18/10/2026 | Bogdan Kokotenko | Initial draft
+//!  18/10/2026 | Bogdan Kokotenko | Added idle line detection timer
+//
+//******************************************************************************
+#ifndef UART_CONFIG_H
+#define UART_CONFIG_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//! Enable UART0 (USCI_A0)
+#define UART0_ENABLED
+
+//! UART0 registers access
+#define UART0_REG(Reg)          UCA0##Reg
+
+//! UART0 baudrate (bps)
+#define UART0_BAUDRATE          921600L
+
+//! UART0 pins
+#define UART0_TX_PIN            3, 4
+#define UART0_RX_PIN            3, 5
+
+//! RS485 driver enable pin
+#define UART0_RS485_RDE_PIN     3, 6
+
+//------------------------------------------------------------------------------
+// UART0 DMA channels: single packet RX by DMA0, TX by DMA2
+
+//! Receive packet
+#define UART0_dmaRead(Packet, Size, Handler)                                   \
+                            DMA0_USCI_read(Packet, DMA_USCIA0RX, Size, Handler)
+
+//! Transmit packet
+#define UART0_dmaWrite(Packet, Size, Handler)                                  \
+                            DMA2_USCI_write(DMA_USCIA0TX, Packet, Size, Handler)
+
+//! Check if packet reception has started
+#define UART0_isRxBufferChanged(Size)   DMA0_isSizeChanged(Size)
+
+//! Stop packet reception
+#define UART0_resetBuffer()     DMA0_reset()
+
+//! Size of received packet (DMA0 transfers left)
+#define UART0_getRxBufferSize() DMA0_getSize()
+
+//------------------------------------------------------------------------------
+// UART0 idle line detection: TB0 CCR0, restarted by DMA1 on every character
+
+//! Idle timer registers access
+#define UART0_IDLE_TIMER(Reg)       TB0##Reg
+
+//! Idle timer CCR0 interrupt vector
+#define UART0_IDLE_TIMER_VECTOR     TIMER0_B0_VECTOR
+
+//! Write timer control word on every received character
+#define UART0_dmaIdleRestart(Ctl, Value)                                       \
+                            DMA1_USCI_rxWrite(DMA_USCIA0RX, Ctl, Value)
+
+//! Stop timer restarts
+#define UART0_dmaIdleStop()     DMA1_reset()
+
+//------------------------------------------------------------------------------
+// UART0 continuous reception by DMA0/DMA1
+
+//! Start stream
+#define UART0_dmaStream(Buffer, Size, Handler)                                 \
+                            DMA01_USCI_stream(DMA_USCIA0RX, Buffer, Size, Handler)
+
+//! Stop stream
+#define UART0_dmaStreamStop()   DMA01_streamStop()
+
+//! Filled block of stream (NULL if none)
+#define UART0_getStreamBlock()  DMA01_streamGet()
+
+//! Release filled block
+#define UART0_releaseStreamBlock(Block) DMA01_streamRelease(Block)
+
+//! Blocks overwritten before release
+#define UART0_getStreamOverruns()   DMA01_streamOverruns()
+
+#ifdef __cplusplus
+}
+#endif
+
+//! @}
+//! @}
+#endif // UART_CONFIG_H
+//******************************************************************************
+// End of file
+//******************************************************************************
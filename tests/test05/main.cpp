@@ -0,0 +1,1033 @@
+//******************************************************************************
+// Copyright (C) 2026 Bogdan Kokotenko
+//
+//! \defgroup test05 Test05
+//! \brief Unit tests for MSP430F5x HAL on simulated registers
+//! \details See \ref test05/main.cpp
+//******************************************************************************
+//   File description:
+//! \file               test05/main.cpp
+//! \brief              Contains unit tests implementation
+//!
+//! \details MSP430F5x drivers are built for host with fake registers
+//!          (config/msp430.h), USCI receiver and DMA are simulated per
+//!          character (msp430sim.h). Scheduler, software timer and GPIO
+//!          are replaced by test doubles.
+//!
+//!*****************************************************************************
+//! __Revisions:__
+//!  Date       | Author           | Comments
+//!  ---------- | ---------------- | ----------------
+//!  18/10/2026 | Bogdan Kokotenko | Initial draft
+//!  18/10/2026 | Bogdan Kokotenko | Added idle line detection tests
+//!  18/10/2026 | Bogdan Kokotenko | Added SPI DMA transfer tests
+//!  18/10/2026 | Bogdan Kokotenko | Added I2C transaction engine tests
+//
+//******************************************************************************
+#include "project.h"
+#include "types.h"
+#include "hal.h"
+#include "clocks.h"
+#include "task.h"
+#include "dma.h"
+#include "uart.h"
+#include "spi.h"
+#include "i2c.h"
+#include "msp430sim.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+//------------------------------------------------------------------------------
+// Test doubles of scheduler, software timer and GPIO
+
+//! Posted tasks
+static std::vector<task_t> SIM_tasks;
+
+//! RS485 driver enable pin state
+static int SIM_rs485Rde = -1;
+
+//! Software timer starts
+static uint32_t SIM_stimerStarts = 0;
+
+//! I2C0 SCL pulses by GPIO (bus reset)
+static uint32_t SIM_i2cClocks = 0;
+
+//------------------------------------------------------------------------------
+// Function:
+//              SIM_isPin()
+// Description:
+//! \brief      Check if port/pin is the given one
+//------------------------------------------------------------------------------
+static bool SIM_isPin(uint8_t x, uint8_t y, uint8_t port, uint8_t pin)
+{
+    return x == port && y == pin;
+}
+
+extern "C" {
+
+bool TASK_createUnique(task_t handle)
+{
+    for(size_t index = 0; index < SIM_tasks.size(); index++)
+        if(SIM_tasks[index] == handle)
+            return false;
+    SIM_tasks.push_back(handle);
+    return true;
+}
+
+bool STIMER_add(task_t handle, int32_t timeout)
+{
+    (void)handle;
+    (void)timeout;
+    SIM_stimerStarts++;
+    return true;
+}
+
+bool STIMER_remove(task_t handle)
+{
+    (void)handle;
+    return true;
+}
+
+void GPIO_func1(uint8_t x, uint8_t y) { (void)x; (void)y; }
+void GPIO_func2(uint8_t x, uint8_t y) { (void)x; (void)y; }
+void GPIO_setIn(uint8_t x, uint8_t y) { (void)x; (void)y; }
+void GPIO_setOut(uint8_t x, uint8_t y) { (void)x; (void)y; }
+
+void GPIO_setLow(uint8_t x, uint8_t y)
+{
+    // SCL pulse releases one bit held by slave
+    if(SIM_isPin(x, y, I2C0_SCL_PIN))
+    {
+        SIM_i2cClocks++;
+        if(MSP430_SIM.i2cStuck)
+            MSP430_SIM.i2cStuck--;
+        return;
+    }
+    SIM_rs485Rde = 0;
+}
+
+void GPIO_setHigh(uint8_t x, uint8_t y)
+{
+    if(!SIM_isPin(x, y, I2C0_SCL_PIN))
+        SIM_rs485Rde = 1;
+}
+
+bool GPIO_test(uint8_t x, uint8_t y)
+{
+    // SDA is high, unless slave holds it
+    if(SIM_isPin(x, y, I2C0_SDA_PIN))
+        return MSP430_SIM.i2cStuck == 0;
+    return false;
+}
+
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              SIM_runTasks()
+// Description:
+//! \brief      Main loop iteration: run posted tasks
+//------------------------------------------------------------------------------
+static void SIM_runTasks(void)
+{
+    while(!SIM_tasks.empty())
+    {
+        task_t task = SIM_tasks.front();
+        SIM_tasks.erase(SIM_tasks.begin());
+        task();
+        MSP430_SIM_run();
+    }
+}
+
+//! Received data
+static std::vector<uint8_t> UART_received;
+
+//! Stream block size
+#define UART_BLOCK_SIZE     64
+
+//------------------------------------------------------------------------------
+// Function:
+//              UART_streamTask()
+// Description:
+//! \brief      Stream block handler (task)
+//------------------------------------------------------------------------------
+static void UART_streamTask(void)
+{
+    const uint8_t* block = UART0_getStreamBlock();
+
+    if(block)
+    {
+        UART_received.insert(UART_received.end(), block,
+                             block + UART_BLOCK_SIZE);
+        UART0_releaseStreamBlock(block);
+    }
+}
+
+//! Single packet reception buffer
+static uint8_t UART_packet[UART_BLOCK_SIZE];
+
+//------------------------------------------------------------------------------
+// Function:
+//              UART_packetTask()
+// Description:
+//! \brief      Packet handler (task): save packet, receive the next one
+//------------------------------------------------------------------------------
+static void UART_packetTask(void);
+
+//------------------------------------------------------------------------------
+// Function:
+//              UART_packetReceived()
+// Description:
+//! \brief      Packet reception complete (DMA ISR)
+//------------------------------------------------------------------------------
+static void UART_packetReceived(bool success)
+{
+    if(success)
+        TASK_createUnique(UART_packetTask);
+}
+
+static void UART_packetTask(void)
+{
+    UART_received.insert(UART_received.end(), UART_packet,
+                         UART_packet + UART_BLOCK_SIZE);
+    UART0_receive(UART_packet, UART_BLOCK_SIZE, UART_packetReceived);
+}
+
+//------------------------------------------------------------------------------
+// Class:
+//              UartStreamTestFixture
+// Description:
+//! \brief      Fixtures for UART0 reception on simulated USCI and DMA
+//------------------------------------------------------------------------------
+class UartStreamTestFixture : public ::testing::Test
+{
+protected:
+    uint8_t                 buffer[2*UART_BLOCK_SIZE];  //!< stream blocks
+    std::vector<uint8_t>    sent;                       //!< line data
+
+    //! Test case setup
+    void SetUp()
+    {
+        MSP430_SIM_reset();
+        SIM_tasks.clear();
+        UART_received.clear();
+        UART0_stopStream();
+        UART0_init(UART_921600);
+
+        srand(45);
+        sent.resize(64*1024);
+        for(size_t index = 0; index < sent.size(); index++)
+            sent[index] = (uint8_t)rand();
+    }
+
+    //! Receive line data, main loop runs tasks every taskPeriod characters
+    void receive(uint32_t taskPeriod)
+    {
+        for(size_t index = 0; index < sent.size(); index++)
+        {
+            MSP430_SIM_uartRx(sent[index]);
+            if((index + 1) % taskPeriod == 0)
+                SIM_runTasks();
+        }
+        // Line is idle: pending interrupts are served
+        MSP430_SIM.time += MSP430_SIM.irqLatency;
+        MSP430_SIM_run();
+        SIM_runTasks();
+    }
+};
+
+//------------------------------------------------------------------------------
+// Function:
+//              UartStreamTest.UART_streamContinuous()
+// Description:
+//! \brief      64 KB back-to-back at 921600 baud: nothing is lost
+//------------------------------------------------------------------------------
+TEST_F(UartStreamTestFixture, UART_streamContinuous)
+{
+    // ISR is late by one character (10.8 us), main loop every 16 characters
+    MSP430_SIM.irqLatency = 1;
+    ASSERT_TRUE(UART0_startStream(buffer, UART_BLOCK_SIZE, UART_streamTask));
+    ASSERT_EQ(0, SIM_rs485Rde);
+    ASSERT_FALSE(UART0_startStream(buffer, UART_BLOCK_SIZE, UART_streamTask));
+
+    receive(16);
+
+    ASSERT_EQ(0u, MSP430_SIM.rxOverruns);
+    ASSERT_EQ(0u, UART0_getStreamOverruns());
+    ASSERT_EQ(sent.size(), UART_received.size());
+    ASSERT_TRUE(sent == UART_received);
+    ASSERT_EQ(0u, DMA01_streamPending());
+
+    printf("[ BENCH    ] stream: %u bytes, %u lost, %.1f DMA interrupts/KB\n",
+           (unsigned)sent.size(), (unsigned)MSP430_SIM.rxOverruns,
+           MSP430_SIM.interrupts*1024.0/sent.size());
+
+    // Partial block is counted by pending bytes
+    for(int index = 0; index < 10; index++)
+        MSP430_SIM_uartRx(0x55);
+    ASSERT_EQ(10u, DMA01_streamPending());
+
+    UART0_stopStream();
+    MSP430_SIM_uartRx(0xAA);
+    ASSERT_EQ(0u, MSP430_SIM.rxOverruns);
+    MSP430_SIM_uartRx(0xAA);
+    ASSERT_EQ(1u, MSP430_SIM.rxOverruns);
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              UartStreamTest.UART_streamIsrLatency()
+// Description:
+//! \brief      ISR later than two characters: USCI overrun is detected
+//------------------------------------------------------------------------------
+TEST_F(UartStreamTestFixture, UART_streamIsrLatency)
+{
+    MSP430_SIM.irqLatency = 3;
+    ASSERT_TRUE(UART0_startStream(buffer, UART_BLOCK_SIZE, UART_streamTask));
+
+    receive(16);
+
+    // Up to one character per block switch is lost
+    ASSERT_GT(MSP430_SIM.rxOverruns, 0u);
+    ASSERT_LE(MSP430_SIM.rxOverruns, sent.size()/UART_BLOCK_SIZE);
+    ASSERT_EQ(0u, UART0_getStreamOverruns());
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              UartStreamTest.UART_streamSlowTask()
+// Description:
+//! \brief      Block not released in time is counted, reception goes on
+//------------------------------------------------------------------------------
+TEST_F(UartStreamTestFixture, UART_streamSlowTask)
+{
+    MSP430_SIM.irqLatency = 0;
+    ASSERT_TRUE(UART0_startStream(buffer, UART_BLOCK_SIZE, UART_streamTask));
+
+    // Main loop every 3 blocks: only every other block is taken
+    receive(3*UART_BLOCK_SIZE);
+
+    ASSERT_EQ(0u, MSP430_SIM.rxOverruns);
+    ASSERT_GT(UART0_getStreamOverruns(), 0u);
+    ASSERT_EQ(sent.size(),
+              UART_received.size() +
+              UART0_getStreamOverruns()*UART_BLOCK_SIZE);
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              UartStreamTest.UART_packetReceiveGap()
+// Description:
+//! \brief      Single packet reception re-armed by task loses characters
+//------------------------------------------------------------------------------
+TEST_F(UartStreamTestFixture, UART_packetReceiveGap)
+{
+    MSP430_SIM.irqLatency = 1;
+    UART0_receive(UART_packet, UART_BLOCK_SIZE, UART_packetReceived);
+
+    receive(16);
+
+    size_t lost = sent.size() - UART_received.size();
+    printf("[ BENCH    ] packet mode: %u bytes, %u lost (%.1f%%)\n",
+           (unsigned)sent.size(), (unsigned)lost, 100.0*lost/sent.size());
+    ASSERT_GT(lost, 0u);
+}
+
+//! Frame reception result: -1 - pending, 0 - short frame, 1 - complete
+static int UART_frameResult;
+
+//! Character times from the last character to frame handler
+static uint32_t UART_frameDelay;
+
+//! Time of the last character
+static uint32_t UART_lastCharTime;
+
+//------------------------------------------------------------------------------
+// Function:
+//              UART_frameReceived()
+// Description:
+//! \brief      Frame reception handler (ISR)
+//------------------------------------------------------------------------------
+static void UART_frameReceived(bool success)
+{
+    UART_frameResult = success;
+    UART_frameDelay = MSP430_SIM.time - UART_lastCharTime;
+}
+
+//------------------------------------------------------------------------------
+// Class:
+//              UartIdleTestFixture
+// Description:
+//! \brief      Fixtures for UART0 frame delimiting by idle line
+//------------------------------------------------------------------------------
+class UartIdleTestFixture : public ::testing::TestWithParam<UART_BAUDRATE_t>
+{
+protected:
+    //! Test case setup
+    void SetUp()
+    {
+        static const uint32_t baudrate[] = { 9600, 115200, 921600 };
+
+        MSP430_SIM_reset();
+        MSP430_SIM.timerTicks = (10*SMCLK_FREQ)/baudrate[GetParam()];
+        SIM_stimerStarts = 0;
+        UART0_stopStream();
+        UART0_init(GetParam());
+        UART_frameResult = -1;
+        UART_frameDelay = 0;
+    }
+
+    //! Receive characters with gap (character times) between them
+    void receive(uint32_t count, uint32_t gap)
+    {
+        for(uint32_t index = 0; index < count; index++)
+        {
+            if(index)
+                MSP430_SIM_idle(gap);
+            MSP430_SIM_uartRx((uint8_t)index);
+            UART_lastCharTime = MSP430_SIM.time;
+        }
+    }
+};
+
+//------------------------------------------------------------------------------
+// Function:
+//              UartIdleTest.UART_idleShortFrame()
+// Description:
+//! \brief      Short frame is delimited within one character after 3.5
+//------------------------------------------------------------------------------
+TEST_P(UartIdleTestFixture, UART_idleShortFrame)
+{
+    UART0_receive(UART_packet, UART_BLOCK_SIZE, UART_frameReceived);
+
+    // Timer does not run till the first character
+    MSP430_SIM_idle(100);
+    ASSERT_EQ(-1, UART_frameResult);
+    ASSERT_EQ(0u, MSP430_SIM.timerInterrupts);
+
+    // Gaps up to 2 characters are inside the frame
+    receive(10, 2);
+    ASSERT_EQ(-1, UART_frameResult);
+
+    MSP430_SIM_idle(10);
+    ASSERT_EQ(0, UART_frameResult);
+    ASSERT_EQ(10u, UART0_getReceivedSize());
+    ASSERT_GE(UART_frameDelay, 4u);
+    ASSERT_LE(UART_frameDelay, 5u);
+
+    // Single interrupt per frame, no software timer polling
+    ASSERT_EQ(1u, MSP430_SIM.timerInterrupts);
+    ASSERT_EQ(0u, SIM_stimerStarts);
+    for(int index = 0; index < 10; index++)
+    {
+        ASSERT_EQ(index, UART_packet[index]);
+    }
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              UartIdleTest.UART_idleCompleteFrame()
+// Description:
+//! \brief      Complete frame stops idle detection
+//------------------------------------------------------------------------------
+TEST_P(UartIdleTestFixture, UART_idleCompleteFrame)
+{
+    UART0_receive(UART_packet, UART_BLOCK_SIZE, UART_frameReceived);
+
+    receive(UART_BLOCK_SIZE, 0);
+    ASSERT_EQ(1, UART_frameResult);
+    ASSERT_EQ((uint32_t)UART_BLOCK_SIZE, UART0_getReceivedSize());
+
+    MSP430_SIM_idle(10);
+    receive(10, 0);
+    MSP430_SIM_idle(10);
+    ASSERT_EQ(0u, MSP430_SIM.timerInterrupts);
+    ASSERT_EQ(0, TB0CTL & MC_3);
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              UartIdleTest.UART_idleFrameGap()
+// Description:
+//! \brief      Gap of 4 characters splits the frame
+//------------------------------------------------------------------------------
+TEST_P(UartIdleTestFixture, UART_idleFrameGap)
+{
+    UART0_receive(UART_packet, UART_BLOCK_SIZE, UART_frameReceived);
+
+    receive(5, 4);
+    ASSERT_EQ(0, UART_frameResult);
+    ASSERT_EQ(1u, UART0_getReceivedSize());
+}
+
+INSTANTIATE_TEST_CASE_P(UartIdleTest, UartIdleTestFixture,
+                        ::testing::Values(UART_9600, UART_115200,
+                                          UART_921600));
+
+//! SPI transfer complete handler calls
+static uint32_t SPI_completeCount;
+
+//! SPI bytes shifted when handler was called
+static uint32_t SPI_completeBytes;
+
+//------------------------------------------------------------------------------
+// Function:
+//              SPI_complete()
+// Description:
+//! \brief      SPI transfer complete handler (DMA ISR)
+//------------------------------------------------------------------------------
+static void SPI_complete(void)
+{
+    SPI_completeCount++;
+    SPI_completeBytes = MSP430_SIM.spiBytes;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              SPI_slave()
+// Description:
+//! \brief      SPI slave model: MISO is inverted MOSI
+//------------------------------------------------------------------------------
+static uint8_t SPI_slave(uint8_t mosi)
+{
+    return (uint8_t)~mosi;
+}
+
+//------------------------------------------------------------------------------
+// Class:
+//              SpiDmaTestFixture
+// Description:
+//! \brief      Fixtures for SPI0 (USCI_B0) transfers by DMA1/DMA2
+//------------------------------------------------------------------------------
+class SpiDmaTestFixture : public ::testing::Test
+{
+protected:
+    uint8_t tx[512];                    //!< transmitted data
+    uint8_t rx[512];                    //!< received data
+
+    //! Test case setup
+    void SetUp()
+    {
+        MSP430_SIM_reset();
+        MSP430_SIM.spiSlave = SPI_slave;
+        SPI0_init();
+        MSP430_SIM_run();
+        MSP430_SIM.spiAccesses = 0;
+        SPI_completeCount = 0;
+        SPI_completeBytes = 0;
+
+        srand(49);
+        for(size_t index = 0; index < sizeof(tx); index++)
+            tx[index] = (uint8_t)rand();
+        memset(rx, 0x55, sizeof(rx));
+    }
+};
+
+//------------------------------------------------------------------------------
+// Function:
+//              SpiDmaTest.SPI_dmaExchange()
+// Description:
+//! \brief      Full-duplex transfer: CPU does not poll the bus
+//------------------------------------------------------------------------------
+TEST_F(SpiDmaTestFixture, SPI_dmaExchange)
+{
+    const uint16_t size = sizeof(tx);
+
+    SPI0_exchange(rx, tx, size, SPI_complete);
+    ASSERT_TRUE(SPI0_isBusy());
+    ASSERT_EQ(0u, SPI_completeCount);
+    uint32_t accesses = MSP430_SIM.spiAccesses;
+
+    MSP430_SIM_run();
+    ASSERT_EQ(1u, SPI_completeCount);
+    ASSERT_EQ((uint32_t)size, SPI_completeBytes);
+    ASSERT_FALSE(SPI0_isBusy());
+    ASSERT_EQ(0u, MSP430_SIM.spiOverruns);
+    ASSERT_EQ(0, memcmp(tx, MSP430_SIM.spiLog, size));
+    for(uint16_t index = 0; index < size; index++)
+    {
+        ASSERT_EQ((uint8_t)~tx[index], rx[index]);
+    }
+
+    // Receive channel interrupt only
+    ASSERT_EQ(1u, MSP430_SIM.interrupts);
+    printf("[ BENCH    ] DMA exchange: %u register accesses for %u bytes\n",
+           (unsigned)accesses, (unsigned)size);
+    ASSERT_LE(accesses, 4u);
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              SpiDmaTest.SPI_dmaTransmit()
+// Description:
+//! \brief      TX-only transfer: received bytes are discarded, handler is
+//!             called after the last byte is shifted
+//------------------------------------------------------------------------------
+TEST_F(SpiDmaTestFixture, SPI_dmaTransmit)
+{
+    const uint16_t size = 300;
+
+    SPI0_transmit(tx, size, SPI_complete);
+    MSP430_SIM_run();
+    ASSERT_EQ(1u, SPI_completeCount);
+    ASSERT_EQ((uint32_t)size, SPI_completeBytes);
+    ASSERT_EQ(0, memcmp(tx, MSP430_SIM.spiLog, size));
+
+    // RXBUF is read for every byte, caller data are kept
+    ASSERT_EQ(0u, MSP430_SIM.spiOverruns);
+    ASSERT_EQ(0, UCB0STAT & UCOE);
+    ASSERT_EQ(0, UCB0IFG & UCRXIFG);
+    ASSERT_EQ(0x55, rx[0]);
+
+    // Bus is free for the next transfer
+    SPI0_transmit(tx, size, SPI_complete);
+    MSP430_SIM_run();
+    ASSERT_EQ(2u, SPI_completeCount);
+    ASSERT_EQ(2u*size, MSP430_SIM.spiBytes);
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              SpiDmaTest.SPI_dmaReceive()
+// Description:
+//! \brief      RX-only transfer: dummy bytes are transmitted
+//------------------------------------------------------------------------------
+TEST_F(SpiDmaTestFixture, SPI_dmaReceive)
+{
+    const uint16_t size = 64;
+
+    SPI0_receive(rx, size, SPI_complete);
+    MSP430_SIM_run();
+    ASSERT_EQ(1u, SPI_completeCount);
+    for(uint16_t index = 0; index < size; index++)
+    {
+        ASSERT_EQ(0x00, MSP430_SIM.spiLog[index]);
+        ASSERT_EQ(0xFF, rx[index]);
+    }
+    ASSERT_EQ(0x55, rx[size]);
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              SpiDmaTest.SPI_pollShort()
+// Description:
+//! \brief      Transfer below DMA threshold is polled and completes in place
+//------------------------------------------------------------------------------
+TEST_F(SpiDmaTestFixture, SPI_pollShort)
+{
+    const uint16_t size = SPI0_DMA_THRESHOLD - 1;
+
+    SPI0_exchange(rx, tx, size, SPI_complete);
+    ASSERT_EQ(1u, SPI_completeCount);
+    ASSERT_FALSE(SPI0_isBusy());
+    ASSERT_EQ(0u, MSP430_SIM.interrupts);
+    ASSERT_EQ(0u, MSP430_SIM.dmaTransfers);
+    for(uint16_t index = 0; index < size; index++)
+    {
+        ASSERT_EQ((uint8_t)~tx[index], rx[index]);
+    }
+
+    // DMA is used from threshold
+    SPI0_exchange(rx, tx, SPI0_DMA_THRESHOLD, SPI_complete);
+    ASSERT_EQ(1u, SPI_completeCount);
+    MSP430_SIM_run();
+    ASSERT_EQ(2u, SPI_completeCount);
+    ASSERT_EQ(2u*SPI0_DMA_THRESHOLD - 1, MSP430_SIM.dmaTransfers);
+}
+
+//------------------------------------------------------------------------------
+// I2C transaction engine
+
+//! I2C slave device model
+struct I2C_Device_t{
+    uint8_t address;                    //!< slave address
+    uint8_t regs[256];                  //!< registers
+    uint8_t pointer;                    //!< register pointer
+    bool    first;                      //!< next written byte is pointer
+    uint8_t readOnly;                   //!< first read-only register (NACK)
+};
+
+//! I2C slave devices
+static I2C_Device_t I2C_devices[2];
+
+//! Addressed I2C slave device
+static I2C_Device_t* I2C_device;
+
+//! Scripts completion handler calls
+static uint32_t I2C_completeCount;
+
+//------------------------------------------------------------------------------
+// Function:
+//              I2C_start()
+// Description:
+//! \brief      I2C slave model: device ACKs own address
+//------------------------------------------------------------------------------
+static bool I2C_start(uint8_t address, bool read)
+{
+    I2C_device = NULL;
+    for(size_t index = 0; index < 2; index++)
+        if(I2C_devices[index].address == address)
+            I2C_device = &I2C_devices[index];
+    if(I2C_device)
+        I2C_device->first = !read;
+    return I2C_device != NULL;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              I2C_write()
+// Description:
+//! \brief      I2C slave model: register pointer, then registers, write
+//!             to read-only register is NACKed
+//------------------------------------------------------------------------------
+static bool I2C_write(uint8_t data)
+{
+    if(!I2C_device->first && I2C_device->pointer >= I2C_device->readOnly)
+        return false;
+    if(I2C_device->first)
+        I2C_device->pointer = data;
+    else
+        I2C_device->regs[I2C_device->pointer++] = data;
+    I2C_device->first = false;
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              I2C_read()
+// Description:
+//! \brief      I2C slave model: registers from the pointer
+//------------------------------------------------------------------------------
+static uint8_t I2C_read(void)
+{
+    return I2C_device->regs[I2C_device->pointer++];
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              I2C_complete()
+// Description:
+//! \brief      Scripts completion handler (ISR)
+//------------------------------------------------------------------------------
+static void I2C_complete(void)
+{
+    I2C_completeCount++;
+}
+
+//------------------------------------------------------------------------------
+// Class:
+//              I2cScriptTestFixture
+// Description:
+//! \brief      Fixtures for I2C0 (USCI_B1) transaction scripts
+//------------------------------------------------------------------------------
+class I2cScriptTestFixture : public ::testing::Test
+{
+protected:
+    uint8_t rx[16];                     //!< received data
+
+    //! Test case setup
+    void SetUp()
+    {
+        MSP430_SIM_reset();
+        MSP430_SIM.i2cStart = I2C_start;
+        MSP430_SIM.i2cWrite = I2C_write;
+        MSP430_SIM.i2cRead = I2C_read;
+        ASSERT_TRUE(I2C0_init());
+        MSP430_SIM_run();
+        I2C_completeCount = 0;
+        SIM_i2cClocks = 0;
+        SIM_tasks.clear();
+
+        I2C_devices[0].address = 0x48;
+        I2C_devices[1].address = 0x1E;
+        I2C_devices[0].readOnly = 0xFF;
+        I2C_devices[1].readOnly = 0xFF;
+        for(size_t index = 0; index < 256; index++)
+        {
+            I2C_devices[0].regs[index] = (uint8_t)index;
+            I2C_devices[1].regs[index] = (uint8_t)(0xFF - index);
+        }
+        memset(rx, 0x55, sizeof(rx));
+    }
+};
+
+//------------------------------------------------------------------------------
+// Function:
+//              I2cScriptTest.I2C_registerRead()
+// Description:
+//! \brief      Register address, repeated start, read: one completion
+//------------------------------------------------------------------------------
+TEST_F(I2cScriptTestFixture, I2C_registerRead)
+{
+    static const uint8_t reg = 0x10;
+    const I2C_Step_t steps[] = {
+        I2C_STEP_WRITE(0x48, &reg, 1),
+        I2C_STEP_READ(0x48, rx, 4)
+    };
+    I2C_Script_t script = { steps, 2, 0, 0 };
+
+    ASSERT_TRUE(I2C0_runScripts(&script, 1, I2C_complete));
+    ASSERT_TRUE(I2C0_isScriptRunning());
+    MSP430_SIM_run();
+
+    ASSERT_EQ(1u, I2C_completeCount);
+    ASSERT_FALSE(I2C0_isScriptRunning());
+    ASSERT_EQ(I2C_SCRIPT_DONE, script.state);
+    ASSERT_EQ(2u, script.done);
+    ASSERT_STREQ("S 90 10 S 91 10 11 12 13N P", MSP430_SIM.i2cTrace);
+    for(uint8_t index = 0; index < 4; index++)
+    {
+        ASSERT_EQ(reg + index, rx[index]);
+    }
+    ASSERT_EQ(0x55, rx[4]);
+
+    // Whole script from ISR, main loop is not involved
+    ASSERT_TRUE(SIM_tasks.empty());
+    printf("[ BENCH    ] I2C register read: %u interrupts, 1 completion\n",
+           (unsigned)MSP430_SIM.i2cInterrupts);
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              I2cScriptTest.I2C_singleByteRead()
+// Description:
+//! \brief      Single byte is NACKed by master and followed by stop
+//------------------------------------------------------------------------------
+TEST_F(I2cScriptTestFixture, I2C_singleByteRead)
+{
+    static const uint8_t reg = 0x05;
+    const I2C_Step_t steps[] = {
+        I2C_STEP_WRITE(0x1E, &reg, 1),
+        I2C_STEP_READ(0x1E, rx, 1)
+    };
+    I2C_Script_t script = { steps, 2, 0, 0 };
+
+    ASSERT_TRUE(I2C0_runScripts(&script, 1, I2C_complete));
+    MSP430_SIM_run();
+
+    ASSERT_EQ(1u, I2C_completeCount);
+    ASSERT_EQ(I2C_SCRIPT_DONE, script.state);
+    ASSERT_STREQ("S 3C 05 S 3D FAN P", MSP430_SIM.i2cTrace);
+    ASSERT_EQ(0xFA, rx[0]);
+    ASSERT_EQ(0x55, rx[1]);
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              I2cScriptTest.I2C_burstWrite()
+// Description:
+//! \brief      Register address and data from different buffers without
+//!             restart
+//------------------------------------------------------------------------------
+TEST_F(I2cScriptTestFixture, I2C_burstWrite)
+{
+    static const uint8_t reg = 0x20;
+    static const uint8_t data[] = { 0xAA, 0xBB, 0xCC };
+    const I2C_Step_t steps[] = {
+        I2C_STEP_WRITE(0x48, &reg, 1),
+        I2C_STEP_WRITE_MORE(data, sizeof(data)),
+        I2C_STEP_WRITE(0x48, &reg, 1),
+        I2C_STEP_READ(0x48, rx, 3)
+    };
+    I2C_Script_t script = { steps, 4, 0, 0 };
+
+    ASSERT_TRUE(I2C0_runScripts(&script, 1, I2C_complete));
+    MSP430_SIM_run();
+
+    ASSERT_EQ(1u, I2C_completeCount);
+    ASSERT_EQ(I2C_SCRIPT_DONE, script.state);
+    ASSERT_EQ(4u, script.done);
+    ASSERT_STREQ("S 90 20 AA BB CC S 90 20 S 91 AA BB CCN P",
+                 MSP430_SIM.i2cTrace);
+    ASSERT_EQ(0, memcmp(data, &I2C_devices[0].regs[reg], sizeof(data)));
+    ASSERT_EQ(0, memcmp(data, rx, sizeof(data)));
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              I2cScriptTest.I2C_lastByteNack()
+// Description:
+//! \brief      Last data byte NACKed by slave fails the script, the stop
+//!             is awaited out of ISR
+//------------------------------------------------------------------------------
+TEST_F(I2cScriptTestFixture, I2C_lastByteNack)
+{
+    static const uint8_t reg = 0x20;
+    static const uint8_t data[] = { 0xAA, 0xBB, 0xCC };
+    const I2C_Step_t steps[2][2] = {
+        { I2C_STEP_WRITE(0x48, &reg, 1),
+          I2C_STEP_WRITE_MORE(data, sizeof(data)) },
+        { I2C_STEP_WRITE(0x1E, &reg, 1),
+          I2C_STEP_WRITE_MORE(data, sizeof(data)) }
+    };
+    I2C_Script_t scripts[2] = {
+        { steps[0], 2, 0, 0 },
+        { steps[1], 2, 0, 0 }
+    };
+
+    // Register 0x22 of the first device is read-only
+    I2C_devices[0].readOnly = 0x22;
+    ASSERT_TRUE(I2C0_runScripts(scripts, 2, I2C_complete));
+    MSP430_SIM_run();
+
+    // ISR does not wait for stop: it is awaited by tasklet
+    ASSERT_EQ(0u, I2C_completeCount);
+    ASSERT_EQ(1u, SIM_tasks.size());
+    SIM_runTasks();
+
+    ASSERT_EQ(1u, I2C_completeCount);
+    ASSERT_EQ(I2C_SCRIPT_NACK, scripts[0].state);
+    ASSERT_EQ(1u, scripts[0].done);
+    ASSERT_EQ(I2C_SCRIPT_DONE, scripts[1].state);
+    ASSERT_EQ(2u, scripts[1].done);
+    ASSERT_STREQ("S 90 20 AA BB CCN P S 3C 20 AA BB CC P",
+                 MSP430_SIM.i2cTrace);
+    ASSERT_EQ(0, memcmp(data, &I2C_devices[1].regs[reg], sizeof(data)));
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              I2cScriptTest.I2C_pollingList()
+// Description:
+//! \brief      Devices are polled back-to-back, missing device is NACKed
+//------------------------------------------------------------------------------
+TEST_F(I2cScriptTestFixture, I2C_pollingList)
+{
+    static const uint8_t reg = 0x00;
+    uint8_t data[3][2];
+    const I2C_Step_t steps[3][2] = {
+        { I2C_STEP_WRITE(0x48, &reg, 1), I2C_STEP_READ(0x48, data[0], 2) },
+        { I2C_STEP_WRITE(0x30, &reg, 1), I2C_STEP_READ(0x30, data[1], 2) },
+        { I2C_STEP_WRITE(0x1E, &reg, 1), I2C_STEP_READ(0x1E, data[2], 2) }
+    };
+    I2C_Script_t scripts[3] = {
+        { steps[0], 2, 0, 0 },
+        { steps[1], 2, 0, 0 },
+        { steps[2], 2, 0, 0 }
+    };
+
+    ASSERT_TRUE(I2C0_runScripts(scripts, 3, I2C_complete));
+    MSP430_SIM_run();
+    SIM_runTasks();
+
+    ASSERT_EQ(1u, I2C_completeCount);
+    ASSERT_EQ(I2C_SCRIPT_DONE, scripts[0].state);
+    ASSERT_EQ(I2C_SCRIPT_NACK, scripts[1].state);
+    ASSERT_EQ(0u, scripts[1].done);
+    ASSERT_EQ(I2C_SCRIPT_DONE, scripts[2].state);
+    ASSERT_STREQ("S 90 00 S 91 00 01N P S 60N P S 3C 00 S 3D FF FEN P",
+                 MSP430_SIM.i2cTrace);
+    ASSERT_EQ(0x01, data[0][1]);
+    ASSERT_EQ(0xFE, data[2][1]);
+
+    // Engine is free for the next list
+    ASSERT_TRUE(I2C0_runScripts(scripts, 1, I2C_complete));
+    MSP430_SIM_run();
+    SIM_runTasks();
+    ASSERT_EQ(2u, I2C_completeCount);
+    ASSERT_EQ(7u, MSP430_SIM.i2cStarts);
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              I2cScriptTest.I2C_busRecovery()
+// Description:
+//! \brief      Bus held by slave is reset, the list goes on
+//------------------------------------------------------------------------------
+TEST_F(I2cScriptTestFixture, I2C_busRecovery)
+{
+    static const uint8_t reg = 0x04;
+    const I2C_Step_t steps[] = {
+        I2C_STEP_WRITE(0x48, &reg, 1),
+        I2C_STEP_READ(0x48, rx, 2)
+    };
+    I2C_Script_t scripts[2] = { { steps, 2, 0, 0 }, { steps, 2, 0, 0 } };
+
+    MSP430_SIM.i2cStuck = 3;
+    ASSERT_TRUE(I2C0_runScripts(scripts, 2, I2C_complete));
+    MSP430_SIM_run();
+    SIM_runTasks();
+
+    ASSERT_EQ(1u, I2C_completeCount);
+    ASSERT_EQ(I2C_SCRIPT_BUS_ERROR, scripts[0].state);
+    ASSERT_EQ(I2C_SCRIPT_DONE, scripts[1].state);
+    ASSERT_EQ(3u, SIM_i2cClocks);
+    ASSERT_STREQ("AL S 90 04 S 91 04 05N P", MSP430_SIM.i2cTrace);
+    ASSERT_EQ(0x05, rx[1]);
+
+    // Bus is not released: the rest of the list fails
+    MSP430_SIM.i2cStuck = 100;
+    ASSERT_TRUE(I2C0_runScripts(scripts, 2, I2C_complete));
+    MSP430_SIM_run();
+    SIM_runTasks();
+    ASSERT_EQ(2u, I2C_completeCount);
+    ASSERT_FALSE(I2C0_isScriptRunning());
+    ASSERT_EQ(I2C_SCRIPT_BUS_ERROR, scripts[0].state);
+    ASSERT_EQ(I2C_SCRIPT_BUS_ERROR, scripts[1].state);
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              I2cScriptTest.I2C_scriptCheck()
+// Description:
+//! \brief      Invalid scripts are rejected, running scripts are aborted
+//------------------------------------------------------------------------------
+TEST_F(I2cScriptTestFixture, I2C_scriptCheck)
+{
+    static const uint8_t reg = 0x00;
+    const I2C_Step_t empty[] = { I2C_STEP_READ(0x48, rx, 0) };
+    const I2C_Step_t burst[] = {
+        I2C_STEP_READ(0x48, rx, 1),
+        I2C_STEP_WRITE_MORE(&reg, 1)
+    };
+    const I2C_Step_t steps[] = {
+        I2C_STEP_WRITE(0x48, &reg, 1),
+        I2C_STEP_READ(0x48, rx, 8)
+    };
+    I2C_Script_t script = { empty, 1, 0, 0 };
+
+    ASSERT_FALSE(I2C0_runScripts(&script, 1, I2C_complete));
+    script.steps = burst;
+    script.count = 2;
+    ASSERT_FALSE(I2C0_runScripts(&script, 1, I2C_complete));
+    script.steps = &burst[1];
+    script.count = 1;
+    ASSERT_FALSE(I2C0_runScripts(&script, 1, I2C_complete));
+    ASSERT_STREQ("", MSP430_SIM.i2cTrace);
+
+    // One list at a time
+    script.steps = steps;
+    script.count = 2;
+    ASSERT_TRUE(I2C0_runScripts(&script, 1, I2C_complete));
+    ASSERT_FALSE(I2C0_runScripts(&script, 1, I2C_complete));
+
+    // Timeout: bus is reset, handler is called
+    I2C0_abortScripts();
+    ASSERT_EQ(1u, I2C_completeCount);
+    ASSERT_FALSE(I2C0_isScriptRunning());
+    ASSERT_EQ(I2C_SCRIPT_BUS_ERROR, script.state);
+    MSP430_SIM_run();
+    ASSERT_EQ(1u, I2C_completeCount);
+
+    ASSERT_TRUE(I2C0_runScripts(&script, 1, I2C_complete));
+    MSP430_SIM_run();
+    ASSERT_EQ(2u, I2C_completeCount);
+    ASSERT_EQ(I2C_SCRIPT_DONE, script.state);
+}
+
+//------------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+    // Initialize Google Test Framework
+    testing::InitGoogleTest(&argc, argv);
+    // Run all tests
+    return RUN_ALL_TESTS();
+}
+
+//******************************************************************************
+// End of file
+//******************************************************************************
@@ -0,0 +1,772 @@
+//******************************************************************************
+// Copyright (C) 2026 Bogdan Kokotenko
+//
+//   File description:
+//! \file   test05/msp430sim.c
+//! \brief  Simulation of MSP430F5x USCI_A0 receiver and DMA controller
+//!
+//!*****************************************************************************
+//! __Revisions:__
+//!  Date       | Author           | Comments
+//!  ---------- | ---------------- | ----------------
+//!  18/10/2026 | Bogdan Kokotenko | Initial draft
+//!  18/10/2026 | Bogdan Kokotenko | Added Timer_B0 CCR0 model
+//!  18/10/2026 | Bogdan Kokotenko | Added USCI_B0 SPI master model
+//!  18/10/2026 | Bogdan Kokotenko | Added USCI_B1 I2C master model
+//!  18/10/2026 | Bogdan Kokotenko | I2C transmitter is double buffered
+//
+//******************************************************************************
+#include "types.h"
+#include "msp430sim.h"
+
+#include <stdio.h>
+
+//------------------------------------------------------------------------------
+// Registers
+volatile uint8_t   MSP430_SIM_gie;
+volatile uint16_t  MSP430_SIM_wdtctl;
+volatile uint16_t  DMACTL0, DMACTL1, DMACTL2, DMACTL3, DMACTL4;
+volatile uint16_t  DMA0CTL, DMA1CTL, DMA2CTL;
+volatile uint16_t  DMA0SZ, DMA1SZ, DMA2SZ;
+volatile uintptr_t DMA0SA, DMA1SA, DMA2SA;
+volatile uintptr_t DMA0DA, DMA1DA, DMA2DA;
+volatile uint8_t   UCA0CTL0, UCA0CTL1, UCA0BR0, UCA0BR1, UCA0MCTL;
+volatile uint8_t   UCA0STAT, UCA0IE, UCA0IFG;
+volatile uint16_t  UCA0RXBUF, UCA0TXBUF, UCA0IV;
+volatile uint8_t   UCB0IFG, UCA1IFG, UCB1IFG;
+volatile uint8_t   UCB0CTL0, UCB0CTL1, UCB0BR0, UCB0BR1, UCB0STAT, UCB0IE;
+volatile uint16_t  UCB0RXBUF, UCB0TXBUF, UCA1RXBUF, UCA1TXBUF;
+volatile uint16_t  UCB1RXBUF, UCB1TXBUF;
+volatile uint8_t   UCB1CTL0, UCB1CTL1, UCB1BR0, UCB1BR1, UCB1STAT, UCB1IE;
+volatile uint16_t  UCB1I2COA, UCB1I2CSA, UCB1IV;
+volatile uint16_t  TB0CTL, TB0CCTL0, TB0CCR0, TB0R;
+
+//! Critical section nesting (hal.h)
+uint16_t GINT_criticalNesting;
+
+//! Simulation state
+MSP430_SIM_t MSP430_SIM;
+
+//! DMA ISR (dma.c)
+void DMA_ISR(void);
+
+//! Timer_B0 CCR0 ISR (uart.c)
+void UART0_idleIsr(void);
+
+//! USCI_B1 ISR (i2c.c)
+void I2C0_isr(void);
+
+//! Timer_B0 ticks not counted yet (divider)
+static uint32_t TIMER_SIM_ticks;
+
+//! USCI_B0 TXBUF is written, byte waits for shift register
+static bool SPI_SIM_txPending;
+
+//! USCI_B1 I2C bus states
+typedef enum{
+    I2C_SIM_IDLE,                   //!< bus is free
+    I2C_SIM_TX,                     //!< master transmitter
+    I2C_SIM_RX,                     //!< master receiver
+    I2C_SIM_HOLD                    //!< NACK: waits for stop or restart
+}I2C_SIM_STATE_t;
+
+//! USCI_B1 I2C bus state
+static I2C_SIM_STATE_t I2C_SIM_state;
+
+//! USCI_B1 TXBUF is written
+static bool I2C_SIM_txPending;
+
+//! USCI_B1 byte is in shift register (ACK is not received yet)
+static bool I2C_SIM_txShift;
+
+//! USCI_B1 shift register
+static uint8_t I2C_SIM_txData;
+
+//! USCI_B1 RXBUF is not read (clock is held)
+static bool I2C_SIM_rxFull;
+
+//! I2C trace length
+static size_t I2C_SIM_traceLength;
+
+//! USCI_B1 interrupt flags in vector order
+static const uint8_t I2C_SIM_flag[6] = {
+    UCALIFG, UCNACKIFG, UCSTTIFG, UCSTPIFG, UCRXIFG, UCTXIFG
+};
+
+//! DMA channel registers
+typedef struct _DMA_SIM_Channel_t{
+    volatile uint16_t*  ctl;        //!< DMAxCTL
+    volatile uint16_t*  sz;         //!< DMAxSZ
+    volatile uintptr_t* sa;         //!< DMAxSA
+    volatile uintptr_t* da;         //!< DMAxDA
+}DMA_SIM_Channel_t;
+
+//! DMA channels
+static const DMA_SIM_Channel_t DMA_SIM_channel[3] = {
+    { &DMA0CTL, &DMA0SZ, &DMA0SA, &DMA0DA },
+    { &DMA1CTL, &DMA1SZ, &DMA1SA, &DMA1DA },
+    { &DMA2CTL, &DMA2SZ, &DMA2SA, &DMA2DA }
+};
+
+//! Latched (working) channel registers
+static struct DMA_SIM_Latch_t{
+    bool        enabled;            //!< DMAEN seen by controller
+    uintptr_t   sa;                 //!< source pointer
+    uintptr_t   da;                 //!< destination pointer
+    uint16_t    sz;                 //!< initial size
+}DMA_SIM_latch[3];
+
+//------------------------------------------------------------------------------
+// Function:
+//              MSP430_SIM_reset()
+// Description:
+//! \brief      Reset registers and statistics
+//------------------------------------------------------------------------------
+void MSP430_SIM_reset(void)
+{
+    DMACTL0 = DMACTL1 = DMACTL2 = DMACTL3 = DMACTL4 = 0;
+    DMA0CTL = DMA1CTL = DMA2CTL = 0;
+    DMA0SZ = DMA1SZ = DMA2SZ = 0;
+    DMA0SA = DMA1SA = DMA2SA = 0;
+    DMA0DA = DMA1DA = DMA2DA = 0;
+    UCA0CTL0 = 0;
+    UCA0CTL1 = UCSWRST;
+    UCA0STAT = UCA0IE = 0;
+    UCA0IFG = UCTXIFG;
+    UCA0RXBUF = UCA0TXBUF = 0;
+    UCB0CTL0 = UCB0BR0 = UCB0BR1 = UCB0STAT = UCB0IE = 0;
+    UCB0CTL1 = UCSWRST;
+    UCB0IFG = UCTXIFG;
+    UCB0RXBUF = UCB0TXBUF = 0;
+    SPI_SIM_txPending = false;
+    UCB1CTL0 = UCB1BR0 = UCB1BR1 = UCB1STAT = UCB1IE = UCB1IFG = 0;
+    UCB1CTL1 = UCSWRST;
+    UCB1I2COA = UCB1I2CSA = UCB1IV = 0;
+    UCB1RXBUF = UCB1TXBUF = 0;
+    I2C_SIM_state = I2C_SIM_IDLE;
+    I2C_SIM_txPending = I2C_SIM_txShift = I2C_SIM_rxFull = false;
+    I2C_SIM_traceLength = 0;
+    TB0CTL = TB0CCTL0 = TB0CCR0 = TB0R = 0;
+    TIMER_SIM_ticks = 0;
+    GINT_criticalNesting = 0;
+    MSP430_SIM_gie = 1;
+    memset(DMA_SIM_latch, 0, sizeof(DMA_SIM_latch));
+    memset(&MSP430_SIM, 0, sizeof(MSP430_SIM));
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              MSP430_SIM_readDmaiv()
+// Description:
+//! \brief      DMAIV read: the highest pending flag is cleared
+//------------------------------------------------------------------------------
+uint16_t MSP430_SIM_readDmaiv(void)
+{
+    uint8_t channel;
+
+    for(channel = 0; channel < 3; channel++)
+    {
+        volatile uint16_t* ctl = DMA_SIM_channel[channel].ctl;
+        if((*ctl & (DMAIFG | DMAIE)) == (DMAIFG | DMAIE))
+        {
+            *ctl &= ~DMAIFG;
+            return 2*(channel + 1);
+        }
+    }
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              DMA_SIM_enabled()
+// Description:
+//! \brief      Latch channel registers when DMAEN is set
+//! \return     true, if channel is enabled
+//------------------------------------------------------------------------------
+static bool DMA_SIM_enabled(uint8_t channel)
+{
+    const DMA_SIM_Channel_t* regs = &DMA_SIM_channel[channel];
+    struct DMA_SIM_Latch_t* latch = &DMA_SIM_latch[channel];
+
+    if(!(*regs->ctl & DMAEN))
+    {
+        latch->enabled = false;
+        return false;
+    }
+    if(!latch->enabled)
+    {
+        latch->enabled = true;
+        latch->sa = *regs->sa;
+        latch->da = *regs->da;
+        latch->sz = *regs->sz;
+    }
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              DMA_SIM_transfer()
+// Description:
+//! \brief      Single DMA transfer of enabled channel
+//------------------------------------------------------------------------------
+static void DMA_SIM_transfer(uint8_t channel)
+{
+    const DMA_SIM_Channel_t* regs = &DMA_SIM_channel[channel];
+    struct DMA_SIM_Latch_t* latch = &DMA_SIM_latch[channel];
+    uint16_t ctl = *regs->ctl;
+    uint16_t value;
+
+    // Source read (RXBUF read clears RXIFG and UCOE)
+    if(ctl & DMASRCBYTE)
+        value = *(volatile uint8_t*)latch->sa;
+    else
+        value = *(volatile uint16_t*)latch->sa;
+    if(latch->sa == (uintptr_t)&UCA0RXBUF)
+    {
+        UCA0IFG &= ~UCRXIFG;
+        UCA0STAT &= ~UCOE;
+    }
+    if(latch->sa == (uintptr_t)&UCB0RXBUF)
+    {
+        UCB0IFG &= ~UCRXIFG;
+        UCB0STAT &= ~UCOE;
+    }
+
+    // Destination write (TXBUF write clears TXIFG)
+    if(latch->da == (uintptr_t)&UCB0TXBUF)
+    {
+        UCB0IFG &= ~UCTXIFG;
+        SPI_SIM_txPending = true;
+    }
+
+    if(ctl & DMADSTBYTE)
+        *(volatile uint8_t*)latch->da = (uint8_t)value;
+    else
+        *(volatile uint16_t*)latch->da = value;
+
+    if((ctl & DMASRCINCR_3) == DMASRCINCR_3)
+        latch->sa += (ctl & DMASRCBYTE) ? 1 : 2;
+    if((ctl & DMADSTINCR_3) == DMADSTINCR_3)
+        latch->da += (ctl & DMADSTBYTE) ? 1 : 2;
+    MSP430_SIM.dmaTransfers++;
+
+    // Block complete: reload, interrupt flag
+    if(--*regs->sz == 0)
+    {
+        *regs->sz = latch->sz;
+        latch->sa = *regs->sa;
+        latch->da = *regs->da;
+        *regs->ctl |= DMAIFG;
+        MSP430_SIM.irqTime[channel] = MSP430_SIM.time;
+        if((ctl & DMADT_7) == DMADT_0 || (ctl & DMADT_7) == DMADT_1)
+        {
+            *regs->ctl &= ~DMAEN;
+            latch->enabled = false;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              DMA_SIM_trigger()
+// Description:
+//! \brief      Trigger edge for channels with selected trigger
+//------------------------------------------------------------------------------
+static void DMA_SIM_trigger(uint8_t trigger)
+{
+    uint8_t channel;
+
+    for(channel = 0; channel < 3; channel++)
+    {
+        uint8_t select = (channel == 0) ? (DMACTL0 & DMA0TSEL_31) :
+                         (channel == 1) ? (DMACTL0 & DMA1TSEL_31) >> 8 :
+                                          (DMACTL1 & DMA2TSEL_31);
+        if(select == trigger && DMA_SIM_enabled(channel))
+            DMA_SIM_transfer(channel);
+    }
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              DMA_SIM_requests()
+// Description:
+//! \brief      Serve software requests (DMAREQ)
+//------------------------------------------------------------------------------
+static void DMA_SIM_requests(void)
+{
+    uint8_t channel;
+
+    for(channel = 0; channel < 3; channel++)
+    {
+        volatile uint16_t* ctl = DMA_SIM_channel[channel].ctl;
+        if(*ctl & DMAREQ)
+        {
+            *ctl &= ~DMAREQ;
+            if(DMA_SIM_enabled(channel))
+                DMA_SIM_transfer(channel);
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              SPI_SIM_shift()
+// Description:
+//! \brief      Shift bytes written to USCI_B0 TXBUF
+//------------------------------------------------------------------------------
+static void SPI_SIM_shift(void)
+{
+    while(SPI_SIM_txPending && !(UCB0CTL1 & UCSWRST))
+    {
+        uint8_t mosi = (uint8_t)UCB0TXBUF;
+        uint8_t miso;
+
+        // TXBUF to shift register: DMA writes the next byte at once
+        SPI_SIM_txPending = false;
+        UCB0IFG |= UCTXIFG;
+        DMA_SIM_trigger(DMA0TSEL__USCIB0TX);
+
+        // Byte is shifted in
+        miso = MSP430_SIM.spiSlave ? MSP430_SIM.spiSlave(mosi) : mosi;
+        if(MSP430_SIM.spiBytes < MSP430_SIM_SPI_LOG)
+            MSP430_SIM.spiLog[MSP430_SIM.spiBytes] = mosi;
+        MSP430_SIM.spiBytes++;
+        if(UCB0IFG & UCRXIFG)
+        {
+            UCB0STAT |= UCOE;
+            MSP430_SIM.spiOverruns++;
+        }
+        UCB0RXBUF = miso;
+        UCB0IFG |= UCRXIFG;
+        DMA_SIM_trigger(DMA0TSEL__USCIB0RX);
+    }
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              MSP430_SIM_spiAccess()
+// Description:
+//! \brief      CPU access of USCI_B0 register
+//! \details    Pending bytes are shifted first. TXBUF access is taken as
+//!             write (TXIFG is cleared), RXBUF access as read (RXIFG and
+//!             UCOE are cleared).
+//------------------------------------------------------------------------------
+void MSP430_SIM_spiAccess(const volatile void* reg)
+{
+    MSP430_SIM.spiAccesses++;
+    SPI_SIM_shift();
+
+    if(reg == &UCB0TXBUF)
+    {
+        UCB0IFG &= ~UCTXIFG;
+        SPI_SIM_txPending = true;
+    }
+    else if(reg == &UCB0RXBUF)
+    {
+        UCB0IFG &= ~UCRXIFG;
+        UCB0STAT &= ~UCOE;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              I2C_SIM_trace()
+// Description:
+//! \brief      Write bus event to the trace
+//------------------------------------------------------------------------------
+static void I2C_SIM_trace(const char* event)
+{
+    size_t size = sizeof(MSP430_SIM.i2cTrace) - I2C_SIM_traceLength;
+    int length = snprintf(&MSP430_SIM.i2cTrace[I2C_SIM_traceLength], size,
+                          (I2C_SIM_traceLength && event[0] != 'N') ?
+                          " %s" : "%s", event);
+
+    if(length > 0 && (size_t)length < size)
+        I2C_SIM_traceLength += length;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              I2C_SIM_byte()
+// Description:
+//! \brief      Write byte to the trace
+//------------------------------------------------------------------------------
+static void I2C_SIM_byte(uint8_t data, bool ack)
+{
+    char text[4];
+
+    snprintf(text, sizeof(text), "%02X", data);
+    I2C_SIM_trace(text);
+    if(!ack)
+        I2C_SIM_trace("N");
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              I2C_SIM_reset()
+// Description:
+//! \brief      USCI_B1 is in reset (UCSWRST): bus is released
+//------------------------------------------------------------------------------
+static bool I2C_SIM_reset(void)
+{
+    if(!(UCB1CTL1 & UCSWRST))
+        return false;
+
+    UCB1IE = 0;
+    UCB1IFG = 0;
+    UCB1STAT &= ~UCBBUSY;
+    I2C_SIM_state = I2C_SIM_IDLE;
+    I2C_SIM_txPending = I2C_SIM_txShift = I2C_SIM_rxFull = false;
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              I2C_SIM_start()
+// Description:
+//! \brief      (Repeated) start condition and address byte
+//------------------------------------------------------------------------------
+static void I2C_SIM_start(void)
+{
+    bool read = (UCB1CTL1 & UCTR) ? false : true;
+    uint8_t address = (uint8_t)(UCB1I2CSA << 1) | (read ? 1 : 0);
+    bool ack;
+
+    UCB1CTL1 &= ~UCTXSTT;
+
+    // Slave holds SDA low: arbitration is lost
+    if(MSP430_SIM.i2cStuck)
+    {
+        I2C_SIM_trace("AL");
+        UCB1CTL0 &= ~UCMST;
+        UCB1IFG |= UCALIFG;
+        I2C_SIM_state = I2C_SIM_IDLE;
+        return;
+    }
+
+    I2C_SIM_trace("S");
+    MSP430_SIM.i2cStarts++;
+    UCB1STAT |= UCBBUSY;
+    I2C_SIM_rxFull = false;
+
+    ack = MSP430_SIM.i2cStart ?
+          MSP430_SIM.i2cStart((uint8_t)UCB1I2CSA, read) : false;
+    I2C_SIM_byte(address, ack);
+    I2C_SIM_txShift = false;
+    if(!ack)
+    {
+        I2C_SIM_txPending = false;
+        UCB1IFG |= UCNACKIFG;
+        I2C_SIM_state = I2C_SIM_HOLD;
+    }
+    else if(read)
+        I2C_SIM_state = I2C_SIM_RX;
+    else
+    {
+        UCB1IFG |= UCTXIFG;
+        I2C_SIM_state = I2C_SIM_TX;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              I2C_SIM_stop()
+// Description:
+//! \brief      Stop condition
+//------------------------------------------------------------------------------
+static void I2C_SIM_stop(void)
+{
+    I2C_SIM_trace("P");
+    UCB1CTL1 &= ~UCTXSTP;
+    UCB1STAT &= ~UCBBUSY;
+    I2C_SIM_txPending = I2C_SIM_txShift = false;
+    I2C_SIM_state = I2C_SIM_IDLE;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              I2C_SIM_event()
+// Description:
+//! \brief      Next I2C bus event
+//! \return     true, if event is done
+//------------------------------------------------------------------------------
+static bool I2C_SIM_event(void)
+{
+    if(I2C_SIM_reset() || !(UCB1CTL0 & UCMST))
+        return false;
+
+    switch(I2C_SIM_state)
+    {
+    case I2C_SIM_TX:
+        if(I2C_SIM_txShift)
+        {
+            bool ack = MSP430_SIM.i2cWrite ?
+                       MSP430_SIM.i2cWrite(I2C_SIM_txData) : false;
+
+            I2C_SIM_byte(I2C_SIM_txData, ack);
+            I2C_SIM_txShift = false;
+            if(!ack)
+            {
+                I2C_SIM_txPending = false;
+                UCB1IFG |= UCNACKIFG;
+                I2C_SIM_state = I2C_SIM_HOLD;
+                return true;
+            }
+        }
+        if(I2C_SIM_txPending)
+        {
+            // TXBUF moves to shift register, buffer is free for next byte
+            I2C_SIM_txData = (uint8_t)UCB1TXBUF;
+            I2C_SIM_txPending = false;
+            I2C_SIM_txShift = true;
+            UCB1IFG |= UCTXIFG;
+            return true;
+        }
+        break;
+
+    case I2C_SIM_RX:
+        if(!I2C_SIM_rxFull)
+        {
+            // Condition requested: byte is NACKed by master
+            bool ack = (UCB1CTL1 & (UCTXSTT | UCTXSTP)) ? false : true;
+            uint8_t data = MSP430_SIM.i2cRead ? MSP430_SIM.i2cRead() : 0xFF;
+
+            I2C_SIM_byte(data, ack);
+            UCB1RXBUF = data;
+            UCB1IFG |= UCRXIFG;
+            I2C_SIM_rxFull = true;
+            if(!ack)
+                I2C_SIM_state = I2C_SIM_HOLD;
+            return true;
+        }
+        return false;
+
+    default:
+        break;
+    }
+
+    if(UCB1CTL1 & UCTXSTT)
+    {
+        I2C_SIM_start();
+        return true;
+    }
+    if((UCB1CTL1 & UCTXSTP) && I2C_SIM_state != I2C_SIM_IDLE)
+    {
+        I2C_SIM_stop();
+        return true;
+    }
+    UCB1CTL1 &= ~UCTXSTP;
+    return false;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              I2C_SIM_vector()
+// Description:
+//! \brief      USCI_B1 interrupt vector of the highest enabled flag
+//------------------------------------------------------------------------------
+static uint16_t I2C_SIM_vector(void)
+{
+    uint8_t index;
+
+    for(index = 0; index < 6; index++)
+        if(UCB1IFG & UCB1IE & I2C_SIM_flag[index])
+            return 2*(index + 1);
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              MSP430_SIM_i2cAccess()
+// Description:
+//! \brief      CPU access of USCI_B1 register
+//! \details    TXBUF access is taken as write (TXIFG is cleared), RXBUF
+//!             access as read (RXIFG is cleared, clock is released), IV
+//!             read clears the highest pending flag.
+//------------------------------------------------------------------------------
+void MSP430_SIM_i2cAccess(const volatile void* reg)
+{
+    I2C_SIM_reset();
+
+    if(reg == &UCB1TXBUF)
+    {
+        UCB1IFG &= ~UCTXIFG;
+        I2C_SIM_txPending = true;
+    }
+    else if(reg == &UCB1RXBUF)
+    {
+        UCB1IFG &= ~UCRXIFG;
+        I2C_SIM_rxFull = false;
+    }
+    else if(reg == &UCB1IV)
+    {
+        UCB1IV = I2C_SIM_vector();
+        if(UCB1IV)
+            UCB1IFG &= ~I2C_SIM_flag[UCB1IV/2 - 1];
+    }
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              MSP430_SIM_delay()
+// Description:
+//! \brief      CPU delay: next I2C bus event is done
+//------------------------------------------------------------------------------
+void MSP430_SIM_delay(uint32_t cycles)
+{
+    (void)cycles;
+    I2C_SIM_event();
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              TIMER_SIM_clear()
+// Description:
+//! \brief      TACLR: clear counter and divider
+//------------------------------------------------------------------------------
+static void TIMER_SIM_clear(void)
+{
+    if(TB0CTL & TACLR)
+    {
+        TB0CTL &= ~TACLR;
+        TB0R = 0;
+        TIMER_SIM_ticks = 0;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              TIMER_SIM_count()
+// Description:
+//! \brief      Count one character time in up mode
+//------------------------------------------------------------------------------
+static void TIMER_SIM_count(void)
+{
+    uint32_t count;
+
+    TIMER_SIM_clear();
+    if((TB0CTL & MC_3) != MC_1)
+        return;
+
+    TIMER_SIM_ticks += MSP430_SIM.timerTicks;
+    count = TIMER_SIM_ticks >> ((TB0CTL & ID_3) >> 6);
+    TIMER_SIM_ticks -= count << ((TB0CTL & ID_3) >> 6);
+
+    // Up mode: CCIFG when counter reaches CCR0, then from zero
+    count += TB0R;
+    if(count >= TB0CCR0)
+    {
+        TB0CCTL0 |= CCIFG;
+        count = TB0CCR0 ? (count - TB0CCR0) % TB0CCR0 : 0;
+    }
+    TB0R = (uint16_t)count;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              MSP430_SIM_run()
+// Description:
+//! \brief      Serve DMA requests and interrupts due by latency
+//------------------------------------------------------------------------------
+void MSP430_SIM_run(void)
+{
+    bool pending = true;
+
+    DMA_SIM_requests();
+    TIMER_SIM_clear();
+    SPI_SIM_shift();
+
+    while(pending && MSP430_SIM_gie)
+    {
+        uint8_t channel;
+
+        // Timer_B0 CCR0 has higher priority, its flag is cleared on entry
+        if((TB0CCTL0 & (CCIFG | CCIE)) == (CCIFG | CCIE))
+        {
+            TB0CCTL0 &= ~CCIFG;
+            MSP430_SIM_gie = 0;
+            UART0_idleIsr();
+            MSP430_SIM_gie = 1;
+            MSP430_SIM.timerInterrupts++;
+            TIMER_SIM_clear();
+        }
+
+        pending = false;
+        for(channel = 0; channel < 3; channel++)
+        {
+            uint16_t ctl = *DMA_SIM_channel[channel].ctl;
+            if((ctl & (DMAIFG | DMAIE)) == (DMAIFG | DMAIE) &&
+               MSP430_SIM.time - MSP430_SIM.irqTime[channel] >=
+               MSP430_SIM.irqLatency)
+                pending = true;
+        }
+
+        if(pending)
+        {
+            // Interrupt entry clears GIE, RETI restores it
+            MSP430_SIM_gie = 0;
+            DMA_ISR();
+            MSP430_SIM_gie = 1;
+            MSP430_SIM.interrupts++;
+            DMA_SIM_requests();
+            TIMER_SIM_clear();
+            SPI_SIM_shift();
+        }
+        else if(I2C_SIM_vector())
+        {
+            MSP430_SIM_gie = 0;
+            I2C0_isr();
+            MSP430_SIM_gie = 1;
+            MSP430_SIM.i2cInterrupts++;
+            pending = true;
+        }
+        else
+            pending = I2C_SIM_event();
+    }
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              MSP430_SIM_uartRx()
+// Description:
+//! \brief      Character received by UCA0
+//------------------------------------------------------------------------------
+void MSP430_SIM_uartRx(uint8_t ch)
+{
+    MSP430_SIM.time++;
+    TIMER_SIM_count();
+    MSP430_SIM_run();
+
+    // RXBUF was not read: previous character is lost
+    if(UCA0IFG & UCRXIFG)
+    {
+        UCA0STAT |= UCOE;
+        MSP430_SIM.rxOverruns++;
+    }
+    UCA0RXBUF = ch;
+    UCA0IFG |= UCRXIFG;
+    DMA_SIM_trigger(DMA0TSEL__USCIA0RX);
+    TIMER_SIM_clear();
+
+    MSP430_SIM_run();
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              MSP430_SIM_idle()
+// Description:
+//! \brief      Line is idle for number of character times
+//------------------------------------------------------------------------------
+void MSP430_SIM_idle(uint32_t chars)
+{
+    while(chars--)
+    {
+        MSP430_SIM.time++;
+        TIMER_SIM_count();
+        MSP430_SIM_run();
+    }
+}
+
+//******************************************************************************
+// End of file
+//******************************************************************************
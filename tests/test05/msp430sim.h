@@ -0,0 +1,120 @@
+//******************************************************************************
+// Copyright (C) 2026 Bogdan Kokotenko
+//
+//! \addtogroup test05
+//! @{
+//******************************************************************************
+//   File description:
+//! \file   test05/msp430sim.h
+//! \brief  Simulation of MSP430F5x USCI_A0 receiver and DMA controller
+//!
+//! \details Time is counted in UART characters: MSP430_SIM_uartRx() is one
+//!          character received by UCA0 (RXBUF and RXIFG edge, UCOE if RXBUF
+//!          was not read). DMA channels follow device rules:
+//!          - SA/DA/SZ are latched when DMAEN is set, reloaded after block
+//!          - single transfer mode (DMADT_0) clears DMAEN after block
+//!          - edge triggers: RXIFG set before DMAEN does not trigger,
+//!            DMAREQ transfers once
+//!          - channels with the same trigger transfer in priority order
+//!
+//!          DMA interrupt is taken when GIE is set and irqLatency characters
+//!          passed since DMAIFG (0 - before the next character).
+//!
+//!          Timer_B0 counts timerTicks (SMCLK ticks per character, divided
+//!          by ID) every character time in up mode to CCR0, TACLR clears it.
+//!          CCR0 interrupt is taken without latency.
+//!
+//!          USCI_B0 is SPI master: byte written to TXBUF (by CPU access or
+//!          DMA) moves to shift register (TXIFG edge) and is exchanged with
+//!          spiSlave model at once (RXIFG edge, UCOE if RXBUF was not read).
+//!          Shifting is done before every CPU access of USCI_B0 register
+//!          and by MSP430_SIM_run(), bytes take no character time.
+//!
+//!          USCI_B1 is I2C master on a bus with i2cStart/i2cWrite/i2cRead
+//!          slave model. Bus events (start, byte, stop) are done one by one
+//!          by MSP430_SIM_run() between interrupts and by CPU delays (code
+//!          takes no bus time). Transmitter is double buffered: TXIFG is
+//!          set when the byte moves to shift register, its ACK comes with
+//!          the next event. Conditions requested by UCTXSTT/UCTXSTP
+//!          during reception make the byte NACKed by master; receiver
+//!          holds the clock while RXBUF is not read. Start condition is
+//!          lost by arbitration (UCALIFG, UCMST cleared) while slave holds
+//!          SDA low for i2cStuck more SCL pulses. Bus events are written to
+//!          i2cTrace: "S" start, address and data bytes, "N" not
+//!          acknowledged byte, "P" stop, "AL" arbitration lost.
+//!
+//!*****************************************************************************
+//! __Revisions:__
+//!  Date       | Author           | Comments
+//!  ---------- | ---------------- | ----------------
+//!  18/10/2026 | Bogdan Kokotenko | Initial draft
+//!  18/10/2026 | Bogdan Kokotenko | Added Timer_B0 CCR0 model
+//!  18/10/2026 | Bogdan Kokotenko | Added USCI_B0 SPI master model
+//!  18/10/2026 | Bogdan Kokotenko | Added USCI_B1 I2C master model
+//!  18/10/2026 | Bogdan Kokotenko | I2C transmitter is double buffered
+//
+//******************************************************************************
+#ifndef MSP430SIM_H
+#define MSP430SIM_H
+
+#include "msp430.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//! Size of SPI MOSI log
+#define MSP430_SIM_SPI_LOG  1024
+
+//! Size of I2C bus trace
+#define MSP430_SIM_I2C_TRACE 1024
+
+//! Simulation state and statistics
+typedef struct _MSP430_SIM_t{
+    uint32_t    time;               //!< characters received
+    uint32_t    irqLatency;         //!< DMA ISR latency (characters)
+    uint32_t    irqTime[3];         //!< time of DMAIFG per channel
+    uint32_t    rxOverruns;         //!< characters lost in USCI (UCOE)
+    uint32_t    dmaTransfers;       //!< DMA transfers done
+    uint32_t    interrupts;         //!< DMA ISR calls
+    uint32_t    timerTicks;         //!< SMCLK ticks per character
+    uint32_t    timerInterrupts;    //!< Timer_B0 CCR0 ISR calls
+    uint8_t   (*spiSlave)(uint8_t mosi);    //!< SPI slave (NULL - loopback)
+    uint32_t    spiBytes;           //!< SPI bytes shifted
+    uint32_t    spiAccesses;        //!< CPU accesses of USCI_B0 registers
+    uint32_t    spiOverruns;        //!< SPI bytes lost in RXBUF (UCOE)
+    uint8_t     spiLog[MSP430_SIM_SPI_LOG]; //!< MOSI bytes
+    //! I2C slave is addressed, returns ACK (NULL - no slaves)
+    bool      (*i2cStart)(uint8_t address, bool read);
+    bool      (*i2cWrite)(uint8_t data);    //!< byte is written, ACK
+    uint8_t   (*i2cRead)(void);             //!< byte is read
+    uint32_t    i2cStuck;           //!< SCL pulses to release SDA by slave
+    uint32_t    i2cInterrupts;      //!< USCI_B1 ISR calls
+    uint32_t    i2cStarts;          //!< start conditions
+    char        i2cTrace[MSP430_SIM_I2C_TRACE]; //!< bus events
+}MSP430_SIM_t;
+
+//! Simulation state
+extern MSP430_SIM_t MSP430_SIM;
+
+//! Reset registers and statistics
+void MSP430_SIM_reset(void);
+
+//! Receive character by UCA0 (one character time)
+void MSP430_SIM_uartRx(uint8_t ch);
+
+//! Line is idle for number of character times
+void MSP430_SIM_idle(uint32_t chars);
+
+//! Serve software DMA requests and due interrupts (after CPU code)
+void MSP430_SIM_run(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // MSP430SIM_H
+//! @}
+//******************************************************************************
+// End of file
+//******************************************************************************
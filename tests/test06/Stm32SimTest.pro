@@ -0,0 +1,41 @@
+#*******************************************************************************
+#   Filename:       Stm32SimTest.pro
+#
+#   Description:    Unit tests for STM32F0x HAL on simulated registers
+#
+#   Author:         Bogdan Kokotenko
+#
+#   Revision date:  18/10/2026
+#
+#*******************************************************************************
+TEMPLATE = app
+CONFIG += console
+CONFIG -= app_bundle qt
+
+INCLUDEPATH +=  $$PWD/config \
+                $$PWD \
+                $$PWD/../ \
+                $$PWD/../../common \
+                $$PWD/../../common/hal \
+                $$PWD/../../common/hal/mcu/stm32f0x \
+                $$PWD/../../common/sys
+
+HEADERS +=  $$PWD/config/stm32f0xx.h \
+            $$PWD/config/core_cm0.h \
+            $$PWD/config/clocks_config.h \
+            $$PWD/config/hal_config.h \
+            $$PWD/config/gpio_config.h \
+            $$PWD/config/uart_config.h \
+            $$PWD/stm32sim.h
+
+SOURCES +=  main.cpp \
+            $$PWD/stm32sim.c \
+            $$PWD/../../common/hal/mcu/stm32f0x/uart.c
+
+# Google C++ Testing Framework
+DEFINES += UNIT_TEST
+include($$PWD/../../common/googletest/googletest.pri)
+
+#*******************************************************************************
+#   End of file
+#*******************************************************************************
@@ -0,0 +1,40 @@
+//******************************************************************************
+// Copyright (C) 2026 Bogdan Kokotenko
+//
+//! \addtogroup test06
+//! @{
+//! \addtogroup test06_config
+//! @{
+//******************************************************************************
+//   File description:
+//! \file  test06/config/clocks_config.h
+//! \brief STM32F0x clocks configuration
+//!
+//!*****************************************************************************
+//! __Revisions:__										
+//!  Date       | Author           | Comments			
+//!  ---------- | ---------------- | ----------------
+//!  18/10/2026 | Bogdan Kokotenko | Initial draft
+//
+//******************************************************************************
+#ifndef CLOCKS_CONFIG_H
+#define CLOCKS_CONFIG_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SYSCLK_FREQ     48000000L
+#define HCLK_FREQ       (SYSCLK_FREQ)
+#define PCLK1_FREQ      (HCLK_FREQ)
+
+#ifdef __cplusplus
+}
+#endif
+
+//! @}
+//! @}
+#endif // CLOCKS_CONFIG_H
+//******************************************************************************
+// End of file
+//******************************************************************************
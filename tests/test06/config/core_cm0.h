@@ -0,0 +1,38 @@
+//******************************************************************************
+// Copyright (C) 2026 Bogdan Kokotenko
+//
+//! \addtogroup test06
+//! @{
+//! \addtogroup test06_config
+//! @{
+//******************************************************************************
+//   File description:
+//! \file  test06/config/core_cm0.h
+//! \brief Cortex-M0 core header replacement (host)
+//!
+//!*****************************************************************************
+//! __Revisions:__										
+//!  Date       | Author           | Comments			
+//!  ---------- | ---------------- | ----------------
+//!  18/10/2026 | Bogdan Kokotenko | Initial draft
+//
+//******************************************************************************
+#ifndef CORE_CM0_H
+#define CORE_CM0_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Core functions are defined by stm32f0xx.h simulation
+
+#ifdef __cplusplus
+}
+#endif
+
+//! @}
+//! @}
+#endif // CORE_CM0_H
+//******************************************************************************
+// End of file
+//******************************************************************************
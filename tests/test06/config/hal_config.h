@@ -0,0 +1,36 @@
+//******************************************************************************
+// Copyright (C) 2026 Bogdan Kokotenko
+//
+//! \addtogroup test06
+//! @{
+//! \addtogroup test06_config
+//! @{
+//******************************************************************************
+//   File description:
+//! \file  test06/config/hal_config.h
+//! \brief STM32F0x HAL configuration
+//!
+//!*****************************************************************************
+//! __Revisions:__										
+//!  Date       | Author           | Comments			
+//!  ---------- | ---------------- | ----------------
+//!  18/10/2026 | Bogdan Kokotenko | Initial draft
+//
+//******************************************************************************
+#ifndef HAL_CONFIG_H
+#define HAL_CONFIG_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+//! @}
+//! @}
+#endif // HAL_CONFIG_H
+//******************************************************************************
+// End of file
+//******************************************************************************
@@ -0,0 +1,200 @@
+//******************************************************************************
+// Copyright (C) 2026 Bogdan Kokotenko
+//
+//! \addtogroup test06
+//! @{
+//! \defgroup   test06_config STM32F0x Simulation Configuration
+//! \brief      Simulated STM32F0x registers and configurations
+//! @{
+//******************************************************************************
+//   File description:
+//! \file  test06/config/stm32f0xx.h
+//! \brief Simulated STM32F0x registers (replaces device header on host)
+//!
+//! \details Peripherals are structures of stm32sim.c with device layout,
+//!          DMA address registers hold host pointers. Side effects (ICR and
+//!          IFCR flag clearing, RDR/TDR access by DMA, interrupts) are done
+//!          by simulation of USART1 and DMA1 (stm32sim.h). Bit values are
+//!          taken from CMSIS stm32f030x6.h.
+//!
+//!*****************************************************************************
+//! __Revisions:__
+//!  Date       | Author           | Comments
+//!  ---------- | ---------------- | ----------------
+//!  18/10/2026 | Bogdan Kokotenko | Initial draft
+//
+//******************************************************************************
+#ifndef STM32F0XX_H
+#define STM32F0XX_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define __IO    volatile
+
+//------------------------------------------------------------------------------
+// Core
+typedef enum{
+    DMA1_Channel2_3_IRQn    = 10,   //!< DMA1 Channel 2 and Channel 3
+    USART1_IRQn             = 27    //!< USART1 global
+}IRQn_Type;
+
+//! Global interrupt enable (PRIMASK cleared)
+extern volatile uint8_t STM32_SIM_gie;
+
+#define __disable_interrupt()           (STM32_SIM_gie = 0)
+#define __enable_interrupt()            (STM32_SIM_gie = 1)
+#define __DSB()
+#define __ISB()
+#define __WFI()
+#define NVIC_SystemReset()
+#define NVIC_SetPriority(IRQn, Priority)    ((void)(IRQn), (void)(Priority))
+#define NVIC_EnableIRQ(IRQn)                ((void)(IRQn))
+
+//! DMA address registers hold host pointers
+#define DMA_ADDRESS(Address)            ((uintptr_t)(Address))
+
+//------------------------------------------------------------------------------
+// Peripherals
+typedef struct{
+    __IO uint32_t   MODER;
+    __IO uint32_t   AFR[2];
+}GPIO_TypeDef;
+
+typedef struct{
+    __IO uint32_t   AHBENR;
+    __IO uint32_t   APB2ENR;
+}RCC_TypeDef;
+
+typedef struct{
+    __IO uint32_t   CCR;
+    __IO uint32_t   CNDTR;
+    __IO uintptr_t  CPAR;
+    __IO uintptr_t  CMAR;
+}DMA_Channel_TypeDef;
+
+typedef struct{
+    __IO uint32_t   ISR;
+    __IO uint32_t   IFCR;
+}DMA_TypeDef;
+
+typedef struct{
+    __IO uint32_t   CR1;
+    __IO uint32_t   CR2;
+    __IO uint32_t   CR3;
+    __IO uint32_t   BRR;
+    __IO uint32_t   GTPR;
+    __IO uint32_t   RTOR;
+    __IO uint32_t   RQR;
+    __IO uint32_t   ISR;
+    __IO uint32_t   ICR;
+    __IO uint16_t   RDR;
+    __IO uint16_t   TDR;
+}USART_TypeDef;
+
+extern GPIO_TypeDef         STM32_SIM_gpioa;
+extern RCC_TypeDef          STM32_SIM_rcc;
+extern DMA_TypeDef          STM32_SIM_dma1;
+extern DMA_Channel_TypeDef  STM32_SIM_dma1Channel[5];
+extern USART_TypeDef        STM32_SIM_usart1;
+
+#define GPIOA               (&STM32_SIM_gpioa)
+#define RCC                 (&STM32_SIM_rcc)
+#define DMA1                (&STM32_SIM_dma1)
+#define DMA1_Channel1       (&STM32_SIM_dma1Channel[0])
+#define DMA1_Channel2       (&STM32_SIM_dma1Channel[1])
+#define DMA1_Channel3       (&STM32_SIM_dma1Channel[2])
+#define DMA1_Channel4       (&STM32_SIM_dma1Channel[3])
+#define DMA1_Channel5       (&STM32_SIM_dma1Channel[4])
+#define USART1              (&STM32_SIM_usart1)
+
+//------------------------------------------------------------------------------
+// RCC, GPIO
+#define RCC_AHBENR_DMAEN            ((uint32_t)0x00000001U)
+#define RCC_AHBENR_DMA1EN           RCC_AHBENR_DMAEN
+#define RCC_AHBENR_GPIOAEN          ((uint32_t)0x00020000U)
+#define RCC_APB2ENR_USART1EN        ((uint32_t)0x00004000U)
+#define GPIO_MODER_MODER2_1         ((uint32_t)0x00000020U)
+#define GPIO_MODER_MODER3_1         ((uint32_t)0x00000080U)
+
+//------------------------------------------------------------------------------
+// DMA
+#define DMA_ISR_GIF2                ((uint32_t)0x00000010U)
+#define DMA_ISR_TCIF2               ((uint32_t)0x00000020U)
+#define DMA_ISR_HTIF2               ((uint32_t)0x00000040U)
+#define DMA_ISR_TEIF2               ((uint32_t)0x00000080U)
+#define DMA_ISR_GIF3                ((uint32_t)0x00000100U)
+#define DMA_ISR_TCIF3               ((uint32_t)0x00000200U)
+#define DMA_ISR_HTIF3               ((uint32_t)0x00000400U)
+#define DMA_ISR_TEIF3               ((uint32_t)0x00000800U)
+#define DMA_IFCR_CGIF2              ((uint32_t)0x00000010U)
+#define DMA_IFCR_CTCIF2             ((uint32_t)0x00000020U)
+#define DMA_IFCR_CHTIF2             ((uint32_t)0x00000040U)
+#define DMA_IFCR_CTEIF2             ((uint32_t)0x00000080U)
+#define DMA_IFCR_CGIF3              ((uint32_t)0x00000100U)
+#define DMA_IFCR_CTCIF3             ((uint32_t)0x00000200U)
+#define DMA_IFCR_CHTIF3             ((uint32_t)0x00000400U)
+#define DMA_IFCR_CTEIF3             ((uint32_t)0x00000800U)
+
+#define DMA_CCR_EN                  ((uint32_t)0x00000001U)
+#define DMA_CCR_TCIE                ((uint32_t)0x00000002U)
+#define DMA_CCR_HTIE                ((uint32_t)0x00000004U)
+#define DMA_CCR_TEIE                ((uint32_t)0x00000008U)
+#define DMA_CCR_DIR                 ((uint32_t)0x00000010U)
+#define DMA_CCR_CIRC                ((uint32_t)0x00000020U)
+#define DMA_CCR_PINC                ((uint32_t)0x00000040U)
+#define DMA_CCR_MINC                ((uint32_t)0x00000080U)
+#define DMA_CCR_PSIZE               ((uint32_t)0x00000300U)
+#define DMA_CCR_MSIZE               ((uint32_t)0x00000C00U)
+#define DMA_CCR_PL                  ((uint32_t)0x00003000U)
+#define DMA_CCR_MEM2MEM             ((uint32_t)0x00004000U)
+
+//------------------------------------------------------------------------------
+// USART
+#define USART_CR1_UE                ((uint32_t)0x00000001U)
+#define USART_CR1_RE                ((uint32_t)0x00000004U)
+#define USART_CR1_TE                ((uint32_t)0x00000008U)
+#define USART_CR1_IDLEIE            ((uint32_t)0x00000010U)
+#define USART_CR1_RXNEIE            ((uint32_t)0x00000020U)
+#define USART_CR1_TCIE              ((uint32_t)0x00000040U)
+#define USART_CR1_TXEIE             ((uint32_t)0x00000080U)
+#define USART_CR3_EIE               ((uint32_t)0x00000001U)
+#define USART_CR3_DMAR              ((uint32_t)0x00000040U)
+#define USART_CR3_DMAT              ((uint32_t)0x00000080U)
+#define USART_CR3_OVRDIS            ((uint32_t)0x00001000U)
+#define USART_CR3_DDRE              ((uint32_t)0x00002000U)
+
+#define USART_ISR_PE                ((uint32_t)0x00000001U)
+#define USART_ISR_FE                ((uint32_t)0x00000002U)
+#define USART_ISR_NE                ((uint32_t)0x00000004U)
+#define USART_ISR_ORE               ((uint32_t)0x00000008U)
+#define USART_ISR_IDLE              ((uint32_t)0x00000010U)
+#define USART_ISR_RXNE              ((uint32_t)0x00000020U)
+#define USART_ISR_TC                ((uint32_t)0x00000040U)
+#define USART_ISR_TXE               ((uint32_t)0x00000080U)
+#define USART_ISR_RTOF              ((uint32_t)0x00000800U)
+#define USART_ISR_BUSY              ((uint32_t)0x00010000U)
+
+#define USART_ICR_PECF              ((uint32_t)0x00000001U)
+#define USART_ICR_FECF              ((uint32_t)0x00000002U)
+#define USART_ICR_NCF               ((uint32_t)0x00000004U)
+#define USART_ICR_ORECF             ((uint32_t)0x00000008U)
+#define USART_ICR_IDLECF            ((uint32_t)0x00000010U)
+#define USART_ICR_TCCF              ((uint32_t)0x00000040U)
+#define USART_ICR_CTSCF             ((uint32_t)0x00000200U)
+#define USART_ICR_RTOCF             ((uint32_t)0x00000800U)
+#define USART_ICR_CMCF              ((uint32_t)0x00020000U)
+
+#ifdef __cplusplus
+}
+#endif
+
+//! @}
+//! @}
+#endif // STM32F0XX_H
+//******************************************************************************
+// End of file
+//******************************************************************************
@@ -0,0 +1,42 @@
+//******************************************************************************
+// Copyright (C) 2026 Bogdan Kokotenko
+//
+//! \addtogroup test06
+//! @{
+//! \addtogroup test06_config
+//! @{
+//******************************************************************************
+//   File description:
+//! \file  test06/config/uart_config.h
+//! \brief STM32F0x UART configuration
+//!
+//!*****************************************************************************
+//! __Revisions:__										
+//!  Date       | Author           | Comments			
+//!  ---------- | ---------------- | ----------------
+//!  18/10/2026 | Bogdan Kokotenko | Initial draft
+//
+//******************************************************************************
+#ifndef UART_CONFIG_H
+#define UART_CONFIG_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//! UART baudrate (bps)
+#define UART_BAUDRATE           921600L
+
+//! TX and RX by DMA (DMA1 channels 2, 3)
+#define UART_DMA_ENABLED
+
+#ifdef __cplusplus
+}
+#endif
+
+//! @}
+//! @}
+#endif // UART_CONFIG_H
+//******************************************************************************
+// End of file
+//******************************************************************************
@@ -0,0 +1,240 @@
+//******************************************************************************
+// Copyright (C) 2026 Bogdan Kokotenko
+//
+//! \defgroup test06 Test06
+//! \brief Unit tests for STM32F0x HAL on simulated registers
+//! \details See \ref test06/main.cpp
+//******************************************************************************
+//   File description:
+//! \file               test06/main.cpp
+//! \brief              Contains unit tests implementation
+//!
+//! \details STM32F0x UART driver is built for host in DMA mode with fake
+//!          registers (config/stm32f0xx.h), USART1 and DMA1 are simulated
+//!          per character (stm32sim.h).
+//!
+//!*****************************************************************************
+//! __Revisions:__
+//!  Date       | Author           | Comments
+//!  ---------- | ---------------- | ----------------
+//!  18/10/2026 | Bogdan Kokotenko | Initial draft
+//
+//******************************************************************************
+#include "project.h"
+#include "types.h"
+#include "hal.h"
+#include "uart.h"
+#include "stm32sim.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+//! Reception buffer size
+#define UART_RX_SIZE        256
+
+//! Packet sent handler calls
+static uint32_t UART_sentCount;
+
+//! Data received handler calls
+static uint32_t UART_receivedCount;
+
+//------------------------------------------------------------------------------
+// Function:
+//              UART_sent()
+// Description:
+//! \brief      Packet sent handler (ISR)
+//------------------------------------------------------------------------------
+static void UART_sent(void)
+{
+    UART_sentCount++;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              UART_received()
+// Description:
+//! \brief      Data received handler (ISR)
+//------------------------------------------------------------------------------
+static void UART_received(void)
+{
+    UART_receivedCount++;
+}
+
+//------------------------------------------------------------------------------
+// Class:
+//              UartDmaTestFixture
+// Description:
+//! \brief      Fixtures for UART DMA mode on simulated USART1 and DMA1
+//------------------------------------------------------------------------------
+class UartDmaTestFixture : public ::testing::Test
+{
+protected:
+    uint8_t                 buffer[UART_RX_SIZE];   //!< reception buffer
+    std::vector<uint8_t>    sent;                   //!< line data
+    std::vector<uint8_t>    received;               //!< read data
+
+    //! Test case setup
+    void SetUp()
+    {
+        STM32_SIM_reset();
+        UART_stopReceive();
+        UART_init();
+        STM32_SIM_run();
+        UART_sentCount = 0;
+        UART_receivedCount = 0;
+
+        srand(47);
+        sent.resize(64*1024);
+        for(size_t index = 0; index < sent.size(); index++)
+            sent[index] = (uint8_t)rand();
+        received.clear();
+    }
+
+    //! Take received data
+    void read(void)
+    {
+        uint8_t data[64];
+        uint16_t size;
+
+        while((size = UART_read(data, sizeof(data))) != 0)
+            received.insert(received.end(), data, data + size);
+    }
+};
+
+//------------------------------------------------------------------------------
+// Function:
+//              UartDmaTest.UART_send()
+// Description:
+//! \brief      Packet is sent back-to-back, handler after the last stop bit
+//------------------------------------------------------------------------------
+TEST_F(UartDmaTestFixture, UART_send)
+{
+    const uint32_t size = 1024;
+
+    UART_send(&sent[0], size, UART_sent);
+    STM32_SIM_run();
+
+    STM32_SIM_idle(size - 1);
+    ASSERT_EQ(0u, UART_sentCount);
+    STM32_SIM_idle(1);
+    ASSERT_EQ(1u, UART_sentCount);
+    ASSERT_EQ(size, STM32_SIM.txCount);
+    ASSERT_EQ(0, memcmp(&sent[0], STM32_SIM.txLog, size));
+
+    // DMA transfer complete and USART transmission complete
+    ASSERT_EQ(1u, STM32_SIM.dmaInterrupts);
+    ASSERT_EQ(1u, STM32_SIM.usartInterrupts);
+
+    // Transmitter is idle
+    STM32_SIM_idle(10);
+    ASSERT_EQ(size, STM32_SIM.txCount);
+    ASSERT_EQ(1u, UART_sentCount);
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              UartDmaTest.UART_receiveStream()
+// Description:
+//! \brief      64 KB in frames by circular DMA: nothing is lost
+//------------------------------------------------------------------------------
+TEST_F(UartDmaTestFixture, UART_receiveStream)
+{
+    const size_t frame = 200;
+
+    UART_receive(buffer, sizeof(buffer), UART_received);
+
+    // Frames with 2 characters gap, main loop reads every 64 characters
+    for(size_t index = 0; index < sent.size(); index++)
+    {
+        STM32_SIM_uartRx(sent[index]);
+        if((index + 1) % frame == 0)
+            STM32_SIM_idle(2);
+        if((index + 1) % 64 == 0)
+            read();
+    }
+    STM32_SIM_idle(2);
+    read();
+
+    ASSERT_EQ(0u, STM32_SIM.rxOverruns);
+    ASSERT_EQ(0u, UART_getLost());
+    ASSERT_EQ(sent.size(), received.size());
+    ASSERT_TRUE(sent == received);
+
+    uint32_t interrupts = STM32_SIM.dmaInterrupts + STM32_SIM.usartInterrupts;
+    ASSERT_EQ(interrupts, UART_receivedCount);
+    printf("[ BENCH    ] DMA RX: %.1f interrupts/KB "
+           "(byte interrupts: 1024/KB)\n",
+           interrupts*1024.0/sent.size());
+    ASSERT_LT(interrupts*1024.0/sent.size(), 16.0);
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              UartDmaTest.UART_receiveIdle()
+// Description:
+//! \brief      Frame is taken on idle line
+//------------------------------------------------------------------------------
+TEST_F(UartDmaTestFixture, UART_receiveIdle)
+{
+    uint8_t data[UART_RX_SIZE];
+
+    UART_receive(buffer, sizeof(buffer), UART_received);
+
+    // No idle interrupt before the first character
+    STM32_SIM_idle(10);
+    ASSERT_EQ(0u, UART_receivedCount);
+
+    for(int index = 0; index < 10; index++)
+        STM32_SIM_uartRx(sent[index]);
+    ASSERT_EQ(0u, UART_receivedCount);
+
+    STM32_SIM_idle(1);
+    ASSERT_EQ(1u, UART_receivedCount);
+    ASSERT_EQ(10u, UART_read(data, sizeof(data)));
+    ASSERT_EQ(0, memcmp(data, &sent[0], 10));
+    ASSERT_EQ(0u, UART_read(data, sizeof(data)));
+
+    // Single idle interrupt per frame
+    STM32_SIM_idle(10);
+    ASSERT_EQ(1u, UART_receivedCount);
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              UartDmaTest.UART_receiveLost()
+// Description:
+//! \brief      Buffer overwritten before read: the newest data are kept
+//------------------------------------------------------------------------------
+TEST_F(UartDmaTestFixture, UART_receiveLost)
+{
+    const size_t size = 1000;
+
+    UART_receive(buffer, sizeof(buffer), UART_received);
+
+    for(size_t index = 0; index < size; index++)
+        STM32_SIM_uartRx(sent[index]);
+    STM32_SIM_idle(1);
+    read();
+
+    ASSERT_EQ(0u, STM32_SIM.rxOverruns);
+    ASSERT_EQ(size - UART_RX_SIZE, UART_getLost());
+    ASSERT_EQ((size_t)UART_RX_SIZE, received.size());
+    ASSERT_EQ(0, memcmp(&received[0], &sent[size - UART_RX_SIZE],
+                        UART_RX_SIZE));
+}
+
+//------------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+    // Initialize Google Test Framework
+    testing::InitGoogleTest(&argc, argv);
+    // Run all tests
+    return RUN_ALL_TESTS();
+}
+
+//******************************************************************************
+// End of file
+//******************************************************************************
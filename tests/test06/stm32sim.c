@@ -0,0 +1,355 @@
+//******************************************************************************
+// Copyright (C) 2026 Bogdan Kokotenko
+//
+//   File description:
+//! \file   test06/stm32sim.c
+//! \brief  Simulation of STM32F0x USART1 and DMA1 channels 2/3
+//!
+//!*****************************************************************************
+//! __Revisions:__
+//!  Date       | Author           | Comments
+//!  ---------- | ---------------- | ----------------
+//!  18/10/2026 | Bogdan Kokotenko | Initial draft
+//
+//******************************************************************************
+#include "types.h"
+#include "stm32sim.h"
+
+//------------------------------------------------------------------------------
+// Registers
+volatile uint8_t        STM32_SIM_gie;
+GPIO_TypeDef            STM32_SIM_gpioa;
+RCC_TypeDef             STM32_SIM_rcc;
+DMA_TypeDef             STM32_SIM_dma1;
+DMA_Channel_TypeDef     STM32_SIM_dma1Channel[5];
+USART_TypeDef           STM32_SIM_usart1;
+
+//! Critical section nesting (hal.h)
+uint16_t GINT_criticalNesting;
+
+//! Simulation state
+STM32_SIM_t STM32_SIM;
+
+//! ISRs (uart.c)
+void USART1_IRQHandler(void);
+void DMA1_Channel2_3_IRQHandler(void);
+
+//! DMA channel working state
+static struct DMA_SIM_Channel_t{
+    bool        enabled;            //!< EN seen by controller
+    uint32_t    size;               //!< CNDTR at enable (circular reload)
+}DMA_SIM_channel[5];
+
+//! Transmitter shift register
+static struct USART_SIM_Tx_t{
+    bool        busy;               //!< character is shifted out
+    uint8_t     shift;              //!< shift register
+}USART_SIM_tx;
+
+//! Receiver got characters after the last idle line
+static bool USART_SIM_rxActive;
+
+//------------------------------------------------------------------------------
+// Function:
+//              STM32_SIM_reset()
+// Description:
+//! \brief      Reset registers and statistics
+//------------------------------------------------------------------------------
+void STM32_SIM_reset(void)
+{
+    memset(&STM32_SIM_gpioa, 0, sizeof(STM32_SIM_gpioa));
+    memset(&STM32_SIM_rcc, 0, sizeof(STM32_SIM_rcc));
+    memset(&STM32_SIM_dma1, 0, sizeof(STM32_SIM_dma1));
+    memset(STM32_SIM_dma1Channel, 0, sizeof(STM32_SIM_dma1Channel));
+    memset(&STM32_SIM_usart1, 0, sizeof(STM32_SIM_usart1));
+    STM32_SIM_usart1.ISR = USART_ISR_TC | USART_ISR_TXE;
+    memset(DMA_SIM_channel, 0, sizeof(DMA_SIM_channel));
+    memset(&USART_SIM_tx, 0, sizeof(USART_SIM_tx));
+    USART_SIM_rxActive = false;
+    GINT_criticalNesting = 0;
+    STM32_SIM_gie = 1;
+    memset(&STM32_SIM, 0, sizeof(STM32_SIM));
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              SIM_clearFlags()
+// Description:
+//! \brief      Apply USART ICR and DMA IFCR writes
+//------------------------------------------------------------------------------
+static void SIM_clearFlags(void)
+{
+    uint8_t channel;
+
+    STM32_SIM_usart1.ISR &= ~STM32_SIM_usart1.ICR;
+    STM32_SIM_usart1.ICR = 0;
+
+    // CGIFx clears all flags of channel x
+    for(channel = 0; channel < 5; channel++)
+        if(STM32_SIM_dma1.IFCR & (1ul << (4*channel)))
+            STM32_SIM_dma1.IFCR |= 0xFul << (4*channel);
+    STM32_SIM_dma1.ISR &= ~STM32_SIM_dma1.IFCR;
+    STM32_SIM_dma1.IFCR = 0;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              DMA_SIM_enabled()
+// Description:
+//! \brief      Latch channel size when EN is set
+//! \return     true, if channel has transfers to do
+//------------------------------------------------------------------------------
+static bool DMA_SIM_enabled(uint8_t channel)
+{
+    DMA_Channel_TypeDef* regs = &STM32_SIM_dma1Channel[channel];
+
+    if(!(regs->CCR & DMA_CCR_EN))
+    {
+        DMA_SIM_channel[channel].enabled = false;
+        return false;
+    }
+    if(!DMA_SIM_channel[channel].enabled)
+    {
+        DMA_SIM_channel[channel].enabled = true;
+        DMA_SIM_channel[channel].size = regs->CNDTR;
+    }
+    return regs->CNDTR != 0;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              DMA_SIM_transfer()
+// Description:
+//! \brief      Single byte transfer of enabled channel
+//------------------------------------------------------------------------------
+static void DMA_SIM_transfer(uint8_t channel)
+{
+    DMA_Channel_TypeDef* regs = &STM32_SIM_dma1Channel[channel];
+    uint32_t size = DMA_SIM_channel[channel].size;
+    volatile uint8_t* memory = (volatile uint8_t*)regs->CMAR;
+
+    if(regs->CCR & DMA_CCR_MINC)
+        memory += size - regs->CNDTR;
+
+    if(regs->CCR & DMA_CCR_DIR)
+    {
+        // Memory to TDR: clears TC and TXE
+        *(volatile uint16_t*)regs->CPAR = *memory;
+        if(regs->CPAR == (uintptr_t)&STM32_SIM_usart1.TDR)
+            STM32_SIM_usart1.ISR &= ~(USART_ISR_TC | USART_ISR_TXE);
+    }
+    else
+    {
+        // RDR to memory: clears RXNE
+        *memory = (uint8_t)*(volatile uint16_t*)regs->CPAR;
+        if(regs->CPAR == (uintptr_t)&STM32_SIM_usart1.RDR)
+            STM32_SIM_usart1.ISR &= ~USART_ISR_RXNE;
+    }
+
+    regs->CNDTR--;
+    if(regs->CNDTR == size/2)
+        STM32_SIM_dma1.ISR |= (DMA_ISR_GIF2 | DMA_ISR_HTIF2) <<
+                              (4*(channel - 1));
+    if(regs->CNDTR == 0)
+    {
+        STM32_SIM_dma1.ISR |= (DMA_ISR_GIF2 | DMA_ISR_TCIF2) <<
+                              (4*(channel - 1));
+        if(regs->CCR & DMA_CCR_CIRC)
+            regs->CNDTR = size;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              USART_SIM_load()
+// Description:
+//! \brief      TDR to shift register when transmitter is free
+//------------------------------------------------------------------------------
+static void USART_SIM_load(void)
+{
+    if(!USART_SIM_tx.busy && !(STM32_SIM_usart1.ISR & USART_ISR_TXE))
+    {
+        USART_SIM_tx.busy = true;
+        USART_SIM_tx.shift = (uint8_t)STM32_SIM_usart1.TDR;
+        STM32_SIM_usart1.ISR |= USART_ISR_TXE;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              DMA_SIM_requests()
+// Description:
+//! \brief      Serve USART DMA requests
+//------------------------------------------------------------------------------
+static void DMA_SIM_requests(void)
+{
+    USART_TypeDef* usart = &STM32_SIM_usart1;
+
+    // Channel 2: USART1 TX
+    while((usart->CR3 & USART_CR3_DMAT) && (usart->ISR & USART_ISR_TXE) &&
+          DMA_SIM_enabled(1))
+    {
+        DMA_SIM_transfer(1);
+        USART_SIM_load();
+    }
+
+    // Channel 3: USART1 RX
+    if((usart->CR3 & USART_CR3_DMAR) && (usart->ISR & USART_ISR_RXNE) &&
+       DMA_SIM_enabled(2))
+        DMA_SIM_transfer(2);
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              SIM_dmaPending()
+// Description:
+//! \brief      Check DMA channel 2/3 interrupt request
+//------------------------------------------------------------------------------
+static bool SIM_dmaPending(void)
+{
+    uint8_t channel;
+
+    for(channel = 1; channel <= 2; channel++)
+    {
+        uint32_t flags = STM32_SIM_dma1.ISR >> (4*channel);
+        uint32_t ccr = STM32_SIM_dma1Channel[channel].CCR;
+
+        if(((flags & 2) && (ccr & DMA_CCR_TCIE)) ||
+           ((flags & 4) && (ccr & DMA_CCR_HTIE)))
+            return true;
+    }
+    return false;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              SIM_usartPending()
+// Description:
+//! \brief      Check USART1 interrupt request
+//------------------------------------------------------------------------------
+static bool SIM_usartPending(void)
+{
+    uint32_t isr = STM32_SIM_usart1.ISR;
+    uint32_t cr1 = STM32_SIM_usart1.CR1;
+
+    return ((isr & USART_ISR_IDLE) && (cr1 & USART_CR1_IDLEIE)) ||
+           ((isr & USART_ISR_TC) && (cr1 & USART_CR1_TCIE)) ||
+           ((isr & USART_ISR_TXE) && (cr1 & USART_CR1_TXEIE)) ||
+           ((isr & (USART_ISR_RXNE | USART_ISR_ORE)) &&
+            (cr1 & USART_CR1_RXNEIE));
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              STM32_SIM_run()
+// Description:
+//! \brief      Serve DMA requests and interrupts
+//------------------------------------------------------------------------------
+void STM32_SIM_run(void)
+{
+    bool pending = true;
+
+    SIM_clearFlags();
+    DMA_SIM_requests();
+
+    while(pending && STM32_SIM_gie)
+    {
+        pending = false;
+
+        // DMA1_Channel2_3_IRQn has higher priority (lower number)
+        if(SIM_dmaPending())
+        {
+            pending = true;
+            STM32_SIM_gie = 0;
+            DMA1_Channel2_3_IRQHandler();
+            STM32_SIM_gie = 1;
+            STM32_SIM.dmaInterrupts++;
+        }
+        else if(SIM_usartPending())
+        {
+            pending = true;
+            STM32_SIM_gie = 0;
+            USART1_IRQHandler();
+            STM32_SIM_gie = 1;
+            STM32_SIM.usartInterrupts++;
+            // ISR reads RDR
+            if(STM32_SIM_usart1.CR1 & USART_CR1_RXNEIE)
+                STM32_SIM_usart1.ISR &= ~USART_ISR_RXNE;
+        }
+
+        SIM_clearFlags();
+        DMA_SIM_requests();
+    }
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              USART_SIM_step()
+// Description:
+//! \brief      One character time of transmitter
+//------------------------------------------------------------------------------
+static void USART_SIM_step(void)
+{
+    STM32_SIM.time++;
+
+    if(USART_SIM_tx.busy)
+    {
+        if(STM32_SIM.txCount < STM32_SIM_TX_LOG)
+            STM32_SIM.txLog[STM32_SIM.txCount] = USART_SIM_tx.shift;
+        STM32_SIM.txCount++;
+        USART_SIM_tx.busy = false;
+    }
+    USART_SIM_load();
+    if(!USART_SIM_tx.busy && (STM32_SIM_usart1.ISR & USART_ISR_TXE))
+        STM32_SIM_usart1.ISR |= USART_ISR_TC;
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              STM32_SIM_uartRx()
+// Description:
+//! \brief      Character received by USART1
+//------------------------------------------------------------------------------
+void STM32_SIM_uartRx(uint8_t ch)
+{
+    USART_SIM_step();
+
+    // RDR was not read: the new character is lost
+    if(STM32_SIM_usart1.ISR & USART_ISR_RXNE)
+    {
+        STM32_SIM_usart1.ISR |= USART_ISR_ORE;
+        STM32_SIM.rxOverruns++;
+    }
+    else
+    {
+        STM32_SIM_usart1.RDR = ch;
+        STM32_SIM_usart1.ISR |= USART_ISR_RXNE;
+    }
+    USART_SIM_rxActive = true;
+
+    STM32_SIM_run();
+}
+
+//------------------------------------------------------------------------------
+// Function:
+//              STM32_SIM_idle()
+// Description:
+//! \brief      Line is idle for number of character times
+//------------------------------------------------------------------------------
+void STM32_SIM_idle(uint32_t chars)
+{
+    while(chars--)
+    {
+        USART_SIM_step();
+        if(USART_SIM_rxActive)
+        {
+            USART_SIM_rxActive = false;
+            STM32_SIM_usart1.ISR |= USART_ISR_IDLE;
+        }
+        STM32_SIM_run();
+    }
+}
+
+//******************************************************************************
+// End of file
+//******************************************************************************
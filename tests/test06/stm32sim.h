@@ -0,0 +1,77 @@
+//******************************************************************************
+// Copyright (C) 2026 Bogdan Kokotenko
+//
+//! \addtogroup test06
+//! @{
+//******************************************************************************
+//   File description:
+//! \file   test06/stm32sim.h
+//! \brief  Simulation of STM32F0x USART1 and DMA1 channels 2/3
+//!
+//! \details Time is counted in UART characters. Every character time:
+//!          - transmitter shifts out one character, TDR moves to shift
+//!            register (TXE), TC is set when both are empty
+//!          - receiver gets one character (RXNE, ORE if RDR was not read)
+//!            or line is idle (IDLE once after received characters)
+//!
+//!          DMA serves TXE (channel 2) and RXNE (channel 3) requests:
+//!          CNDTR counts down, HT/TC flags, circular reload. TDR write
+//!          clears TC and TXE, RDR read clears RXNE. Flags are cleared by
+//!          writes to USART ICR and DMA IFCR after CPU code (only the last
+//!          write counts, so ISR clears flags once). Interrupts are taken
+//!          immediately when enabled and GIE is set; RXNE interrupt is
+//!          expected to read RDR.
+//!
+//!*****************************************************************************
+//! __Revisions:__
+//!  Date       | Author           | Comments
+//!  ---------- | ---------------- | ----------------
+//!  18/10/2026 | Bogdan Kokotenko | Initial draft
+//
+//******************************************************************************
+#ifndef STM32SIM_H
+#define STM32SIM_H
+
+#include "stm32f0xx.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//! Size of transmitted data log
+#define STM32_SIM_TX_LOG    4096
+
+//! Simulation state and statistics
+typedef struct _STM32_SIM_t{
+    uint32_t    time;               //!< character times
+    uint32_t    rxOverruns;         //!< characters lost in USART (ORE)
+    uint32_t    usartInterrupts;    //!< USART1 ISR calls
+    uint32_t    dmaInterrupts;      //!< DMA1 channel 2/3 ISR calls
+    uint32_t    txCount;            //!< characters transmitted
+    uint8_t     txLog[STM32_SIM_TX_LOG];    //!< transmitted characters
+}STM32_SIM_t;
+
+//! Simulation state
+extern STM32_SIM_t STM32_SIM;
+
+//! Reset registers and statistics
+void STM32_SIM_reset(void);
+
+//! Receive character by USART1 (one character time)
+void STM32_SIM_uartRx(uint8_t ch);
+
+//! Line is idle for number of character times
+void STM32_SIM_idle(uint32_t chars);
+
+//! Serve DMA requests and interrupts (after CPU code)
+void STM32_SIM_run(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // STM32SIM_H
+//! @}
+//******************************************************************************
+// End of file
+//******************************************************************************
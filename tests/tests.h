@@ -7,7 +7,11 @@
 //! This manual includes next unit tests which should be used to determine 
 //! whether code is working:
 //!     - Test01: Unit tests for task scheduler
-//!     - Test02: To do...
+//!     - Test02: Unit tests for simulated MinGW HAL peripherals
+//!     - Test03: Unit tests and benchmarks for CRC library
+//!     - Test04: Unit tests and benchmarks for algorithm library
+//!     - Test05: Unit tests for MSP430F5x drivers on simulated registers
+//!     - Test06: Unit tests for STM32F0x drivers on simulated registers
 //!
 //! \file       tests.h   	
 //! \brief      Unit tests description and global definitions